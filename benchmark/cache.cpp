@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/lfu_cache.hpp"
+#include "../include/lru_cache.hpp"
+
+/**
+ * Mede a LruCache e a LfuCache com chaves de distribuição de Zipf: cada
+ * consulta que falha insere a chave na cache.
+ *
+ * Uso: cache_benchmark [capacidade] [operacoes] [expoente]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+/**
+ * Gera chaves em [0, universe) com probabilidade proporcional a
+ * 1 / (posto + 1)^s, embaralhando os postos para espalhar as chaves
+ * frequentes.
+ */
+std::vector<int> zipf_keys(size_t universe, size_t count, double s,
+                           std::mt19937_64& rng) {
+    std::vector<double> cdf(universe);
+    double total = 0;
+    for (size_t i = 0; i < universe; i++) {
+        total += 1.0 / std::pow(double(i + 1), s);
+        cdf[i] = total;
+    }
+    std::vector<int> rank_to_key(universe);
+    for (size_t i = 0; i < universe; i++) {
+        rank_to_key[i] = static_cast<int>(i);
+    }
+    std::shuffle(rank_to_key.begin(), rank_to_key.end(), rng);
+
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<int> keys(count);
+    for (auto& key : keys) {
+        auto rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) -
+                    cdf.begin();
+        key = rank_to_key[std::min<size_t>(rank, universe - 1)];
+    }
+    return keys;
+}
+
+template <class Cache>
+void run(const char* name, size_t capacity, const std::vector<int>& keys) {
+    Cache cache(capacity);
+    auto ms = measure_ms([&] {
+        for (auto key : keys) {
+            if (cache.get(key) == nullptr) {
+                cache.put(key, key);
+            }
+        }
+    });
+    auto lookups = cache.hits() + cache.misses();
+    std::cout << name << ":\n"
+              << "  tempo: " << ms << " ms ("
+              << keys.size() / ms * 1000 << " operacoes/s)\n"
+              << "  taxa de acerto: " << 100.0 * cache.hits() / lookups
+              << "%\n"
+              << "  descartes: " << cache.evictions() << "\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t capacity = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t operations =
+        argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5 * capacity;
+    double s = argc > 3 ? std::strtod(argv[3], nullptr) : 0.99;
+
+    std::mt19937_64 rng(42);
+    auto keys = zipf_keys(10 * capacity, operations, s, rng);
+
+    std::cout << "capacidade = " << capacity << ", operacoes = " << operations
+              << ", expoente = " << s << "\n";
+    run<LruCache<int, int>>("LruCache", capacity, keys);
+    run<LfuCache<int, int>>("LfuCache", capacity, keys);
+    return 0;
+}
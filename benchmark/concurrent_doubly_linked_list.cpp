@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../include/concurrent_doubly_linked_list.hpp"
+#include "../include/doubly_linked_list.hpp"
+
+/**
+ * Compara a ConcurrentDoublyLinkedList com uma DoublyLinkedList protegida
+ * por uma única trava, em cargas mistas de leitura (`contains`) e escrita
+ * (`push_back` ou remoção de um valor) com 80/20 e 50/50 de leituras.
+ *
+ * Uso: concurrent_doubly_linked_list_benchmark [threads] [operacoes por
+ * thread] [tamanho inicial]
+ */
+
+/**
+ * DoublyLinkedList protegida por uma trava para a lista inteira.
+ */
+class LockedList {
+  public:
+    void push_back(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        list.push_back(value);
+    }
+
+    bool contains(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        return list.contains(value);
+    }
+
+    bool erase(int value) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = list.find(value);
+        if (it == list.end()) {
+            return false;
+        }
+        list.erase(it, it + 1);
+        return true;
+    }
+
+  private:
+    std::mutex lock;
+    DoublyLinkedList<int> list;
+};
+
+template <class List>
+double run(size_t threads, size_t operations, size_t initial, int read_pct) {
+    List list;
+    int key_range = static_cast<int>(2 * initial);
+    for (size_t i = 0; i < initial; i++) {
+        list.push_back(static_cast<int>(2 * i));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            std::mt19937 rng(static_cast<unsigned>(t + 1));
+            std::uniform_int_distribution<int> key(0, key_range - 1);
+            std::uniform_int_distribution<int> pct(0, 99);
+            for (size_t i = 0; i < operations; i++) {
+                auto k = key(rng);
+                auto p = pct(rng);
+                if (p < read_pct) {
+                    list.contains(k);
+                } else if (p % 2 == 0) {
+                    list.push_back(k);
+                } else {
+                    list.erase(k);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char const* argv[]) {
+    size_t hardware = std::max(2u, std::thread::hardware_concurrency());
+    size_t threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : hardware;
+    size_t operations =
+        argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20000;
+    size_t initial = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 500;
+
+    std::cout << "threads = " << threads << ", operacoes por thread = "
+              << operations << ", tamanho inicial = " << initial << "\n";
+    for (int read_pct : {80, 50}) {
+        auto locked = run<LockedList>(threads, operations, initial, read_pct);
+        auto fine = run<ConcurrentDoublyLinkedList<int>>(threads, operations,
+                                                         initial, read_pct);
+        std::cout << read_pct << "% leituras / " << 100 - read_pct
+                  << "% escritas:\n"
+                  << "  trava unica: " << locked << " ms\n"
+                  << "  trava por no: " << fine << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/doubly_linked_list.hpp"
+
+/**
+ * Mede o acesso por índice na DoublyLinkedList com índices uniformes e com
+ * índices concentrados perto da cauda, comparando a caminhada a partir do
+ * início (`begin() + i`) com o acesso pela extremidade mais próxima (`at`).
+ *
+ * Uso: doubly_linked_list_index_benchmark [n] [consultas]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void run(const char* name, DoublyLinkedList<int>& list,
+         const std::vector<size_t>& indices) {
+    long long sum = 0;
+    auto from_head = measure_ms([&] {
+        for (auto i : indices) {
+            sum += *(list.begin() + i);
+        }
+    });
+    auto nearest = measure_ms([&] {
+        for (auto i : indices) {
+            sum -= list.at(i);
+        }
+    });
+    std::cout << name << ":\n"
+              << "  begin() + i: " << from_head << " ms\n"
+              << "  at(i): " << nearest << " ms\n"
+              << "  (checagem: " << sum << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    DoublyLinkedList<int> list;
+    for (size_t i = 0; i < n; i++) {
+        list.push_back(static_cast<int>(i));
+    }
+
+    std::mt19937_64 rng(42);
+    std::vector<size_t> uniform(queries);
+    std::uniform_int_distribution<size_t> uniform_dist(0, n - 1);
+    for (auto& i : uniform) {
+        i = uniform_dist(rng);
+    }
+
+    // Distância até a cauda com distribuição exponencial (média n / 100).
+    std::vector<size_t> tail_biased(queries);
+    std::exponential_distribution<double> tail_dist(100.0 / n);
+    for (auto& i : tail_biased) {
+        auto offset = static_cast<size_t>(tail_dist(rng));
+        i = n - 1 - (offset < n ? offset : n - 1);
+    }
+
+    std::cout << "n = " << n << ", consultas = " << queries << "\n";
+    run("indices uniformes", list, uniform);
+    run("indices perto da cauda", list, tail_biased);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/flat_map.hpp"
+#include "../include/linked_list.hpp"
+
+/**
+ * Compara um mapa modelado como LinkedList<Pair<K, V>> (busca com `find`)
+ * com a FlatMap: buscas por chave, inserções uma a uma contra
+ * `insert_or_assign_batch` e uma varredura de intervalo.
+ *
+ * Uso: flat_map_benchmark [chaves] [buscas] [lote]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, double base_ms, double flat_ms, double check) {
+    std::cout << name << ": " << base_ms << " ms -> " << flat_ms << " ms ("
+              << base_ms / flat_ms << "x, checagem: " << check << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+    size_t lookups = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20000;
+    size_t batch = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 200000;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> key(0, 1 << 30);
+    VectorList<Pair<int, int>> pairs(count);
+    for (size_t i = 0; i < count; i++) {
+        pairs.push_back(Pair<int, int>(key(rng), static_cast<int>(i)));
+    }
+    std::cout << "chaves = " << count << ", buscas = " << lookups
+              << ", lote = " << batch << "\n";
+
+    LinkedList<Pair<int, int>> list;
+    for (size_t i = 0; i < count; i++) {
+        list.push_front(pairs[i]);
+    }
+    FlatMap<int, int> map(pairs);
+
+    long long list_sum = 0;
+    auto list_ms = measure_ms([&] {
+        for (size_t i = 0; i < lookups; i++) {
+            list_sum += list.find(pairs[i * 7919 % count]).second();
+        }
+    });
+    long long map_sum = 0;
+    auto map_ms = measure_ms([&] {
+        for (size_t i = 0; i < lookups; i++) {
+            map_sum += *map.find(pairs[i * 7919 % count].first());
+        }
+    });
+    report("busca", list_ms, map_ms, static_cast<double>(list_sum - map_sum));
+
+    VectorList<Pair<int, int>> updates(batch);
+    for (size_t i = 0; i < batch; i++) {
+        updates.push_back(Pair<int, int>(key(rng), static_cast<int>(i)));
+    }
+    FlatMap<int, int> single;
+    auto single_ms = measure_ms([&] {
+        for (size_t i = 0; i < batch; i++) {
+            single.insert_or_assign(updates[i].first(), updates[i].second());
+        }
+    });
+    FlatMap<int, int> batched;
+    auto batch_ms =
+        measure_ms([&] { batched.insert_or_assign_batch(updates); });
+    report("insercao (uma a uma -> lote)", single_ms, batch_ms,
+           static_cast<double>(single.size()) - batched.size());
+
+    long long scan_sum = 0;
+    size_t scanned = 0;
+    auto scan_ms = measure_ms([&] {
+        scanned = batched.range(1 << 28, 1 << 29,
+                                [&](int, int value) { scan_sum += value; });
+    });
+    std::cout << "intervalo: " << scanned << " pares em " << scan_ms
+              << " ms (checagem: " << scan_sum << ")\n";
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <math.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/geometry.hpp"
+
+/**
+ * Compara os algoritmos de geometria com versões diretas sobre uma
+ * VectorList<Point>: o par mais próximo contra a comparação de todos os
+ * pares (em um subconjunto), o fecho convexo e o retângulo envolvente em
+ * uma e em várias threads.
+ *
+ * Uso: geometry_benchmark [pontos] [pontos_forca_bruta] [threads]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, double base_ms, double fast_ms, double check) {
+    std::cout << name << ": " << base_ms << " ms -> " << fast_ms << " ms ("
+              << base_ms / fast_ms << "x, checagem: " << check << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    size_t brute = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+    unsigned threads =
+        argc > 3 ? static_cast<unsigned>(std::strtoul(argv[3], nullptr, 10))
+                 : 0;
+    brute = brute < count ? brute : count;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coordinate(0, 1000000);
+    VectorList<Point> list(count);
+    for (size_t i = 0; i < count; i++) {
+        list.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    PointCloud cloud(list);
+    VectorList<Point> sample(brute);
+    for (size_t i = 0; i < brute; i++) {
+        sample.push_back(list[i]);
+    }
+    std::cout << "pontos = " << count << ", forca bruta = " << brute
+              << ", threads = " << threads << "\n";
+
+    double naive = INFINITY;
+    auto base_ms = measure_ms([&] {
+        for (size_t i = 0; i < brute; i++) {
+            for (size_t j = i + 1; j < brute; j++) {
+                auto d = sample[i].distance(sample[j]);
+                naive = d < naive ? d : naive;
+            }
+        }
+    });
+    ClosestPair pair{};
+    auto fast_ms = measure_ms([&] { pair = closest_pair(sample); });
+    report("par mais proximo (todos os pares)", base_ms, fast_ms,
+           naive - pair.distance);
+
+    ClosestPair parallel{};
+    base_ms = measure_ms([&] { pair = closest_pair(list); });
+    fast_ms = measure_ms([&] { parallel = closest_pair(list, threads); });
+    report("par mais proximo (threads)", base_ms, fast_ms,
+           pair.distance - parallel.distance);
+
+    size_t serial_size = 0, parallel_size = 0;
+    base_ms = measure_ms([&] { serial_size = convex_hull(list).size(); });
+    fast_ms =
+        measure_ms([&] { parallel_size = convex_hull(list, threads).size(); });
+    report("fecho convexo (threads)", base_ms, fast_ms,
+           static_cast<double>(serial_size) - parallel_size);
+
+    double naive_width = 0;
+    base_ms = measure_ms([&] {
+        double min_x = INFINITY, max_x = -INFINITY;
+        for (size_t i = 0; i < count; i++) {
+            min_x = fmin(min_x, list[i].get_x());
+            max_x = fmax(max_x, list[i].get_x());
+        }
+        naive_width = max_x - min_x;
+    });
+    BoundingBox box{};
+    fast_ms = measure_ms([&] { box = bounding_box(cloud, threads); });
+    report("retangulo (PointCloud)", base_ms, fast_ms,
+           naive_width - (box.max_x - box.min_x));
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <stdint.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+
+#include "../include/hash_index.hpp"
+#include "../include/hash_map.hpp"
+
+/**
+ * Mede inserção, busca com sucesso, busca sem sucesso e remoção na
+ * HashMap (Robin Hood), na HashIndex (sondagem linear) e no
+ * std::unordered_map, para cada número de chaves pedido. As chaves são
+ * inteiros de 32 bits distintos e espalhados; os tempos são por operação.
+ * Acima de 10M chaves, só a HashMap é medida, para caber na memória.
+ *
+ * Uso: hash_map_benchmark [chaves...] (padrão: 1000 1000000)
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+/// Chave distinta para cada `i < 2^32` (multiplicação por um número ímpar).
+uint32_t key_of(size_t i) {
+    return static_cast<uint32_t>(i * 2654435761u);
+}
+
+/**
+ * @brief Mede as quatro operações em um mapa com a interface da HashMap.
+ *
+ * `insert(map, key, value)` adapta a inserção de cada tipo.
+ */
+template <class Map, class Insert, class Find, class Erase>
+void run(const char* name, size_t count, Map& map, Insert insert, Find find,
+         Erase erase) {
+    // Com poucas chaves, as buscas se repetem para dar um tempo mensurável.
+    size_t rounds = count < 1000000 ? 1000000 / count : 1;
+    auto insert_ms = measure_ms([&] {
+        for (size_t i = 0; i < count; i++) {
+            insert(map, key_of(i), static_cast<uint32_t>(i));
+        }
+    });
+    uint64_t hits = 0;
+    auto hit_ms = measure_ms([&] {
+        for (size_t r = 0; r < rounds; r++) {
+            for (size_t i = 0; i < count; i++) {
+                hits += find(map, key_of(i)) != nullptr;
+            }
+        }
+    });
+    uint64_t misses = 0;
+    auto miss_ms = measure_ms([&] {
+        for (size_t r = 0; r < rounds; r++) {
+            for (size_t i = count; i < 2 * count; i++) {
+                misses += find(map, key_of(i)) == nullptr;
+            }
+        }
+    });
+    size_t erased = 0;
+    auto erase_ms = measure_ms([&] {
+        for (size_t i = 0; i < count; i++) {
+            erased += erase(map, key_of(i));
+        }
+    });
+    auto per_op = [&](double ms, size_t ops) { return ms * 1e6 / ops; };
+    std::cout << "  " << name << ": insercao "
+              << per_op(insert_ms, count) << " ns, acerto "
+              << per_op(hit_ms, count * rounds) << " ns, falha "
+              << per_op(miss_ms, count * rounds) << " ns, remocao "
+              << per_op(erase_ms, count) << " ns (checagem: "
+              << hits + misses - 2 * count * rounds << ", " << count - erased
+              << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t defaults[] = {1000, 1000000};
+    size_t sizes = argc > 1 ? static_cast<size_t>(argc - 1) : 2;
+    for (size_t s = 0; s < sizes; s++) {
+        auto count =
+            argc > 1 ? std::strtoull(argv[s + 1], nullptr, 10) : defaults[s];
+        std::cout << "chaves = " << count << "\n";
+        {
+            HashMap<uint32_t, uint32_t> map;
+            run("HashMap", count, map,
+                [](auto& m, uint32_t k, uint32_t v) { m.insert(k, v); },
+                [](auto& m, uint32_t k) { return m.find(k); },
+                [](auto& m, uint32_t k) { return m.erase(k); });
+        }
+        if (count > 10000000) {
+            continue;
+        }
+        {
+            HashIndex<uint32_t, uint32_t> index;
+            run("HashIndex", count, index,
+                [](auto& m, uint32_t k, uint32_t v) { m.insert(k, v); },
+                [](auto& m, uint32_t k) { return m.find(k); },
+                [](auto& m, uint32_t k) { return m.erase(k); });
+        }
+        {
+            std::unordered_map<uint32_t, uint32_t> map;
+            run("std::unordered_map", count, map,
+                [](auto& m, uint32_t k, uint32_t v) { m[k] = v; },
+                [](auto& m, uint32_t k) -> const uint32_t* {
+                    auto found = m.find(k);
+                    return found == m.end() ? nullptr : &found->second;
+                },
+                [](auto& m, uint32_t k) { return m.erase(k) == 1; });
+        }
+    }
+    return 0;
+}
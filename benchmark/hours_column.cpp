@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "../include/hours_column.hpp"
+
+/**
+ * Mede agregações sobre muitos tempos, comparando laços simples sobre uma
+ * VectorList<Hours> com a HoursColumn (zonas de mínimo e máximo, blocos de
+ * 16 bits e AVX2), com uma thread e com uma thread por núcleo. Os tempos
+ * imitam um registro de eventos: crescem ao longo do dia com alguma
+ * variação.
+ *
+ * Uso: hours_column_benchmark [tempos]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, double ms, long long check) {
+    std::cout << "  " << name << ": " << ms << " ms (checagem: " << check
+              << ")\n";
+}
+
+void run_list(const VectorList<Hours>& list, const Hours& lo,
+              const Hours& hi) {
+    std::cout << "VectorList<Hours>:\n";
+    long long sum = 0;
+    auto ms = measure_ms([&] {
+        for (size_t i = 0; i < list.size(); i++) {
+            sum += list[i].to_seconds();
+        }
+    });
+    report("soma", ms, sum);
+
+    long long count = 0;
+    ms = measure_ms([&] {
+        for (size_t i = 0; i < list.size(); i++) {
+            count += list[i] >= lo && list[i] <= hi;
+        }
+    });
+    report("filtro", ms, count);
+
+    size_t counts[24] = {};
+    ms = measure_ms([&] {
+        for (size_t i = 0; i < list.size(); i++) {
+            auto hour = list[i].get_hours();
+            if (hour >= 0 && hour < 24) {
+                counts[hour]++;
+            }
+        }
+    });
+    report("histograma por hora", ms, static_cast<long long>(counts[12]));
+}
+
+void run_column(HoursColumn& column, unsigned threads, const Hours& lo,
+                const Hours& hi) {
+    column.set_threads(threads);
+    std::cout << "HoursColumn, " << column.threads() << " thread(s):\n";
+    long long sum = 0;
+    auto ms = measure_ms([&] { sum = column.sum(); });
+    report("soma", ms, sum);
+
+    long long count = 0;
+    ms = measure_ms([&] { count = column.count_between(lo, hi); });
+    report("filtro", ms, count);
+
+    size_t counts[24];
+    ms = measure_ms([&] { column.histogram(3600, counts, 24); });
+    report("histograma por hora", ms, static_cast<long long>(counts[12]));
+
+    size_t minutes[1440];
+    ms = measure_ms([&] { column.histogram(60, minutes, 1440); });
+    report("histograma por minuto", ms, static_cast<long long>(minutes[720]));
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> jitter(-300, 300);
+    VectorList<Hours> list(count);
+    for (size_t i = 0; i < count; i++) {
+        auto base = static_cast<int>(i * (24 * 3600 - 601) / count) + 300;
+        list.push_back(Hours::from_seconds(base + jitter(rng)));
+    }
+
+    HoursColumn column;
+    auto build_ms = measure_ms([&] { column = HoursColumn(list); });
+    std::cout << "tempos = " << count << ", construcao da coluna: " << build_ms
+              << " ms, memoria: " << column.memory_usage() / 1e6 << " MB (lista: "
+              << count * sizeof(Hours) / 1e6 << " MB)\n";
+
+    Hours lo(9, 30, 0);
+    Hours hi(17, 15, 0);
+    run_list(list, lo, hi);
+    run_column(column, 1, lo, hi);
+    run_column(column, 0, lo, hi);
+    return 0;
+}
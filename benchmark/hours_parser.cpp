@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../include/hours_parser.hpp"
+
+/**
+ * Mede a leitura em lote de tempos "HH:MM:SS", um por linha, comparando o
+ * caminho vetorizado (AVX2) com o escalar. Uma fração das linhas pode ser
+ * inválida, para medir o custo de sair do caminho rápido.
+ *
+ * Uso: hours_parser_benchmark [linhas] [fracao invalida]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void run(const char* name, const std::string& text, std::vector<int>& out,
+         bool use_simd) {
+    HoursParseResult result{0, 0, 0};
+    auto ms = measure_ms([&] {
+        result = parse_hours(text.data(), text.data() + text.size(),
+                             out.data(), out.size(), nullptr, use_simd);
+    });
+    long long sum = 0;
+    for (size_t i = 0; i < result.parsed; i++) {
+        sum += out[i];
+    }
+    std::cout << name << ": " << ms << " ms ("
+              << text.size() / ms / 1e6 << " GB/s, "
+              << result.lines / ms / 1e3 << " M linhas/s, " << result.malformed
+              << " invalidas, checagem: " << sum << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t lines = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    double bad_rate = argc > 2 ? std::strtod(argv[2], nullptr) : 0.0;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> second(0, 24 * 3600 - 1);
+    std::bernoulli_distribution bad(bad_rate);
+    std::string text;
+    text.reserve(lines * 9);
+    for (size_t i = 0; i < lines; i++) {
+        char buffer[Hours::max_chars];
+        auto written = Hours::from_seconds(second(rng))
+                           .to_chars(buffer, buffer + sizeof buffer);
+        if (bad(rng)) {
+            buffer[3] = '7';
+        }
+        text.append(buffer, written.ptr);
+        text += '\n';
+    }
+    std::vector<int> out(lines);
+
+    std::cout << "linhas = " << lines << ", fracao invalida = " << bad_rate
+              << ", AVX2 = " << (hours_parser_has_simd() ? "sim" : "nao")
+              << "\n";
+    run("vetorizado", text, out, true);
+    run("escalar", text, out, false);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/hours.hpp"
+#include "../include/interval_tree.hpp"
+
+/**
+ * Mede a IntervalTree<Hours> com turnos de até duas horas espalhados por
+ * uma semana: construção em lote e por inserções, consultas de
+ * sobreposição e de instante, e remoções. As consultas são comparadas com a
+ * varredura de todos os intervalos em uma VectorList.
+ *
+ * Uso: interval_tree_benchmark [intervalos] [consultas]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+    constexpr int week = 7 * 24 * 3600;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> start_of(0, week);
+    std::uniform_int_distribution<int> length_of(0, 2 * 3600);
+    VectorList<Pair<Hours, Hours>> list(count);
+    for (size_t i = 0; i < count; i++) {
+        auto start = start_of(rng);
+        list.push_back(Pair<Hours, Hours>(
+            Hours::from_seconds(start),
+            Hours::from_seconds(start + length_of(rng))));
+    }
+    std::cout << "intervalos = " << count << ", consultas = " << queries
+              << "\n";
+
+    IntervalTree<Hours> tree;
+    auto bulk_ms = measure_ms([&] { tree = IntervalTree<Hours>(list); });
+    IntervalTree<Hours> incremental;
+    auto insert_ms = measure_ms([&] {
+        incremental.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            incremental.insert(list[i]);
+        }
+    });
+    std::cout << "construcao em lote: " << bulk_ms << " ms\n"
+              << "insercoes: " << insert_ms << " ms\n";
+
+    // Consultas de 15 minutos; a varredura usa menos consultas por ser lenta.
+    size_t scans = queries / 100 > 0 ? queries / 100 : 1;
+    long long tree_found = 0;
+    auto tree_ms = measure_ms([&] {
+        std::mt19937_64 query_rng(7);
+        for (size_t q = 0; q < queries; q++) {
+            auto start = Hours::from_seconds(start_of(query_rng));
+            auto end = start + Hours(0, 15, 0);
+            tree_found +=
+                tree.overlapping(start, end, [](const Hours&, const Hours&) {});
+        }
+    });
+    long long scan_found = 0;
+    auto scan_ms = measure_ms([&] {
+        std::mt19937_64 query_rng(7);
+        for (size_t q = 0; q < scans; q++) {
+            auto start = Hours::from_seconds(start_of(query_rng));
+            auto end = start + Hours(0, 15, 0);
+            for (size_t i = 0; i < list.size(); i++) {
+                scan_found += list[i].first() <= end && start <= list[i].second();
+            }
+        }
+    });
+    std::cout << "sobreposicao, arvore: " << tree_ms / queries
+              << " ms por consulta (checagem: " << tree_found << ")\n"
+              << "sobreposicao, varredura: " << scan_ms / scans
+              << " ms por consulta (checagem: " << scan_found << ")\n";
+
+    long long stabbed = 0;
+    auto stabbing_ms = measure_ms([&] {
+        std::mt19937_64 query_rng(11);
+        for (size_t q = 0; q < queries; q++) {
+            stabbed += tree.stabbing(Hours::from_seconds(start_of(query_rng)),
+                                     [](const Hours&, const Hours&) {});
+        }
+    });
+    std::cout << "instante, arvore: " << stabbing_ms / queries
+              << " ms por consulta (checagem: " << stabbed << ")\n";
+
+    size_t erased = 0;
+    auto erase_ms = measure_ms([&] {
+        for (size_t i = 0; i < count; i += 2) {
+            erased += tree.erase(list[i].first(), list[i].second());
+        }
+    });
+    std::cout << "remocoes: " << erase_ms << " ms (" << erased
+              << " removidos, restam " << tree.size() << ")\n";
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../include/kd_tree.hpp"
+
+/**
+ * Mede a KdTree com pontos uniformes no quadrado [0, 1000)²: a construção
+ * com uma thread e com uma por núcleo, e as consultas por segundo de
+ * `nearest`, `k_nearest` e `count_within_radius`, comparando `nearest` com a
+ * varredura de todos os pontos com `Point::distance`.
+ *
+ * Cada tamanho da lista de argumentos é medido em sequência. Com 100
+ * milhões de pontos são necessários cerca de 4 GB de memória.
+ *
+ * Uso: kd_tree_benchmark [pontos...]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, size_t queries, double ms, size_t check) {
+    std::cout << "  " << name << ": " << queries / ms * 1e3
+              << " consultas/s (checagem: " << check << ")\n";
+}
+
+void run(size_t count) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+    std::vector<Point> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        points.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    std::vector<Point> queries;
+    for (int i = 0; i < 100000; i++) {
+        queries.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+
+    std::cout << "pontos = " << count << "\n";
+    auto serial_ms = measure_ms([&] {
+        KdTree tree(points.data(), points.data() + count);
+    });
+    KdTree* built = nullptr;
+    auto parallel_ms = measure_ms([&] {
+        built = new KdTree(points.data(), points.data() + count, 0);
+    });
+    const auto& tree = *built;
+    std::cout << "  construcao: " << serial_ms << " ms com 1 thread, "
+              << parallel_ms << " ms com "
+              << std::thread::hardware_concurrency() << " thread(s)\n";
+
+    size_t check = 0;
+    auto ms = measure_ms([&] {
+        for (const auto& query : queries) {
+            check += tree.nearest(query);
+        }
+    });
+    report("nearest", queries.size(), ms, check);
+
+    size_t indices[10];
+    check = 0;
+    ms = measure_ms([&] {
+        for (const auto& query : queries) {
+            tree.k_nearest(query, 10, indices);
+            check += indices[9];
+        }
+    });
+    report("k_nearest (k = 10)", queries.size(), ms, check);
+
+    check = 0;
+    ms = measure_ms([&] {
+        for (const auto& query : queries) {
+            check += tree.count_within_radius(query, 5);
+        }
+    });
+    report("count_within_radius (r = 5)", queries.size(), ms, check);
+
+    // A varredura é lenta demais para todas as consultas.
+    size_t scans = 20;
+    check = 0;
+    ms = measure_ms([&] {
+        for (size_t q = 0; q < scans; q++) {
+            size_t best = 0;
+            auto best_distance = points[0].distance(queries[q]);
+            for (size_t i = 1; i < count; i++) {
+                auto distance = points[i].distance(queries[q]);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best = i;
+                }
+            }
+            check += best;
+        }
+    });
+    report("varredura com Point::distance", scans, ms, check);
+    delete built;
+}
+
+int main(int argc, char const* argv[]) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            run(std::strtoull(argv[i], nullptr, 10));
+        }
+    } else {
+        run(1000000);
+        run(10000000);
+    }
+    return 0;
+}
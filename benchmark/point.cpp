@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/point.hpp"
+#include "../include/vector_list.hpp"
+
+/**
+ * Compara a filtragem de pontos por raio com `distance(other) <= radius`,
+ * que calcula uma raiz quadrada por ponto, e com `within(other, radius)`,
+ * que compara os quadrados, e a busca do ponto mais próximo com `distance`
+ * e com `distance_squared`.
+ *
+ * Uso: point_benchmark [pontos] [repeticoes]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, double sqrt_ms, double squared_ms,
+            double check) {
+    std::cout << name << ": com sqrt " << sqrt_ms << " ms, sem sqrt "
+              << squared_ms << " ms (" << sqrt_ms / squared_ms
+              << "x, checagem: " << check << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t repeat = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+    VectorList<Point> points(count);
+    for (size_t i = 0; i < count; i++) {
+        points.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    VectorList<Point> centers(repeat);
+    for (size_t r = 0; r < repeat; r++) {
+        centers.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    std::cout << "pontos = " << count << ", repeticoes = " << repeat << "\n";
+
+    size_t sqrt_found = 0;
+    auto sqrt_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            const auto& center = centers[r];
+            for (size_t i = 0; i < count; i++) {
+                sqrt_found += points[i].distance(center) <= 100;
+            }
+        }
+    });
+    size_t squared_found = 0;
+    auto squared_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            const auto& center = centers[r];
+            for (size_t i = 0; i < count; i++) {
+                squared_found += points[i].within(center, 100);
+            }
+        }
+    });
+    report("filtro por raio", sqrt_ms, squared_ms,
+           static_cast<double>(sqrt_found) - squared_found);
+
+    Point origin;
+    size_t sqrt_best = 0;
+    sqrt_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            auto best = points[0].distance(origin);
+            for (size_t i = 1; i < count; i++) {
+                auto distance = points[i].distance(origin);
+                if (distance < best) {
+                    best = distance;
+                    sqrt_best = i;
+                }
+            }
+        }
+    });
+    size_t squared_best = 0;
+    squared_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            auto best = points[0].distance_squared(origin);
+            for (size_t i = 1; i < count; i++) {
+                auto distance = points[i].distance_squared(origin);
+                if (distance < best) {
+                    best = distance;
+                    squared_best = i;
+                }
+            }
+        }
+    });
+    report("mais proximo", sqrt_ms, squared_ms,
+           static_cast<double>(sqrt_best) - squared_best);
+    return 0;
+}
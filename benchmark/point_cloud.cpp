@@ -0,0 +1,121 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/point_cloud.hpp"
+
+/**
+ * Compara operações sobre todos os pontos em uma VectorList<Point> (um
+ * Point por chamada) e em uma PointCloud (coordenadas em arranjos
+ * separados, com AVX2 quando disponível): distâncias até um ponto,
+ * deslocamento, busca por igualdade e um bloco da matriz de distâncias.
+ *
+ * Uso: point_cloud_benchmark [pontos] [repeticoes]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(const char* name, double list_ms, double cloud_ms, double check) {
+    std::cout << name << ": VectorList " << list_ms << " ms, PointCloud "
+              << cloud_ms << " ms (" << list_ms / cloud_ms
+              << "x, checagem: " << check << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t repeat = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> coordinate(0, 999);
+    VectorList<Point> list(count);
+    for (size_t i = 0; i < count; i++) {
+        list.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    PointCloud cloud(list);
+    std::vector<double> out(count);
+    Point query(500, 500);
+    std::cout << "pontos = " << count << ", repeticoes = " << repeat
+              << ", AVX2 = " << (PointCloud::has_simd() ? "sim" : "nao")
+              << "\n";
+
+    auto list_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = list[i].distance(query);
+            }
+        }
+    });
+    auto list_check = out[count / 2];
+    auto cloud_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            cloud.distances(query, out.data());
+        }
+    });
+    report("distancias", list_ms, cloud_ms, list_check - out[count / 2]);
+
+    list_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            for (size_t i = 0; i < count; i++) {
+                list[i].move(0.5, -0.5);
+            }
+        }
+    });
+    cloud_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            cloud.move_all(0.5, -0.5);
+        }
+    });
+    report("deslocamento", list_ms, cloud_ms,
+           list[count / 2].get_x() - cloud[count / 2].get_x());
+
+    Point target = list[count / 3];
+    size_t list_found = 0;
+    list_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            for (size_t i = 0; i < count; i++) {
+                list_found += list[i].is_equal(target);
+            }
+        }
+    });
+    size_t cloud_found = 0;
+    cloud_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeat; r++) {
+            cloud_found += cloud.count_equal(target);
+        }
+    });
+    report("igualdade", list_ms, cloud_ms,
+           static_cast<double>(list_found) - cloud_found);
+
+    // Bloco 256 x 256 da matriz de distâncias, repetido sobre a nuvem.
+    constexpr size_t tile_size = 256;
+    std::vector<double> tile(tile_size * tile_size);
+    size_t tiles = count / tile_size < 400 ? count / tile_size : 400;
+    list_ms = measure_ms([&] {
+        for (size_t t = 0; t < tiles; t++) {
+            for (size_t i = 0; i < tile_size; i++) {
+                for (size_t j = 0; j < tile_size; j++) {
+                    tile[i * tile_size + j] =
+                        list[t * tile_size + i].distance(list[j]);
+                }
+            }
+        }
+    });
+    list_check = tile[tile_size + 1];
+    cloud_ms = measure_ms([&] {
+        for (size_t t = 0; t < tiles; t++) {
+            cloud.distance_tile(cloud, t * tile_size, tile_size, 0, tile_size,
+                                tile.data());
+        }
+    });
+    report("matriz de distancias", list_ms, cloud_ms,
+           list_check - tile[tile_size + 1]);
+    return 0;
+}
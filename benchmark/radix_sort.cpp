@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/radix_sort.hpp"
+
+/**
+ * Compara `std::sort` com o radix sort em listas de inteiros, de Hours e
+ * de Pair<uint32_t, uint32_t>, com dígitos de 8 e de 11 bits, em uma
+ * thread e em uma por núcleo.
+ *
+ * Uso: radix_sort_benchmark [elementos]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+/**
+ * Ordena cópias da lista com `std::sort` e com cada configuração do radix
+ * sort, conferindo que as chaves ficaram na mesma ordem.
+ */
+template <class T, class Key>
+void compare(const char* name, const VectorList<T>& list, Key key) {
+    auto less = [&](const T& a, const T& b) { return key(a) < key(b); };
+    auto expected = list;
+    auto std_ms = measure_ms([&] {
+        std::sort(&expected[0], &expected[0] + expected.size(), less);
+    });
+    std::cout << name << ": std::sort " << std_ms << " ms\n";
+    for (unsigned bits : {8u, 11u}) {
+        for (unsigned threads : {1u, 0u}) {
+            auto sorted = list;
+            auto radix_ms =
+                measure_ms([&] { radix_sort_by(sorted, key, bits, threads); });
+            size_t mismatches = 0;
+            for (size_t i = 0; i < sorted.size(); i++) {
+                mismatches += key(sorted[i]) != key(expected[i]);
+            }
+            std::cout << "  " << bits << " bits, "
+                      << (threads == 1 ? "1 thread" : "todas as threads")
+                      << ": " << radix_ms << " ms (" << std_ms / radix_ms
+                      << "x, checagem: " << mismatches << ")\n";
+        }
+    }
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    std::cout << "elementos = " << count << "\n";
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> value(INT32_MIN, INT32_MAX);
+    VectorList<int> ints(count);
+    for (size_t i = 0; i < count; i++) {
+        ints.push_back(value(rng));
+    }
+    compare("int", ints, IdentityKey());
+
+    std::uniform_int_distribution<int> hour(0, 23);
+    std::uniform_int_distribution<int> minute(0, 59);
+    VectorList<Hours> times(count);
+    for (size_t i = 0; i < count; i++) {
+        times.push_back(Hours(hour(rng), minute(rng), minute(rng)));
+    }
+    compare("Hours", times, SecondsKey());
+
+    std::uniform_int_distribution<uint32_t> key;
+    VectorList<Pair<uint32_t, uint32_t>> pairs(count);
+    for (size_t i = 0; i < count; i++) {
+        pairs.push_back(
+            Pair<uint32_t, uint32_t>(key(rng), static_cast<uint32_t>(i)));
+    }
+    compare("Pair<uint32_t, uint32_t>", pairs, FirstKey());
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/kd_tree.hpp"
+#include "../include/space_filling_curve.hpp"
+#include "../include/spatial_grid.hpp"
+
+/**
+ * Mede varreduras e consultas de vizinhança, feitas na ordem em que os
+ * pontos estão guardados, antes e depois de reordená-los pelas curvas de
+ * Morton e de Hilbert: para cada ponto, os vizinhos em uma SpatialGrid
+ * (lendo um atributo de cada vizinho por índice) e a contagem por raio em
+ * uma KdTree.
+ *
+ * Uso: space_filling_curve_benchmark [pontos] [raio]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+constexpr double side = 100000;
+
+/**
+ * @brief Mede as consultas sobre `points`, na ordem da lista.
+ */
+void run(const char* name, const VectorList<Point>& points, double radius,
+         double sort_ms) {
+    auto count = points.size();
+    std::vector<double> attributes(count);
+    for (size_t i = 0; i < count; i++) {
+        attributes[i] = points[i].get_x() - points[i].get_y();
+    }
+    SpatialGrid<uint32_t> grid(radius, count / 2);
+    for (size_t i = 0; i < count; i++) {
+        grid.insert(points[i], static_cast<uint32_t>(i));
+    }
+    KdTree tree(points);
+
+    double total = 0;
+    auto grid_ms = measure_ms([&] {
+        for (size_t i = 0; i < count; i++) {
+            grid.for_each_within(points[i], radius,
+                                 [&](const Point&, uint32_t index) {
+                                     total += attributes[index];
+                                 });
+        }
+    });
+    size_t found = 0;
+    auto tree_ms = measure_ms([&] {
+        for (size_t i = 0; i < count; i++) {
+            found += tree.count_within_radius(points[i], radius);
+        }
+    });
+    std::cout << name << ": ordenacao " << sort_ms << " ms, grade "
+              << grid_ms << " ms, kd-tree " << tree_ms
+              << " ms (checagem: " << total << ", " << found << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    double radius = argc > 2 ? std::strtod(argv[2], nullptr) : 100;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coordinate(0, side);
+    VectorList<Point> points(count);
+    for (size_t i = 0; i < count; i++) {
+        points.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    std::cout << "pontos = " << count << ", raio = " << radius << "\n";
+    run("original", points, radius, 0);
+
+    VectorList<Point> morton = points;
+    auto sort_ms = measure_ms([&] { sort_by_curve(morton, Curve::morton); });
+    run("Morton", morton, radius, sort_ms);
+
+    VectorList<Point> hilbert = points;
+    sort_ms = measure_ms([&] { sort_by_curve(hilbert, Curve::hilbert); });
+    run("Hilbert", hilbert, radius, sort_ms);
+    return 0;
+}
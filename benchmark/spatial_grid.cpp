@@ -0,0 +1,116 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../include/kd_tree.hpp"
+#include "../include/spatial_grid.hpp"
+
+/**
+ * Simula pontos que se movem a cada passo e consultam a vizinhança:
+ * compara reconstruir uma KdTree a cada passo com atualizar uma
+ * SpatialGrid, com uma thread e com uma por núcleo.
+ *
+ * Uso: spatial_grid_benchmark [pontos] [passos] [consultas por passo]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+constexpr double side = 10000;
+constexpr double radius = 10;
+
+/// Deslocamento determinístico de cada ponto, que depende do passo.
+double step_of(size_t id, size_t step) {
+    return static_cast<double>((id * 7 + step * 13) % 11) - 5;
+}
+
+void run_grid(const std::vector<Point>& start, size_t steps, size_t queries,
+              unsigned threads) {
+    SpatialGrid<uint32_t> grid(radius, start.size() / 4);
+    for (size_t i = 0; i < start.size(); i++) {
+        grid.insert(start[i], static_cast<uint32_t>(i));
+    }
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> coordinate(0, side);
+    size_t found = 0;
+    double update_ms = 0;
+    double query_ms = 0;
+    for (size_t step = 0; step < steps; step++) {
+        update_ms += measure_ms([&] {
+            grid.update(
+                [step](Point& point, uint32_t& id) {
+                    point.move(step_of(id, step), step_of(id + 1, step));
+                },
+                threads);
+        });
+        query_ms += measure_ms([&] {
+            for (size_t q = 0; q < queries; q++) {
+                found += grid.for_each_within(
+                    Point(coordinate(rng), coordinate(rng)), radius,
+                    [](const Point&, uint32_t) {});
+            }
+        });
+    }
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    std::cout << "SpatialGrid, " << threads << " thread(s): atualizacao "
+              << update_ms / steps << " ms/passo, consultas "
+              << query_ms / steps << " ms/passo (checagem: " << found << ")\n";
+}
+
+void run_kd_tree(const std::vector<Point>& start, size_t steps,
+                 size_t queries) {
+    auto points = start;
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> coordinate(0, side);
+    size_t found = 0;
+    double update_ms = 0;
+    double query_ms = 0;
+    for (size_t step = 0; step < steps; step++) {
+        KdTree* tree = nullptr;
+        update_ms += measure_ms([&] {
+            for (size_t i = 0; i < points.size(); i++) {
+                points[i].move(step_of(i, step), step_of(i + 1, step));
+            }
+            tree = new KdTree(points.data(), points.data() + points.size());
+        });
+        query_ms += measure_ms([&] {
+            for (size_t q = 0; q < queries; q++) {
+                found += tree->count_within_radius(
+                    Point(coordinate(rng), coordinate(rng)), radius);
+            }
+        });
+        delete tree;
+    }
+    std::cout << "KdTree reconstruida: atualizacao " << update_ms / steps
+              << " ms/passo, consultas " << query_ms / steps
+              << " ms/passo (checagem: " << found << ")\n";
+}
+
+int main(int argc, char const* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t steps = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+    size_t queries = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10000;
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> coordinate(0, side);
+    std::vector<Point> start;
+    for (size_t i = 0; i < count; i++) {
+        start.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    std::cout << "pontos = " << count << ", passos = " << steps
+              << ", consultas por passo = " << queries << "\n";
+    run_kd_tree(start, steps, queries);
+    run_grid(start, steps, queries, 1);
+    run_grid(start, steps, queries, 0);
+    return 0;
+}
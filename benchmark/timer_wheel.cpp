@@ -0,0 +1,139 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../include/doubly_linked_list.hpp"
+#include "../include/timer_wheel.hpp"
+
+/**
+ * Mede a TimerWheel com muitos temporizadores armados e alta taxa de
+ * cancelamento: agenda `n` temporizadores com prazos uniformes nas próximas
+ * duas horas, cancela uma fração deles e avança o relógio até o último
+ * prazo. Para comparação, faz o mesmo com uma DoublyLinkedList percorrida a
+ * cada segundo, com menos temporizadores (a varredura é O(n) por segundo).
+ *
+ * Uso: timer_wheel_benchmark [n] [fracao cancelada] [n da lista]
+ */
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+/// Temporizador da lista usada como referência.
+struct Pending {
+    uint64_t deadline;
+    uint32_t id;
+};
+
+void report(const char* name, size_t n, size_t cancels, size_t expired,
+            uint64_t checksum, double schedule_ms, double cancel_ms,
+            double advance_ms) {
+    std::cout << name << " (" << n << " temporizadores):\n"
+              << "  agendar: " << schedule_ms << " ms ("
+              << schedule_ms * 1e6 / n << " ns/op)\n"
+              << "  cancelar: " << cancel_ms << " ms ("
+              << (cancels ? cancel_ms * 1e6 / cancels : 0) << " ns/op)\n"
+              << "  avancar: " << advance_ms << " ms (" << expired
+              << " vencidos, checagem: " << checksum << ")\n";
+}
+
+void run_wheel(const std::vector<uint64_t>& deadlines,
+               const std::vector<bool>& cancelled, uint64_t horizon) {
+    TimerWheel<uint32_t> wheel;
+    wheel.reserve(deadlines.size());
+    std::vector<TimerWheel<uint32_t>::Handle> handles(deadlines.size());
+
+    auto schedule_ms = measure_ms([&] {
+        for (size_t i = 0; i < deadlines.size(); i++) {
+            handles[i] = wheel.schedule(deadlines[i], static_cast<uint32_t>(i));
+        }
+    });
+    size_t cancels = 0;
+    auto cancel_ms = measure_ms([&] {
+        for (size_t i = 0; i < deadlines.size(); i++) {
+            if (cancelled[i]) {
+                cancels += wheel.cancel(handles[i]);
+            }
+        }
+    });
+    size_t expired = 0;
+    uint64_t checksum = 0;
+    auto advance_ms = measure_ms([&] {
+        expired = wheel.advance(horizon, [&](uint32_t id) { checksum += id; });
+    });
+    report("TimerWheel", deadlines.size(), cancels, expired, checksum,
+           schedule_ms, cancel_ms, advance_ms);
+}
+
+void run_list(const std::vector<uint64_t>& deadlines,
+              const std::vector<bool>& cancelled, uint64_t horizon) {
+    DoublyLinkedList<Pending> list;
+    std::vector<DoublyLinkedList<Pending>::iterator> handles(deadlines.size());
+
+    auto schedule_ms = measure_ms([&] {
+        for (size_t i = 0; i < deadlines.size(); i++) {
+            list.push_back(Pending{deadlines[i], static_cast<uint32_t>(i)});
+            handles[i] = --list.end();
+        }
+    });
+    size_t cancels = 0;
+    auto cancel_ms = measure_ms([&] {
+        for (size_t i = 0; i < deadlines.size(); i++) {
+            if (cancelled[i]) {
+                list.erase(handles[i], handles[i] + 1);
+                cancels++;
+            }
+        }
+    });
+    size_t expired = 0;
+    uint64_t checksum = 0;
+    auto advance_ms = measure_ms([&] {
+        for (uint64_t now = 1; now <= horizon && !list.empty(); now++) {
+            for (auto it = list.begin(); it != list.end();) {
+                if (it->deadline <= now) {
+                    checksum += it->id;
+                    expired++;
+                    auto next = it + 1;
+                    list.erase(it, next);
+                    it = next;
+                } else {
+                    ++it;
+                }
+            }
+        }
+    });
+    report("DoublyLinkedList", deadlines.size(), cancels, expired, checksum,
+           schedule_ms, cancel_ms, advance_ms);
+}
+
+int main(int argc, char const* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    double cancel_rate = argc > 2 ? std::strtod(argv[2], nullptr) : 0.9;
+    size_t list_n = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : n / 100;
+
+    const uint64_t horizon = Hours(2, 0, 0).to_seconds();
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<uint64_t> deadline(1, horizon);
+    std::bernoulli_distribution cancel(cancel_rate);
+
+    std::vector<uint64_t> deadlines(n);
+    std::vector<bool> cancelled(n);
+    for (size_t i = 0; i < n; i++) {
+        deadlines[i] = deadline(rng);
+        cancelled[i] = cancel(rng);
+    }
+
+    std::cout << "taxa de cancelamento = " << cancel_rate << "\n";
+    run_wheel(deadlines, cancelled, horizon);
+    deadlines.resize(list_n);
+    cancelled.resize(list_n);
+    run_list(deadlines, cancelled, horizon);
+    return 0;
+}
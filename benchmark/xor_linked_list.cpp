@@ -0,0 +1,85 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "../include/doubly_linked_list.hpp"
+#include "../include/xor_linked_list.hpp"
+
+/**
+ * Compara a XorLinkedList com a DoublyLinkedList quanto à memória alocada e
+ * ao tempo de construção e de travessia nos dois sentidos.
+ *
+ * Uso: xor_linked_list_benchmark [n]
+ */
+
+static size_t allocated_bytes = 0;
+
+void* operator new(size_t size) {
+    allocated_bytes += size;
+    if (auto ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+template <class F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <class List>
+void run(const char* name, size_t n) {
+    long long sum = 0;
+    auto before = allocated_bytes;
+    auto list = new List();
+
+    auto build = measure_ms([&] {
+        for (size_t i = 0; i < n; i++) {
+            list->push_back(static_cast<int>(i));
+        }
+    });
+    auto bytes = allocated_bytes - before;
+
+    auto forward = measure_ms([&] {
+        for (auto it = list->begin(); it != list->end(); ++it) {
+            sum += *it;
+        }
+    });
+
+    auto backward = measure_ms([&] {
+        auto it = list->end();
+        while (it != list->begin()) {
+            --it;
+            sum -= *it;
+        }
+    });
+
+    std::cout << name << ":\n"
+              << "  bytes por elemento: " << double(bytes) / n << "\n"
+              << "  construcao: " << build << " ms\n"
+              << "  travessia direta: " << forward << " ms\n"
+              << "  travessia reversa: " << backward << " ms\n"
+              << "  (checagem: " << sum << ")\n";
+
+    delete list;
+}
+
+int main(int argc, char const* argv[]) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    std::cout << "n = " << n << "\n";
+    run<DoublyLinkedList<int>>("DoublyLinkedList<int>", n);
+    run<XorLinkedList<int>>("XorLinkedList<int>", n);
+    return 0;
+}
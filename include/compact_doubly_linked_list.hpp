@@ -0,0 +1,329 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class CompactDoublyLinkedList
+ * @brief Representa uma lista duplamente encadeada compacta de elementos do
+ * tipo genérico T.
+ *
+ * Esta classe oferece a mesma interface da DoublyLinkedList, mas armazena
+ * todos os nós em um único arranjo contíguo que cresce conforme a
+ * necessidade. Os nós são ligados por índices de 32 bits em vez de
+ * ponteiros, e os nós removidos são reaproveitados por meio de uma lista
+ * interna de nós livres. Para `T = int`, cada nó ocupa 12 bytes, contra os
+ * 24 bytes (mais o custo do alocador) de um nó da DoublyLinkedList.
+ *
+ * @tparam T Tipo dos elementos armazenados na lista.
+ */
+template <class T>
+class CompactDoublyLinkedList {
+ private:
+  /**
+   * @brief Estrutura que representa um nó no arranjo.
+   */
+  struct Node {
+    T value;       ///< Valor armazenado no nó.
+    uint32_t next; ///< Índice do próximo nó (ou `npos`).
+    uint32_t prev; ///< Índice do nó anterior (ou `npos`).
+  };
+
+  static constexpr uint32_t npos = UINT32_MAX; ///< Índice nulo.
+
+ public:
+  /**
+   * @brief Iterador da lista duplamente encadeada compacta.
+   *
+   * Permite a navegação e manipulação dos elementos da lista.
+   *
+   * @tparam L Tipo da lista (constante ou não).
+   */
+  template <class L>
+  class Iterator {
+   public:
+    /**
+     * @brief Desreferencia o iterador.
+     * @return Referência ao valor armazenado no nó atual.
+     */
+    auto &operator*() const;
+
+    /**
+     * @brief Incrementa o iterador para o próximo nó.
+     * @return Referência ao iterador atualizado.
+     */
+    Iterator<L> &operator++();
+
+    /**
+     * @brief Decrementa o iterador para o nó anterior.
+     * @return Referência ao iterador atualizado.
+     */
+    Iterator<L> &operator--();
+
+    /**
+     * @brief Compara dois iteradores para verificar se são iguais.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem iguais, falso caso
+     * contrário.
+     */
+    bool operator==(const Iterator<L> &other) const;
+
+    /**
+     * @brief Compara dois iteradores para verificar se são diferentes.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem diferentes, falso caso
+     * contrário.
+     */
+    bool operator!=(const Iterator<L> &other) const;
+
+    /**
+     * @brief Retorna um iterador avançado por um número específico de
+     * posições.
+     * @param offset Número de posições para avançar.
+     * @return Novo iterador avançado.
+     */
+    Iterator<L> operator+(size_t offset) const;
+
+    /**
+     * @brief Retorna um iterador retrocedido por um número específico de
+     * posições.
+     * @param offset Número de posições para retroceder.
+     * @return Novo iterador retrocedido.
+     */
+    Iterator<L> operator-(size_t offset) const;
+
+    /**
+     * @brief Calcula a distância entre dois iteradores.
+     * @param other Outro iterador para calcular a distância.
+     * @return Distância entre os dois iteradores.
+     */
+    size_t operator-(const Iterator<L> other) const;
+
+   private:
+    /**
+     * @brief Construtor do iterador.
+     * @param list Lista percorrida.
+     * @param index Índice do nó no arranjo (ou `npos` para o final).
+     */
+    Iterator(L *list, uint32_t index);
+
+    L *list;        ///< Lista percorrida.
+    uint32_t index; ///< Índice do nó no arranjo.
+
+    friend class CompactDoublyLinkedList;
+  };
+
+  using iterator =
+      CompactDoublyLinkedList<T>::Iterator<CompactDoublyLinkedList<T>>;
+  using const_iterator =
+      CompactDoublyLinkedList<T>::Iterator<const CompactDoublyLinkedList<T>>;
+
+  /**
+   * @brief Construtor padrão da lista duplamente encadeada compacta.
+   */
+  CompactDoublyLinkedList();
+
+  /**
+   * @brief Construtor de cópia da lista duplamente encadeada compacta.
+   * @param list Lista a ser copiada.
+   */
+  CompactDoublyLinkedList(const CompactDoublyLinkedList &list);
+
+  /**
+   * @brief Operador de atribuição para copiar uma lista.
+   * @param list Lista a ser atribuída.
+   * @return Referência para a lista atual.
+   */
+  CompactDoublyLinkedList &operator=(const CompactDoublyLinkedList &list);
+
+  /**
+   * @brief Destruidor da lista. Libera o arranjo de nós.
+   */
+  ~CompactDoublyLinkedList();
+
+  /**
+   * @brief Obtém o tamanho da lista.
+   * @return Número de elementos na lista.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a lista está vazia.
+   * @return Verdadeiro se a lista estiver vazia, falso caso contrário.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna quantos nós cabem no arranjo sem realocar.
+   * @return A capacidade do arranjo de nós.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Garante espaço para pelo menos `capacity` nós sem realocar.
+   * @param capacity A capacidade desejada.
+   * @throw std::length_error Se a capacidade exceder o limite de índices de
+   * 32 bits.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Retorna a memória, em bytes, ocupada pelo arranjo de nós.
+   * @return O número de bytes alocados para os nós.
+   */
+  size_t memory_usage() const;
+
+  /**
+   * @brief Retorna a memória, em bytes, ocupada por um único nó.
+   * @return O tamanho de um nó no arranjo.
+   */
+  static constexpr size_t node_bytes() { return sizeof(Node); }
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o início da lista.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna um iterador para o final da lista (após o último nó).
+   * @return Iterador para o final da lista.
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o início da lista.
+   */
+  iterator begin();
+
+  /**
+   * @brief Retorna um iterador para o final da lista (após o último nó).
+   * @return Iterador para o final da lista.
+   */
+  iterator end();
+
+  /**
+   * @brief Adiciona um elemento ao início da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_front(const T &value);
+
+  /**
+   * @brief Adiciona um elemento ao final da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_back(const T &value);
+
+  /**
+   * @brief Insere um elemento antes da posição indicada.
+   * @param pos Iterador apontando para a posição de inserção.
+   * @param value Valor a ser inserido.
+   */
+  void insert(iterator pos, const T &value);
+
+  /**
+   * @brief Remove o primeiro elemento da lista.
+   *
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o último elemento da lista.
+   *
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  void pop_back();
+
+  /**
+   * @brief Remove uma faixa de elementos da lista, definida pelos iteradores.
+   * @param first Iterador apontando para o primeiro elemento a ser removido.
+   * @param last Iterador apontando após o último elemento a ser removido.
+   */
+  void erase(iterator first, iterator last);
+
+  /**
+   * @brief Remove todos os elementos da lista, mantendo a capacidade. Os
+   * valores removidos são descartados na hora.
+   */
+  void clear();
+
+  /**
+   * @brief Encontra um item na lista e retorna um iterador para ele.
+   * @param item Valor a ser procurado.
+   * @return Iterador apontando para o item encontrado, ou `end()` caso o item
+   * não seja encontrado.
+   */
+  const_iterator find(const T &item) const;
+
+  /**
+   * @brief Encontra um item na lista e retorna um iterador para ele.
+   * @param item Valor a ser procurado.
+   * @return Iterador apontando para o item encontrado, ou `end()` caso o item
+   * não seja encontrado.
+   */
+  iterator find(const T &item);
+
+  /**
+   * @brief Verifica se um item existe na lista.
+   * @param item Valor a ser verificado.
+   * @return Verdadeiro se o item estiver presente na lista, falso caso
+   * contrário.
+   */
+  bool contains(const T &item) const;
+
+  /**
+   * @brief Acessa um elemento por seu índice.
+   * @param index Índice do elemento.
+   * @return Referência ao valor no índice fornecido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  T &operator[](size_t index);
+
+  /**
+   * @brief Acessa um elemento por seu índice.
+   * @param index Índice do elemento.
+   * @return Referência constante ao valor no índice fornecido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  const T &operator[](size_t index) const;
+
+  /**
+   * @brief Imprime os elementos da lista.
+   */
+  void print() const;
+
+ private:
+  /**
+   * @brief Obtém um nó livre, reaproveitando nós removidos ou crescendo o
+   * arranjo. `value` pode ser um elemento da própria lista.
+   * @param value O valor a ser armazenado no nó.
+   * @return O índice do nó alocado.
+   */
+  uint32_t allocate_node(const T &value);
+
+  /**
+   * @brief Devolve um nó para a lista de nós livres, substituindo o seu
+   * valor por `T()`.
+   * @param index O índice do nó liberado.
+   */
+  void release_node(uint32_t index);
+
+  /**
+   * @brief Localiza o índice, no arranjo, do nó na posição especificada,
+   * partindo da extremidade mais próxima.
+   * @param index A posição do nó na lista (deve ser menor que `size()`).
+   * @return O índice do nó no arranjo.
+   */
+  uint32_t node_at(size_t index) const;
+
+  Node *nodes;        ///< Arranjo contíguo de nós.
+  uint32_t head;      ///< Índice do primeiro nó (ou `npos`).
+  uint32_t tail;      ///< Índice do último nó (ou `npos`).
+  uint32_t free_head; ///< Índice do primeiro nó livre (ou `npos`).
+  uint32_t used;      ///< Quantidade de posições do arranjo já usadas.
+  size_t _size;       ///< Número de elementos da lista.
+  size_t _capacity;   ///< Capacidade do arranjo de nós.
+};
+
+#include "../src/compact_doubly_linked_list.hpp"
@@ -0,0 +1,303 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class CompactLinkedList
+ * @brief Representa uma lista encadeada compacta de elementos do tipo
+ * genérico T.
+ *
+ * A classe CompactLinkedList oferece a mesma interface da LinkedList, mas
+ * armazena todos os nós em um único arranjo contíguo que cresce conforme a
+ * necessidade. Os nós são ligados por índices de 32 bits em vez de
+ * ponteiros, e os nós removidos são reaproveitados por meio de uma lista
+ * interna de nós livres. Isso reduz o consumo de memória por nó e mantém os
+ * nós próximos uns dos outros na memória.
+ *
+ * @tparam T Tipo dos elementos armazenados na lista.
+ */
+template <class T>
+class CompactLinkedList {
+  /**
+   * @struct Node
+   * @brief Estrutura interna que representa um nó no arranjo.
+   */
+  struct Node {
+    T value;       /**< Valor armazenado no nó. */
+    uint32_t next; /**< Índice do próximo nó (ou `npos`). */
+  };
+
+  static constexpr uint32_t npos = UINT32_MAX; /**< Índice nulo. */
+
+ public:
+  /**
+   * @brief Iterador da lista encadeada compacta.
+   *
+   * Permite percorrer os elementos do início ao fim da lista.
+   *
+   * @tparam L Tipo da lista (constante ou não).
+   */
+  template <class L>
+  class Iterator {
+   public:
+    /**
+     * @brief Desreferencia o iterador.
+     * @return Referência ao valor armazenado no nó atual.
+     */
+    auto &operator*() const;
+
+    /**
+     * @brief Incrementa o iterador para o próximo nó.
+     * @return Referência ao iterador atualizado.
+     */
+    Iterator<L> &operator++();
+
+    /**
+     * @brief Compara dois iteradores para verificar se são iguais.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem iguais, falso caso
+     * contrário.
+     */
+    bool operator==(const Iterator<L> &other) const;
+
+    /**
+     * @brief Compara dois iteradores para verificar se são diferentes.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem diferentes, falso caso
+     * contrário.
+     */
+    bool operator!=(const Iterator<L> &other) const;
+
+   private:
+    /**
+     * @brief Construtor do iterador.
+     * @param list Lista percorrida.
+     * @param index Índice do nó no arranjo (ou `npos` para o final).
+     */
+    Iterator(L *list, uint32_t index);
+
+    L *list;        ///< Lista percorrida.
+    uint32_t index; ///< Índice do nó no arranjo.
+
+    friend class CompactLinkedList;
+  };
+
+  using iterator = CompactLinkedList<T>::Iterator<CompactLinkedList<T>>;
+  using const_iterator =
+      CompactLinkedList<T>::Iterator<const CompactLinkedList<T>>;
+
+  /**
+   * @brief Construtor da lista. Cria uma lista vazia.
+   */
+  CompactLinkedList();
+
+  /**
+   * @brief Destruidor da lista. Libera o arranjo de nós.
+   */
+  ~CompactLinkedList();
+
+  /**
+   * @brief Construtor de cópia. Cria uma nova lista como uma cópia de outra.
+   *
+   * @param list A lista a ser copiada.
+   */
+  CompactLinkedList(const CompactLinkedList &list);
+
+  /**
+   * @brief Operador de atribuição. Atribui os elementos de uma lista a outra.
+   *
+   * @param list A lista a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  CompactLinkedList &operator=(const CompactLinkedList &list);
+
+  /**
+   * @brief Retorna o número de elementos armazenados na lista.
+   *
+   * @return O tamanho atual da lista.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a lista está vazia.
+   *
+   * @return Verdadeiro se a lista estiver vazia, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna quantos nós cabem no arranjo sem realocar.
+   *
+   * @return A capacidade do arranjo de nós.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Garante espaço para pelo menos `capacity` nós sem realocar.
+   *
+   * @param capacity A capacidade desejada.
+   * @throw std::length_error Se a capacidade exceder o limite de índices de
+   * 32 bits.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Retorna a memória, em bytes, ocupada pelo arranjo de nós.
+   *
+   * @return O número de bytes alocados para os nós.
+   */
+  size_t memory_usage() const;
+
+  /**
+   * @brief Retorna a memória, em bytes, ocupada por um único nó.
+   *
+   * @return O tamanho de um nó no arranjo.
+   */
+  static constexpr size_t node_bytes() { return sizeof(Node); }
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o primeiro elemento.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna um iterador para o final da lista.
+   * @return Iterador para após o último elemento.
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o primeiro elemento.
+   */
+  iterator begin();
+
+  /**
+   * @brief Retorna um iterador para o final da lista.
+   * @return Iterador para após o último elemento.
+   */
+  iterator end();
+
+  /**
+   * @brief Adiciona um elemento no início da lista.
+   *
+   * @param value O valor do elemento a ser adicionado.
+   */
+  void push_front(const T &value);
+
+  /**
+   * @brief Insere um elemento na posição especificada.
+   *
+   * @param index O índice onde o elemento será inserido.
+   * @param value O valor do elemento a ser inserido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void insert(size_t index, const T &value);
+
+  /**
+   * @brief Remove o primeiro elemento da lista.
+   *
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o elemento na posição especificada.
+   *
+   * @param index O índice do elemento a ser removido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void remove(size_t index);
+
+  /**
+   * @brief Limpa todos os elementos da lista, mantendo a capacidade. Os
+   * valores removidos são descartados na hora.
+   */
+  void clear();
+
+  /**
+   * @brief Encontra um elemento na lista.
+   *
+   * @param item O elemento a ser buscado.
+   * @return A referência para o valor encontrado.
+   * @throw std::out_of_range Se o elemento não for encontrado.
+   */
+  T &find(const T &item);
+
+  /**
+   * @brief Encontra um elemento na lista (const).
+   *
+   * @param item O elemento a ser buscado.
+   * @return A referência constante para o valor encontrado.
+   * @throw std::out_of_range Se o elemento não for encontrado.
+   */
+  const T &find(const T &item) const;
+
+  /**
+   * @brief Verifica se um elemento está contido na lista.
+   *
+   * @param item O elemento a ser verificado.
+   * @return Verdadeiro se o elemento estiver na lista, caso contrário falso.
+   */
+  bool contains(const T &item) const;
+
+  /**
+   * @brief Acesso ao elemento na posição especificada.
+   *
+   * @param index O índice do elemento.
+   * @return A referência para o elemento no índice especificado.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  T &operator[](size_t index);
+
+  /**
+   * @brief Acesso ao elemento na posição especificada (const).
+   *
+   * @param index O índice do elemento.
+   * @return A referência constante para o elemento no índice especificado.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  const T &operator[](size_t index) const;
+
+  /**
+   * @brief Imprime os elementos da lista no formato "valor1 -> valor2 -> ...
+   * -> NULL".
+   */
+  void print() const;
+
+ private:
+  /**
+   * @brief Obtém um nó livre, reaproveitando nós removidos ou crescendo o
+   * arranjo. `value` pode ser um elemento da própria lista.
+   *
+   * @param value O valor a ser armazenado no nó.
+   * @return O índice do nó alocado.
+   */
+  uint32_t allocate_node(const T &value);
+
+  /**
+   * @brief Devolve um nó para a lista de nós livres, substituindo o seu
+   * valor por `T()`.
+   *
+   * @param index O índice do nó liberado.
+   */
+  void release_node(uint32_t index);
+
+  /**
+   * @brief Localiza o índice, no arranjo, do nó na posição especificada.
+   *
+   * @param index A posição do nó na lista (deve ser menor que `size()`).
+   * @return O índice do nó no arranjo.
+   */
+  uint32_t node_at(size_t index) const;
+
+  Node *nodes;        /**< Arranjo contíguo de nós. */
+  uint32_t head;      /**< Índice do primeiro nó da lista. */
+  uint32_t free_head; /**< Índice do primeiro nó livre. */
+  uint32_t used;      /**< Quantidade de posições do arranjo já usadas. */
+  size_t _size;       /**< Tamanho da lista. */
+  size_t _capacity;   /**< Capacidade do arranjo de nós. */
+};
+
+#include "../src/compact_linked_list.hpp"
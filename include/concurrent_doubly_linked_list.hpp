@@ -0,0 +1,221 @@
+#pragma once
+#include <stddef.h>
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * @class ConcurrentDoublyLinkedList
+ * @brief Lista duplamente encadeada que pode ser usada por várias threads ao
+ * mesmo tempo.
+ *
+ * Em vez de uma única trava para a lista inteira, cada nó tem a sua própria
+ * trava, e as operações travam apenas os nós que vão religar. A travessia usa
+ * travamento mão sobre mão: o cursor mantém travados o nó anterior e o nó
+ * atual e, para avançar, trava o próximo antes de soltar o anterior. Assim,
+ * threads diferentes podem inserir e remover em regiões diferentes da lista
+ * simultaneamente.
+ *
+ * As travas são sempre adquiridas no sentido do início para o fim. A única
+ * exceção é `push_back`, que trava o sentinela final e depois *tenta* travar
+ * o nó anterior, desistindo e recomeçando se ele estiver ocupado; por isso
+ * nenhuma operação pode ficar em impasse.
+ *
+ * Como remover um nó exige travar o seu anterior, nenhum nó é liberado
+ * enquanto outra thread o alcança, e a memória pode ser devolvida
+ * imediatamente.
+ *
+ * @tparam T Tipo dos elementos armazenados na lista.
+ */
+template <class T>
+class ConcurrentDoublyLinkedList {
+ private:
+  /**
+   * @brief Estrutura com as ligações e a trava de um nó, usada também pelos
+   * sentinelas.
+   */
+  struct Link {
+    Link *next;       ///< Ponteiro para o próximo nó na lista.
+    Link *prev;       ///< Ponteiro para o nó anterior na lista.
+    std::mutex lock;  ///< Trava do nó.
+  };
+
+  /**
+   * @brief Estrutura que representa um nó da lista.
+   */
+  struct Node : Link {
+    /**
+     * @brief Construtor do nó.
+     * @param value Valor do nó a ser armazenado.
+     */
+    Node(const T &value);
+
+    T value;  ///< Valor armazenado no nó.
+  };
+
+ public:
+  /**
+   * @brief Cursor para percorrer e modificar a lista com segurança.
+   *
+   * O cursor mantém travados o nó atual e o nó anterior a ele, de modo que
+   * nenhuma outra thread pode alterar essa região enquanto o cursor existir.
+   * Enquanto um cursor estiver vivo, a mesma thread só deve alterar a lista
+   * por meio dele (`insert` e `erase` com o cursor), pois as demais
+   * operações podem precisar das travas que ele mantém.
+   */
+  class Cursor {
+   public:
+    /**
+     * @brief Construtor de movimento.
+     * @param other Cursor cujas travas passam a pertencer a este.
+     */
+    Cursor(Cursor &&other);
+
+    /**
+     * @brief Destruidor. Solta as travas mantidas pelo cursor.
+     */
+    ~Cursor();
+
+    Cursor(const Cursor &) = delete;
+    Cursor &operator=(const Cursor &) = delete;
+    Cursor &operator=(Cursor &&) = delete;
+
+    /**
+     * @brief Verifica se o cursor aponta para um elemento.
+     * @return Falso se o cursor chegou ao final da lista.
+     */
+    bool valid() const;
+
+    /**
+     * @brief Acessa o elemento atual.
+     * @return Referência ao valor do nó atual.
+     */
+    T &operator*() const;
+
+    /**
+     * @brief Avança o cursor para o próximo elemento.
+     * @return Referência ao cursor atualizado.
+     */
+    Cursor &operator++();
+
+   private:
+    /**
+     * @brief Construtor do cursor. As travas de `prev` e `node` já devem
+     * estar adquiridas.
+     * @param list Lista percorrida.
+     * @param prev Nó anterior ao atual.
+     * @param node Nó atual.
+     */
+    Cursor(ConcurrentDoublyLinkedList *list, Link *prev, Link *node);
+
+    ConcurrentDoublyLinkedList *list;  ///< Lista percorrida.
+    Link *prev;  ///< Nó anterior ao atual (travado).
+    Link *node;  ///< Nó atual (travado).
+
+    friend class ConcurrentDoublyLinkedList;
+  };
+
+  /**
+   * @brief Construtor padrão. Cria uma lista vazia.
+   */
+  ConcurrentDoublyLinkedList();
+
+  /**
+   * @brief Destruidor. Desaloca todos os nós.
+   *
+   * Nenhuma outra thread pode estar usando a lista durante a destruição.
+   */
+  ~ConcurrentDoublyLinkedList();
+
+  ConcurrentDoublyLinkedList(const ConcurrentDoublyLinkedList &) = delete;
+  ConcurrentDoublyLinkedList &operator=(const ConcurrentDoublyLinkedList &) =
+      delete;
+
+  /**
+   * @brief Obtém o tamanho da lista.
+   * @return Número de elementos na lista no momento da leitura.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a lista está vazia.
+   * @return Verdadeiro se a lista estiver vazia no momento da leitura.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna um cursor para o primeiro elemento.
+   * @return Cursor travando o sentinela inicial e o primeiro nó.
+   */
+  Cursor begin();
+
+  /**
+   * @brief Adiciona um elemento ao início da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_front(const T &value);
+
+  /**
+   * @brief Adiciona um elemento ao final da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_back(const T &value);
+
+  /**
+   * @brief Insere um elemento antes da posição do cursor.
+   *
+   * O cursor continua apontando para o mesmo elemento.
+   *
+   * @param pos Cursor apontando para a posição de inserção (pode estar no
+   * final da lista).
+   * @param value Valor a ser inserido.
+   */
+  void insert(Cursor &pos, const T &value);
+
+  /**
+   * @brief Remove o elemento apontado pelo cursor.
+   *
+   * O cursor passa a apontar para o elemento seguinte.
+   *
+   * @param pos Cursor apontando para o elemento a ser removido.
+   * @throw std::out_of_range Se o cursor estiver no final da lista.
+   */
+  void erase(Cursor &pos);
+
+  /**
+   * @brief Remove a primeira ocorrência de um valor.
+   * @param item Valor a ser removido.
+   * @return Verdadeiro se o valor foi encontrado e removido.
+   */
+  bool erase(const T &item);
+
+  /**
+   * @brief Encontra um item na lista e retorna um cursor para ele.
+   * @param item Valor a ser procurado.
+   * @return Cursor apontando para o item, ou inválido se o item não for
+   * encontrado.
+   */
+  Cursor find(const T &item);
+
+  /**
+   * @brief Verifica se um item existe na lista.
+   * @param item Valor a ser verificado.
+   * @return Verdadeiro se o item estiver presente na lista.
+   */
+  bool contains(const T &item);
+
+  /**
+   * @brief Aplica uma função a cada elemento, do início ao fim, com
+   * travamento mão sobre mão.
+   * @param f Função chamada com uma referência para cada elemento.
+   */
+  template <class F>
+  void for_each(F f);
+
+ private:
+  Link head;  ///< Sentinela antes do primeiro nó.
+  Link tail;  ///< Sentinela após o último nó.
+  std::atomic<size_t> _size;  ///< Número de elementos da lista.
+};
+
+#include "../src/concurrent_doubly_linked_list.hpp"
@@ -1,6 +1,10 @@
 #pragma once
 #include <stddef.h>
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
 /**
  * @class DoublyLinkedList
  * @brief Representa uma lista duplamente encadeada de elementos do tipo
@@ -9,46 +13,78 @@
  * Esta classe implementa uma lista duplamente encadeada genérica, com
  * métodos para manipulação de elementos, incluindo inserção, remoção,
  * busca e iteração sobre os elementos da lista.
+ *
+ * A lista é circular e possui um nó sentinela, que fica entre o último e o
+ * primeiro elemento. Dessa forma, nenhum nó tem vizinhos nulos, `end()`
+ * aponta para o sentinela e as operações de ligação não precisam tratar os
+ * casos de lista vazia, início ou fim separadamente.
  */
 template <class T>
 class DoublyLinkedList {
  private:
+  /**
+   * @brief Estrutura com as ligações de um nó, usada também pelo sentinela.
+   */
+  struct Link {
+    Link *next;  ///< Ponteiro para o próximo nó na lista.
+    Link *prev;  ///< Ponteiro para o nó anterior na lista.
+  };
+
   /**
    * @brief Estrutura que representa um nó da lista.
    */
-  struct Node {
+  struct Node : Link {
     /**
      * @brief Construtor do nó.
      * @param value Valor do nó a ser armazenado.
      */
     Node(const T &value);
 
-    /**
-     * @brief Destruidor do nó.
-     *
-     * Realiza a desalocação do nó e seus nós subsequentes.
-     */
-    ~Node();
-
     T value;     ///< Valor armazenado no nó.
-    Node *next;  ///< Ponteiro para o próximo nó na lista.
-    Node *prev;  ///< Ponteiro para o nó anterior na lista.
   };
 
  public:
   /**
    * @brief Iterador da lista duplamente encadeada.
    *
-   * Permite a navegação e manipulação dos elementos da lista.
+   * Permite a navegação e manipulação dos elementos da lista. É um iterador
+   * bidirecional completo, então funciona com `std::reverse_iterator` e com
+   * os algoritmos da biblioteca padrão.
    */
   template <class U>
   class Iterator {
    public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<std::is_const_v<U>, const T *, T *>;
+    using reference = std::conditional_t<std::is_const_v<U>, const T &, T &>;
+
+    /**
+     * @brief Construtor padrão. Cria um iterador que não aponta para nenhum
+     * nó.
+     */
+    Iterator();
+
+    /**
+     * @brief Converte um `iterator` em `const_iterator`.
+     * @param other Iterador mutável apontando para o mesmo nó.
+     */
+    template <class V, class = std::enable_if_t<std::is_same_v<const V, U> &&
+                                                !std::is_same_v<V, U>>>
+    Iterator(const Iterator<V> &other);
+
     /**
      * @brief Desreferencia o iterador.
      * @return Referência ao valor armazenado no nó atual.
      */
-    auto &operator*() const;
+    reference operator*() const;
+
+    /**
+     * @brief Acessa um membro do valor armazenado no nó atual.
+     * @return Ponteiro para o valor armazenado no nó atual.
+     */
+    pointer operator->() const;
 
     /**
      * @brief Incrementa o iterador para o próximo nó.
@@ -62,13 +98,29 @@ class DoublyLinkedList {
      */
     Iterator<U> &operator--();
 
+    /**
+     * @brief Incrementa o iterador para o próximo nó (pós-fixado).
+     * @return Cópia do iterador antes do incremento.
+     */
+    Iterator<U> operator++(int);
+
+    /**
+     * @brief Decrementa o iterador para o nó anterior (pós-fixado).
+     * @return Cópia do iterador antes do decremento.
+     */
+    Iterator<U> operator--(int);
+
     /**
      * @brief Compara dois iteradores para verificar se são iguais.
+     *
+     * Um `iterator` pode ser comparado com um `const_iterator`.
+     *
      * @param other Outro iterador para comparação.
      * @return Verdadeiro se os iteradores forem iguais, falso caso
      * contrário.
      */
-    bool operator==(const Iterator<U> &other) const;
+    template <class V>
+    bool operator==(const Iterator<V> &other) const;
 
     /**
      * @brief Compara dois iteradores para verificar se são diferentes.
@@ -76,7 +128,8 @@ class DoublyLinkedList {
      * @return Verdadeiro se os iteradores forem diferentes, falso caso
      * contrário.
      */
-    bool operator!=(const Iterator<U> &other) const;
+    template <class V>
+    bool operator!=(const Iterator<V> &other) const;
 
     /**
      * @brief Retorna um iterador avançado por um número específico de
@@ -102,21 +155,27 @@ class DoublyLinkedList {
     size_t operator-(const Iterator<U> other) const;
 
    private:
+    /// Tipo da ligação apontada, constante se `U` for constante.
+    using link_type =
+        std::conditional_t<std::is_const_v<U>, const Link, Link>;
+
     /**
      * @brief Construtor do iterador.
-     * @param ptr Ponteiro para o nó.
-     * @param end Flag indicando se o iterador está no final.
+     * @param ptr Ponteiro para o nó (ou para o sentinela, no final).
      */
-    Iterator(U *ptr, bool end);
+    Iterator(link_type *ptr);
 
-    U *node;   ///< Ponteiro para o nó.
-    bool end;  ///< Flag indicando se o iterador chegou ao final da lista.
+    link_type *node;  ///< Ponteiro para o nó.
 
+    template <class>
+    friend class Iterator;
     friend class DoublyLinkedList;
   };
 
   using iterator = DoublyLinkedList<T>::Iterator<Node>;
   using const_iterator = DoublyLinkedList<T>::Iterator<const Node>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   /**
    * @brief Construtor padrão da lista duplamente encadeada.
@@ -183,6 +242,59 @@ class DoublyLinkedList {
    */
   iterator end();
 
+  /**
+   * @brief Retorna um iterador constante para o início da lista, mesmo em
+   * uma lista não constante.
+   * @return Iterador constante para o início da lista.
+   */
+  const_iterator cbegin() const;
+
+  /**
+   * @brief Retorna um iterador constante para o final da lista, mesmo em uma
+   * lista não constante.
+   * @return Iterador constante para o final da lista.
+   */
+  const_iterator cend() const;
+
+  /**
+   * @brief Retorna um iterador reverso para o último elemento.
+   * @return Iterador reverso para o início da travessia reversa.
+   */
+  reverse_iterator rbegin();
+
+  /**
+   * @brief Retorna um iterador reverso para antes do primeiro elemento.
+   * @return Iterador reverso para o final da travessia reversa.
+   */
+  reverse_iterator rend();
+
+  /**
+   * @brief Retorna um iterador reverso constante para o último elemento.
+   * @return Iterador reverso constante para o início da travessia reversa.
+   */
+  const_reverse_iterator rbegin() const;
+
+  /**
+   * @brief Retorna um iterador reverso constante para antes do primeiro
+   * elemento.
+   * @return Iterador reverso constante para o final da travessia reversa.
+   */
+  const_reverse_iterator rend() const;
+
+  /**
+   * @brief Retorna um iterador reverso constante para o último elemento,
+   * mesmo em uma lista não constante.
+   * @return Iterador reverso constante para o início da travessia reversa.
+   */
+  const_reverse_iterator crbegin() const;
+
+  /**
+   * @brief Retorna um iterador reverso constante para antes do primeiro
+   * elemento, mesmo em uma lista não constante.
+   * @return Iterador reverso constante para o final da travessia reversa.
+   */
+  const_reverse_iterator crend() const;
+
   /**
    * @brief Adiciona um elemento ao início da lista.
    * @param value Valor a ser adicionado.
@@ -218,11 +330,31 @@ class DoublyLinkedList {
 
   /**
    * @brief Remove uma faixa de elementos da lista, definida pelos iteradores.
+   *
+   * Os nós são contados enquanto são desalocados, em uma única passada.
+   *
    * @param first Iterador apontando para o primeiro elemento a ser removido.
    * @param last Iterador apontando após o último elemento a ser removido.
    */
   void erase(iterator first, iterator last);
 
+  /**
+   * @brief Move uma faixa de elementos de outra lista para antes de `pos`.
+   *
+   * Os nós são religados sem cópia nem travessia, em tempo O(1). Como a
+   * faixa não é percorrida, quem chama informa quantos elementos ela contém.
+   *
+   * @param pos Iterador desta lista antes do qual a faixa será inserida.
+   * @param other Lista de onde a faixa será retirada (pode ser esta lista,
+   * desde que `pos` não esteja estritamente dentro da faixa; se `pos` for
+   * `first` ou `last`, nada muda).
+   * @param first Iterador apontando para o primeiro elemento a ser movido.
+   * @param last Iterador apontando após o último elemento a ser movido.
+   * @param count Número de elementos em `[first, last)`.
+   */
+  void splice(iterator pos, DoublyLinkedList &other, iterator first,
+              iterator last, size_t count);
+
   /**
    * @brief Remove todos os elementos da lista.
    */
@@ -262,24 +394,91 @@ class DoublyLinkedList {
 
   /**
    * @brief Acessa um elemento por seu índice.
+   *
+   * Aproveita o último nó acessado pela versão não constante, mas não o
+   * altera; várias threads podem ler a mesma lista ao mesmo tempo.
+   *
    * @param index Índice do elemento.
    * @return Referência constante ao valor no índice fornecido.
    * @throw std::out_of_range Se o índice for inválido.
    */
   const T &operator[](size_t index) const;
 
+  /**
+   * @brief Acessa um elemento por seu índice, partindo da extremidade mais
+   * próxima.
+   * @param index Índice do elemento.
+   * @return Referência ao valor no índice fornecido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  T &at(size_t index);
+
+  /**
+   * @brief Acessa um elemento por seu índice, partindo da extremidade mais
+   * próxima.
+   * @param index Índice do elemento.
+   * @return Referência constante ao valor no índice fornecido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  const T &at(size_t index) const;
+
+  /**
+   * @brief Insere um elemento na posição especificada.
+   *
+   * A posição é localizada a partir da extremidade mais próxima, e o novo
+   * nó passa a ser o último acessado, de modo que inserções em índices
+   * consecutivos custam O(1) amortizado.
+   *
+   * @param index Índice onde o elemento será inserido (até `size()`).
+   * @param value Valor a ser inserido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void insert_at(size_t index, const T &value);
+
+  /**
+   * @brief Remove o elemento na posição especificada.
+   *
+   * A posição é localizada a partir da extremidade mais próxima.
+   *
+   * @param index Índice do elemento a ser removido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void erase_at(size_t index);
+
   /**
    * @brief Imprime os elementos da lista.
    */
   void print() const;
 
  private:
-  Node *head;   /**< Ponteiro para o primeiro nó da lista (inicialmente nullptr
-                   para listas vazias). */
-  Node *tail;   /**< Ponteiro para o último nó da lista (inicialmente nullptr
-                   para listas vazias). */
+  /**
+   * @brief Localiza o nó na posição especificada.
+   *
+   * A busca parte da cabeça, da cauda ou do último nó acessado (o "dedo"),
+   * o que estiver mais próximo do índice, e atualiza o dedo com o nó
+   * encontrado. Assim, acessos sequenciais custam O(1) amortizado.
+   *
+   * @param index O índice do nó (deve ser menor que `size()`).
+   * @return Ponteiro para o nó no índice especificado.
+   */
+  Node *node_at(size_t index);
+
+  /**
+   * @brief Localiza o nó na posição especificada sem atualizar o dedo.
+   *
+   * @param index O índice do nó (deve ser menor que `size()`).
+   * @return Ponteiro para o nó no índice especificado.
+   */
+  Node *node_at(size_t index) const;
+
+  Link sentinel; /**< Nó sentinela: `sentinel.next` é o primeiro nó e
+                   `sentinel.prev` é o último (ambos apontam para o próprio
+                   sentinela em listas vazias). */
   size_t _size; /**< Tamanho atual da lista, representando o número de
                    elementos (inicialmente 0). */
+
+  Node *finger; /**< Último nó acessado por índice (nullptr se inválido). */
+  size_t finger_index; /**< Índice do nó apontado por `finger`. */
 };
 
 #include "../src/doubly_linked_list.hpp"
@@ -0,0 +1,195 @@
+#pragma once
+#include <stddef.h>
+
+#include "pair.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @class FlatMap
+ * @brief Mapa ordenado guardado em arranjos contíguos, com busca binária.
+ *
+ * Os pares ficam em um arranjo ordenado pela chave, de modo que uma busca
+ * custa O(log n) e uma varredura de intervalo percorre memória sequencial.
+ * As chaves também são guardadas em um arranjo separado, usado pela busca
+ * binária: cada linha de cache visitada traz mais chaves, e os valores só
+ * são lidos depois que a posição é encontrada.
+ *
+ * Inserir ou remover uma chave desloca os pares seguintes, em O(n). Para
+ * muitas atualizações, `insert_or_assign_batch` ordena o lote e o intercala
+ * com o mapa de uma vez, em O(n + m log m).
+ *
+ * @tparam K Tipo das chaves. Precisa de `operator<` e de um construtor
+ * padrão.
+ * @tparam V Tipo dos valores. Precisa de um construtor padrão.
+ */
+template <class K, class V>
+class FlatMap {
+ public:
+  /**
+   * @brief Construtor padrão. Cria um mapa vazio.
+   */
+  FlatMap();
+
+  /**
+   * @brief Constrói o mapa a partir de uma lista de pares, em O(n log n).
+   *
+   * Se uma chave aparecer mais de uma vez, fica o último valor.
+   *
+   * @param pairs Os pares.
+   */
+  FlatMap(const VectorList<Pair<K, V>> &pairs);
+
+  /**
+   * @brief Destruidor. Libera os arranjos.
+   */
+  ~FlatMap();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other O mapa a ser copiado.
+   */
+  FlatMap(const FlatMap &other);
+
+  /**
+   * @brief Construtor de movimento. O outro mapa fica vazio.
+   * @param other O mapa a ser movido.
+   */
+  FlatMap(FlatMap &&other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other O mapa a ser copiado.
+   * @return Uma referência para o objeto da classe.
+   */
+  FlatMap &operator=(const FlatMap &other);
+
+  /**
+   * @brief Operador de atribuição por movimento. O outro mapa fica vazio.
+   * @param other O mapa a ser movido.
+   * @return Uma referência para o objeto da classe.
+   */
+  FlatMap &operator=(FlatMap &&other);
+
+  /**
+   * @brief Obtém o número de chaves.
+   * @return O tamanho do mapa.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se o mapa está vazio.
+   * @return Verdadeiro se não houver chaves.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Obtém o número de pares que cabem sem realocar.
+   * @return A capacidade do mapa.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Garante espaço para `capacity` pares sem realocar.
+   * @param capacity A capacidade desejada.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Encontra a posição da primeira chave que não é menor que `key`.
+   * @param key A chave procurada.
+   * @return A posição, entre 0 e `size()`.
+   */
+  size_t lower_bound(const K &key) const;
+
+  /**
+   * @brief Busca o valor associado a uma chave.
+   * @param key A chave.
+   * @return Ponteiro para o valor, ou `nullptr` se a chave não existir. O
+   * ponteiro deixa de ser válido quando o mapa é alterado.
+   */
+  V *find(const K &key);
+
+  /**
+   * @brief Busca o valor associado a uma chave.
+   * @param key A chave.
+   * @return Ponteiro constante para o valor, ou `nullptr`.
+   */
+  const V *find(const K &key) const;
+
+  /**
+   * @brief Verifica se uma chave existe.
+   * @param key A chave.
+   * @return Verdadeiro se a chave existir.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Insere uma chave ou substitui o seu valor.
+   * @param key A chave.
+   * @param value O valor.
+   * @return Verdadeiro se a chave foi inserida, falso se já existia.
+   */
+  bool insert_or_assign(const K &key, const V &value);
+
+  /**
+   * @brief Insere ou substitui um lote de pares de uma vez.
+   *
+   * O lote é ordenado pela chave (de forma estável, de modo que, para
+   * chaves repetidas, vale o último valor) e intercalado com o mapa em uma
+   * passada, de trás para frente, sem deslocar os pares mais de uma vez.
+   *
+   * @param updates Os pares a inserir ou substituir.
+   * @return Número de chaves novas.
+   */
+  size_t insert_or_assign_batch(const VectorList<Pair<K, V>> &updates);
+
+  /**
+   * @brief Remove uma chave.
+   * @param key A chave.
+   * @return Verdadeiro se a chave existia.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Obtém um par pela posição, em ordem crescente de chave.
+   * @param index A posição.
+   * @return Uma referência constante para o par.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  const Pair<K, V> &operator[](size_t index) const;
+
+  /**
+   * @brief Visita, em ordem, os pares com chave em `[first, last)`.
+   * @param first A menor chave do intervalo.
+   * @param last A chave que encerra o intervalo (não incluída).
+   * @param visit Função chamada com a chave e o valor de cada par.
+   * @return Número de pares visitados.
+   */
+  template <class F>
+  size_t range(const K &first, const K &last, F visit) const;
+
+  /**
+   * @brief Visita todos os pares em ordem crescente de chave.
+   * @param visit Função chamada com a chave e o valor de cada par.
+   */
+  template <class F>
+  void for_each(F visit) const;
+
+  /**
+   * @brief Remove todas as chaves, mantendo a capacidade.
+   */
+  void clear();
+
+ private:
+  /**
+   * @brief Realoca os arranjos, se necessário, para caber `count` pares.
+   */
+  void grow(size_t count);
+
+  K *keys;              ///< Chaves, na mesma ordem dos pares.
+  Pair<K, V> *entries;  ///< Pares ordenados pela chave.
+  size_t _size;         ///< Número de pares.
+  size_t _capacity;     ///< Tamanho dos arranjos.
+};
+
+#include "../src/flat_map.hpp"
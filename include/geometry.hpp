@@ -0,0 +1,103 @@
+#pragma once
+#include <stddef.h>
+
+#include "point.hpp"
+#include "point_cloud.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @brief Menor retângulo alinhado aos eixos que contém um conjunto de
+ * pontos.
+ */
+struct BoundingBox {
+  double min_x; ///< Menor coordenada x.
+  double min_y; ///< Menor coordenada y.
+  double max_x; ///< Maior coordenada x.
+  double max_y; ///< Maior coordenada y.
+};
+
+/**
+ * @brief O par de pontos mais próximos de um conjunto.
+ */
+struct ClosestPair {
+  size_t first;    ///< Índice do primeiro ponto (o menor dos dois).
+  size_t second;   ///< Índice do segundo ponto.
+  double distance; ///< Distância entre os dois pontos.
+};
+
+/**
+ * @brief Calcula o retângulo que contém todos os pontos.
+ *
+ * Na PointCloud, os mínimos e máximos de cada coordenada são calculados com
+ * AVX2, quando disponível. Com mais de uma thread, cada uma percorre uma
+ * faixa contígua dos pontos.
+ *
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return O retângulo.
+ * @throw std::out_of_range Se não houver pontos.
+ */
+BoundingBox bounding_box(const PointCloud &points, unsigned threads = 1);
+
+/**
+ * @brief Calcula o retângulo que contém todos os pontos.
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return O retângulo.
+ * @throw std::out_of_range Se a lista estiver vazia.
+ */
+BoundingBox bounding_box(const VectorList<Point> &points,
+                         unsigned threads = 1);
+
+/**
+ * @brief Calcula o fecho convexo com a cadeia monótona de Andrew, em
+ * O(n log n).
+ *
+ * Antes da ordenação, os pontos estritamente dentro do quadrilátero
+ * formado pelos extremos em x e em y são descartados, pois não podem estar
+ * no fecho. Com mais de uma thread, os pontos restantes são divididos em
+ * faixas, o fecho de cada faixa é calculado em paralelo, e o fecho final é
+ * o fecho dos vértices dessas faixas.
+ *
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return Os vértices do fecho em sentido anti-horário, a partir do ponto
+ * de menor x (e menor y, em caso de empate), sem pontos colineares. Com
+ * menos de três pontos distintos, os pontos distintos.
+ */
+VectorList<Point> convex_hull(const VectorList<Point> &points,
+                              unsigned threads = 1);
+
+/**
+ * @brief Calcula o fecho convexo de uma PointCloud.
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return Os vértices do fecho, como na versão para VectorList.
+ */
+VectorList<Point> convex_hull(const PointCloud &points, unsigned threads = 1);
+
+/**
+ * @brief Encontra o par de pontos mais próximos por divisão e conquista, em
+ * O(n log n).
+ *
+ * Os pontos são ordenados por x e divididos ao meio; depois de resolver as
+ * metades, só os pontos na faixa em volta da divisão, ordenados por y, são
+ * comparados, cada um com no máximo sete vizinhos. Com mais de uma thread,
+ * as metades dos primeiros níveis são resolvidas em paralelo.
+ *
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return Os índices dos dois pontos e a distância entre eles.
+ * @throw std::invalid_argument Se houver menos de dois pontos.
+ */
+ClosestPair closest_pair(const VectorList<Point> &points,
+                         unsigned threads = 1);
+
+/**
+ * @brief Encontra o par de pontos mais próximos de uma PointCloud.
+ * @param points Os pontos.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @return Os índices dos dois pontos e a distância entre eles.
+ * @throw std::invalid_argument Se houver menos de dois pontos.
+ */
+ClosestPair closest_pair(const PointCloud &points, unsigned threads = 1);
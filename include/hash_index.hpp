@@ -0,0 +1,172 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+/**
+ * @class HashIndex
+ * @brief Tabela hash de endereçamento aberto que associa chaves a valores.
+ *
+ * A HashIndex é usada como índice auxiliar por estruturas que precisam
+ * localizar um elemento pela chave em tempo O(1) esperado, como as caches
+ * LruCache e LfuCache, que guardam aqui iteradores para os nós de uma
+ * DoublyLinkedList.
+ *
+ * As colisões são resolvidas por sondagem linear, e a remoção desloca para
+ * trás os elementos seguintes do mesmo agrupamento, dispensando marcadores
+ * de remoção. A capacidade é sempre uma potência de dois, e a tabela dobra
+ * de tamanho quando a ocupação passaria de 3/4.
+ *
+ * @tparam K Tipo das chaves.
+ * @tparam V Tipo dos valores associados.
+ * @tparam Hash Função hash usada para as chaves.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class HashIndex {
+  /**
+   * @struct Slot
+   * @brief Posição da tabela.
+   */
+  struct Slot {
+    K key;     /**< Chave armazenada. */
+    V value;   /**< Valor associado à chave. */
+    bool used; /**< Indica se a posição está ocupada. */
+  };
+
+ public:
+  /**
+   * @brief Construtor. Cria um índice vazio.
+   *
+   * @param capacity Número de elementos que o índice deve comportar sem
+   * crescer.
+   * @param hash Função hash a ser usada.
+   */
+  HashIndex(size_t capacity = 0, const Hash &hash = Hash());
+
+  /**
+   * @brief Construtor de cópia.
+   *
+   * @param other O índice a ser copiado.
+   */
+  HashIndex(const HashIndex &other);
+
+  /**
+   * @brief Operador de atribuição.
+   *
+   * @param other O índice a ser copiado.
+   * @return Uma referência para o objeto da classe.
+   */
+  HashIndex &operator=(const HashIndex &other);
+
+  /**
+   * @brief Destruidor. Libera a tabela.
+   */
+  ~HashIndex();
+
+  /**
+   * @brief Retorna o número de chaves armazenadas.
+   *
+   * @return O número de chaves.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se o índice está vazio.
+   *
+   * @return Verdadeiro se não houver chaves, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Garante espaço para `capacity` chaves sem crescer a tabela.
+   *
+   * @param capacity O número de chaves desejado.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Procura o valor associado a uma chave.
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir.
+   */
+  V *find(const K &key);
+
+  /**
+   * @brief Procura o valor associado a uma chave (const).
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro constante para o valor, ou nullptr se a chave não
+   * existir.
+   */
+  const V *find(const K &key) const;
+
+  /**
+   * @brief Verifica se uma chave está no índice.
+   *
+   * @param key A chave procurada.
+   * @return Verdadeiro se a chave existir, caso contrário falso.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Associa um valor a uma chave, substituindo o valor anterior se a
+   * chave já existir.
+   *
+   * @param key A chave.
+   * @param value O valor a ser associado.
+   */
+  void insert(const K &key, const V &value);
+
+  /**
+   * @brief Remove uma chave do índice.
+   *
+   * @param key A chave a ser removida.
+   * @return Verdadeiro se a chave existia, caso contrário falso.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Remove todas as chaves, mantendo a capacidade.
+   */
+  void clear();
+
+  /**
+   * @brief Retorna a função hash usada pelo índice.
+   *
+   * @return Uma cópia da função hash.
+   */
+  Hash hash_function() const;
+
+ private:
+  /**
+   * @brief Calcula a posição inicial de uma chave na tabela.
+   *
+   * @param key A chave.
+   * @return A posição ideal da chave.
+   */
+  size_t home_of(const K &key) const;
+
+  /**
+   * @brief Localiza a posição de uma chave ou a posição livre onde ela
+   * deveria ser inserida.
+   *
+   * @param key A chave.
+   * @return A posição encontrada.
+   */
+  size_t slot_of(const K &key) const;
+
+  /**
+   * @brief Realoca a tabela com uma nova capacidade, reinserindo as chaves.
+   *
+   * @param slot_count O novo número de posições (potência de dois).
+   */
+  void rehash(size_t slot_count);
+
+  Slot *slots;       /**< Tabela de posições. */
+  size_t _size;      /**< Número de chaves armazenadas. */
+  size_t slot_count; /**< Número de posições da tabela. */
+  Hash hash;         /**< Função hash. */
+};
+
+#include "../src/hash_index.hpp"
@@ -0,0 +1,277 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <type_traits>
+
+#include "pair.hpp"
+
+/**
+ * @class HashMap
+ * @brief Mapa de endereçamento aberto com sondagem Robin Hood, que guarda
+ * os pares `Pair<K, V>` dentro da própria tabela.
+ *
+ * Ao contrário da HashIndex, que sonda linearmente sem reordenar, aqui cada
+ * posição guarda também a distância do par até a sua posição ideal (mais
+ * um; zero indica posição livre). Na inserção, um par que está mais longe
+ * de casa toma o lugar de um que está mais perto ("tira dos ricos"), o que
+ * mantém as sequências de sondagem curtas e parecidas mesmo com ocupação
+ * alta. Uma busca sem sucesso para assim que encontra um par mais perto de
+ * casa do que ela própria estaria.
+ *
+ * As distâncias ficam em um arranjo separado de bytes, de modo que a
+ * sondagem lê poucas linhas de cache antes de comparar chaves. Distâncias
+ * acima de 255, que só aparecem com uma função hash ruim, ficam saturadas:
+ * as buscas continuam corretas, apenas comparam mais chaves. A remoção
+ * desloca para trás os pares seguintes da sequência, sem marcadores de
+ * remoção.
+ *
+ * Se `Hash` e `Equal` declararem `is_transparent`, as buscas aceitam
+ * qualquer tipo comparável com a chave (por exemplo, `const char*` para
+ * chaves `std::string`), sem construir uma chave temporária.
+ *
+ * @tparam K Tipo das chaves. Precisa de um construtor padrão.
+ * @tparam V Tipo dos valores. Precisa de um construtor padrão.
+ * @tparam Hash Função hash usada para as chaves.
+ * @tparam Equal Comparação de igualdade entre chaves.
+ */
+template <class K, class V, class Hash = std::hash<K>,
+          class Equal = std::equal_to<K>>
+class HashMap {
+  /// Habilita as buscas heterogêneas apenas com `Hash` e `Equal`
+  /// transparentes.
+  template <class H, class E>
+  using transparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  /**
+   * @brief Construtor. Cria um mapa vazio.
+   *
+   * @param capacity Número de pares que o mapa deve comportar sem crescer.
+   * @param max_load_factor Ocupação máxima da tabela, entre 0 e 1.
+   * @param hash Função hash a ser usada.
+   * @param equal Comparação de chaves a ser usada.
+   * @throw std::invalid_argument Se o fator de carga for inválido.
+   */
+  HashMap(size_t capacity = 0, double max_load_factor = 0.875,
+          const Hash &hash = Hash(), const Equal &equal = Equal());
+
+  /**
+   * @brief Destruidor. Libera a tabela.
+   */
+  ~HashMap();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other O mapa a ser copiado.
+   */
+  HashMap(const HashMap &other);
+
+  /**
+   * @brief Construtor de movimento. O outro mapa fica vazio.
+   * @param other O mapa a ser movido.
+   */
+  HashMap(HashMap &&other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other O mapa a ser copiado.
+   * @return Uma referência para o objeto da classe.
+   */
+  HashMap &operator=(const HashMap &other);
+
+  /**
+   * @brief Operador de atribuição por movimento. O outro mapa fica vazio.
+   * @param other O mapa a ser movido.
+   * @return Uma referência para o objeto da classe.
+   */
+  HashMap &operator=(HashMap &&other);
+
+  /**
+   * @brief Obtém o número de pares.
+   * @return O tamanho do mapa.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se o mapa está vazio.
+   * @return Verdadeiro se não houver pares.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Obtém o número de posições da tabela.
+   * @return Uma potência de 2, ou 0 antes da primeira inserção.
+   */
+  size_t bucket_count() const;
+
+  /**
+   * @brief Obtém a ocupação atual da tabela.
+   * @return `size() / bucket_count()`, ou 0 se a tabela estiver vazia.
+   */
+  double load_factor() const;
+
+  /**
+   * @brief Obtém a ocupação máxima antes de a tabela crescer.
+   * @return O fator de carga máximo.
+   */
+  double max_load_factor() const;
+
+  /**
+   * @brief Muda a ocupação máxima, crescendo a tabela se necessário.
+   * @param factor O novo fator de carga máximo, entre 0 e 1.
+   * @throw std::invalid_argument Se o fator de carga for inválido.
+   */
+  void max_load_factor(double factor);
+
+  /**
+   * @brief Garante espaço para `capacity` pares sem crescer a tabela.
+   * @param capacity O número de pares desejado.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Procura o valor associado a uma chave.
+   * @param key A chave procurada.
+   * @return Ponteiro para o valor, ou `nullptr` se a chave não existir. O
+   * ponteiro deixa de ser válido quando o mapa é alterado.
+   */
+  V *find(const K &key);
+
+  /**
+   * @brief Procura o valor associado a uma chave (const).
+   * @param key A chave procurada.
+   * @return Ponteiro constante para o valor, ou `nullptr`.
+   */
+  const V *find(const K &key) const;
+
+  /**
+   * @brief Procura o valor associado a uma chave de outro tipo (busca
+   * heterogênea).
+   * @param key Um valor comparável com as chaves.
+   * @return Ponteiro para o valor, ou `nullptr`.
+   */
+  template <class Q, class H = Hash, class E = Equal,
+            class = transparent<H, E>>
+  V *find(const Q &key);
+
+  /**
+   * @brief Procura o valor associado a uma chave de outro tipo (const).
+   * @param key Um valor comparável com as chaves.
+   * @return Ponteiro constante para o valor, ou `nullptr`.
+   */
+  template <class Q, class H = Hash, class E = Equal,
+            class = transparent<H, E>>
+  const V *find(const Q &key) const;
+
+  /**
+   * @brief Verifica se uma chave está no mapa.
+   * @param key A chave procurada.
+   * @return Verdadeiro se a chave existir.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Verifica se uma chave de outro tipo está no mapa.
+   * @param key Um valor comparável com as chaves.
+   * @return Verdadeiro se a chave existir.
+   */
+  template <class Q, class H = Hash, class E = Equal,
+            class = transparent<H, E>>
+  bool contains(const Q &key) const;
+
+  /**
+   * @brief Associa um valor a uma chave, substituindo o valor anterior se a
+   * chave já existir.
+   * @param key A chave.
+   * @param value O valor.
+   * @return Verdadeiro se a chave foi inserida, falso se já existia.
+   */
+  bool insert(const K &key, const V &value);
+
+  /**
+   * @brief Remove uma chave.
+   * @param key A chave a ser removida.
+   * @return Verdadeiro se a chave existia.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Remove uma chave de outro tipo.
+   * @param key Um valor comparável com as chaves.
+   * @return Verdadeiro se a chave existia.
+   */
+  template <class Q, class H = Hash, class E = Equal,
+            class = transparent<H, E>>
+  bool erase(const Q &key);
+
+  /**
+   * @brief Visita todos os pares, sem ordem definida.
+   * @param visit Função chamada com a chave e o valor de cada par.
+   */
+  template <class F>
+  void for_each(F visit) const;
+
+  /**
+   * @brief Remove todos os pares, mantendo a capacidade.
+   */
+  void clear();
+
+ private:
+  /// Maior distância guardada em um byte; distâncias maiores ficam
+  /// saturadas neste valor.
+  static constexpr uint8_t max_distance = UINT8_MAX;
+
+  /**
+   * @brief Calcula a posição ideal de um hash.
+   */
+  size_t home_of(size_t h) const;
+
+  /**
+   * @brief Procura a posição de uma chave.
+   * @return A posição, ou `bucket_count()` se a chave não existir.
+   */
+  template <class Q>
+  size_t position_of(const Q &key) const;
+
+  /**
+   * @brief Obtém a distância real do par de uma posição ocupada, calculando
+   * a posição ideal se a guardada estiver saturada.
+   */
+  size_t distance_at(size_t position) const;
+
+  /**
+   * @brief Remove o par de uma posição, deslocando para trás os seguintes.
+   */
+  void erase_at(size_t position);
+
+  /**
+   * @brief Coloca um par cuja chave não está no mapa, trocando de lugar com
+   * os pares mais perto de casa. As trocas usam as distâncias reais, mesmo
+   * acima de 255, para que a ordem das sequências continue valendo depois
+   * das remoções.
+   */
+  void place(Pair<K, V> &&entry);
+
+  /**
+   * @brief Troca a tabela por uma com `count` posições e reinsere os pares.
+   */
+  void rehash(size_t count);
+
+  /**
+   * @brief Menor tabela que comporta `capacity` pares.
+   */
+  size_t buckets_for(size_t capacity) const;
+
+  Pair<K, V> *entries;  ///< Pares, na posição em que estão.
+  uint8_t *distances;   ///< Distância até a posição ideal, mais 1 (0: livre).
+  size_t _size;         ///< Número de pares.
+  size_t slot_count;    ///< Número de posições (potência de 2).
+  double _max_load;     ///< Ocupação máxima.
+  Hash hash;            ///< Função hash.
+  Equal equal;          ///< Comparação de chaves.
+};
+
+#include "../src/hash_map.hpp"
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stddef.h>
+
+#include <charconv>
 #include <string>
 
 /**
@@ -7,21 +10,41 @@
  *
  * Esta classe permite manipular e realizar operações básicas com períodos de
  * tempo, como adição, subtração e comparação.
+ *
+ * O tempo é guardado como um único número de segundos, então horas, minutos
+ * e segundos estão sempre normalizados, e comparar dois tempos é comparar
+ * dois inteiros. Tudo, exceto `to_string`, pode ser avaliado em tempo de
+ * compilação. Uma diferença negativa é representada com todos os campos
+ * negativos e formatada com um sinal, por exemplo "-01:30:00".
  */
 class Hours {
  public:
+  /// Número máximo de caracteres escritos por `to_chars`.
+  static constexpr size_t max_chars = 13;
+
   /**
    * @brief Construtor padrão que inicializa o tempo como 00:00:00.
    */
-  Hours();
+  constexpr Hours();
 
   /**
    * @brief Construtor que inicializa o tempo com valores específicos.
+   *
+   * Minutos e segundos fora de 0-59 são normalizados: Hours(0, 90, 0) é
+   * 01:30:00.
+   *
    * @param h Horas.
    * @param m Minutos (0-59).
    * @param s Segundos (0-59).
    */
-  Hours(int h, int m, int s);
+  constexpr Hours(int h, int m, int s);
+
+  /**
+   * @brief Cria um tempo a partir de um total de segundos.
+   * @param seconds O total de segundos desde 00:00:00.
+   * @return O tempo correspondente.
+   */
+  static constexpr Hours from_seconds(int seconds);
 
   /**
    * @brief Define um novo tempo.
@@ -29,43 +52,43 @@ class Hours {
    * @param m Minutos (0-59).
    * @param s Segundos (0-59).
    */
-  void set_time(int h, int m, int s);
+  constexpr void set_time(int h, int m, int s);
 
   /**
    * @brief Obtém a quantidade de horas.
    * @return O valor das horas.
    */
-  int get_hours() const;
+  constexpr int get_hours() const;
 
   /**
    * @brief Obtém a quantidade de minutos.
    * @return O valor dos minutos.
    */
-  int get_minutes() const;
+  constexpr int get_minutes() const;
 
   /**
    * @brief Obtém a quantidade de segundos.
    * @return O valor dos segundos.
    */
-  int get_seconds() const;
+  constexpr int get_seconds() const;
 
   /**
    * @brief Retorna o total de segundos desde 00:00:00.
    * @return O tempo convertido em segundos.
    */
-  int to_seconds() const;
+  constexpr int to_seconds() const;
 
   /**
    * @brief Retorna o total de minutos desde 00:00:00.
    * @return O tempo convertido em minutos.
    */
-  double to_minutes() const;
+  constexpr double to_minutes() const;
 
   /**
    * @brief Retorna o total de horas desde 00:00:00.
    * @return O tempo convertido em horas.
    */
-  double to_hours() const;
+  constexpr double to_hours() const;
 
   /**
    * @brief Retorna o tempo formatado como string "HH:MM:SS".
@@ -73,40 +96,64 @@ class Hours {
    */
   std::string to_string() const;
 
+  /**
+   * @brief Escreve o tempo no formato "HH:MM:SS" em um buffer, sem alocar
+   * memória.
+   *
+   * As horas têm pelo menos dois dígitos, e mais se necessário. Nenhum
+   * terminador nulo é escrito; `max_chars` caracteres sempre bastam.
+   *
+   * @param first Início do buffer.
+   * @param last Fim do buffer.
+   * @return O ponteiro após o último caractere escrito, ou `last` com
+   * `std::errc::value_too_large` se o buffer for pequeno demais.
+   */
+  constexpr std::to_chars_result to_chars(char* first, char* last) const;
+
+  /**
+   * @brief Lê um tempo no formato "HH:MM:SS".
+   *
+   * As horas podem ter um ou mais dígitos e um sinal de menos; minutos e
+   * segundos têm exatamente dois dígitos, entre 00 e 59.
+   *
+   * @param first Início do texto.
+   * @param last Fim do texto.
+   * @param value Recebe o tempo lido, se a leitura tiver sucesso.
+   * @return O ponteiro após o último caractere lido. Se o texto não estiver
+   * no formato, o ponteiro é `first` e o erro `std::errc::invalid_argument`;
+   * se o tempo não couber em um `int` de segundos, o erro é
+   * `std::errc::result_out_of_range` e `value` não é alterado.
+   */
+  static constexpr std::from_chars_result from_chars(const char* first,
+                                                     const char* last,
+                                                     Hours& value);
+
   /**
    * @brief Operadores de comparação entre dois objetos Hours.
    */
-  bool operator==(const Hours& other) const;
-  bool operator!=(const Hours& other) const;
-  bool operator>(const Hours& other) const;
-  bool operator<(const Hours& other) const;
-  bool operator>=(const Hours& other) const;
-  bool operator<=(const Hours& other) const;
+  constexpr bool operator==(const Hours& other) const;
+  constexpr bool operator!=(const Hours& other) const;
+  constexpr bool operator>(const Hours& other) const;
+  constexpr bool operator<(const Hours& other) const;
+  constexpr bool operator>=(const Hours& other) const;
+  constexpr bool operator<=(const Hours& other) const;
 
   /**
    * @brief Sobrecarga do operador + para somar dois tempos.
    * @param other O tempo a ser somado.
    * @return Novo objeto Hours com a soma dos tempos.
    */
-  Hours operator+(const Hours& other) const;
+  constexpr Hours operator+(const Hours& other) const;
 
   /**
    * @brief Sobrecarga do operador - para subtrair dois tempos.
    * @param other O tempo a ser subtraído.
    * @return Novo objeto Hours com a diferença dos tempos.
    */
-  Hours operator-(const Hours& other) const;
+  constexpr Hours operator-(const Hours& other) const;
 
  private:
-  int hours;    ///< Representa as horas.
-  int minutes;  ///< Representa os minutos (0-59).
-  int seconds;  ///< Representa os segundos (0-59).
-
-  /**
-   * @brief Normaliza minutos e segundos para manter valores corretos.
-   *
-   * Se os segundos ou minutos ultrapassarem 59, eles serão convertidos
-   * para o formato correto, ajustando também as horas.
-   */
-  void normalize();
+  int total;  ///< Total de segundos desde 00:00:00.
 };
+
+#include "../src/hours.hpp"
@@ -0,0 +1,236 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hours.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @brief Coluna de tempos otimizada para agregações sobre muitos valores.
+ *
+ * Os tempos são guardados como totais de segundos, em blocos de
+ * `block_size` valores contíguos. Cada bloco fechado é codificado em
+ * relação ao seu menor valor (frame of reference): se a diferença entre o
+ * maior e o menor valor couber em 16 bits, como acontece com registros
+ * próximos no tempo, os valores ocupam 2 bytes em vez de 4. Cada bloco
+ * também guarda o seu mínimo, máximo e soma, de modo que `sum`, `min` e
+ * `max` custam O(número de blocos) e os filtros por intervalo pulam os
+ * blocos inteiramente dentro ou fora do intervalo.
+ *
+ * Os blocos que o filtro precisa percorrer são processados com AVX2 quando
+ * o processador tem suporte, com uma versão escalar nos demais casos. Com
+ * `set_threads`, os filtros e os histogramas dividem os blocos entre várias
+ * threads.
+ *
+ * Os valores são adicionados ao final; o último bloco fica aberto, sem
+ * codificação, até ser completado.
+ */
+class HoursColumn {
+ public:
+  /// Número de valores em cada bloco.
+  static constexpr size_t block_size = 1024;
+
+  /**
+   * @brief Construtor padrão. Cria uma coluna vazia.
+   */
+  HoursColumn();
+
+  /**
+   * @brief Construtor. Cria uma coluna com os tempos de uma lista.
+   * @param list Os tempos, na ordem em que serão armazenados.
+   */
+  HoursColumn(const VectorList<Hours> &list);
+
+  /**
+   * @brief Construtor. Cria uma coluna a partir de totais de segundos, como
+   * os gravados por `parse_hours`.
+   * @param seconds Os totais de segundos.
+   * @param count Número de valores.
+   */
+  HoursColumn(const int *seconds, size_t count);
+
+  /**
+   * @brief Destruidor. Libera os blocos.
+   */
+  ~HoursColumn();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other A coluna a ser copiada.
+   */
+  HoursColumn(const HoursColumn &other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other A coluna a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  HoursColumn &operator=(const HoursColumn &other);
+
+  /**
+   * @brief Retorna o número de tempos armazenados.
+   * @return O tamanho da coluna.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a coluna está vazia.
+   * @return Verdadeiro se não houver tempos, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna o número de bytes ocupados pelos valores e pelos
+   * metadados dos blocos.
+   * @return O uso de memória, em bytes.
+   */
+  size_t memory_usage() const;
+
+  /**
+   * @brief Define quantas threads as agregações podem usar.
+   * @param threads Número de threads (0 usa uma por núcleo).
+   */
+  void set_threads(unsigned threads);
+
+  /**
+   * @brief Retorna quantas threads as agregações podem usar.
+   * @return Número de threads.
+   */
+  unsigned threads() const;
+
+  /**
+   * @brief Adiciona um tempo ao final da coluna.
+   * @param time O tempo.
+   */
+  void push_back(const Hours &time);
+
+  /**
+   * @brief Adiciona um total de segundos ao final da coluna.
+   * @param seconds O total de segundos.
+   */
+  void push_back_seconds(int seconds);
+
+  /**
+   * @brief Acesso ao tempo na posição especificada.
+   * @param index O índice do tempo.
+   * @return O tempo no índice especificado.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  Hours operator[](size_t index) const;
+
+  /**
+   * @brief Remove todos os tempos.
+   */
+  void clear();
+
+  /**
+   * @brief Soma todos os tempos.
+   * @return A soma, em segundos.
+   */
+  long long sum() const;
+
+  /**
+   * @brief Retorna o menor tempo.
+   * @return O menor tempo.
+   * @throw std::out_of_range Se a coluna estiver vazia.
+   */
+  Hours min() const;
+
+  /**
+   * @brief Retorna o maior tempo.
+   * @return O maior tempo.
+   * @throw std::out_of_range Se a coluna estiver vazia.
+   */
+  Hours max() const;
+
+  /**
+   * @brief Conta os tempos em um intervalo fechado.
+   * @param lo O início do intervalo.
+   * @param hi O fim do intervalo.
+   * @return Número de tempos `t` com `lo <= t <= hi`.
+   */
+  size_t count_between(const Hours &lo, const Hours &hi) const;
+
+  /**
+   * @brief Soma os tempos em um intervalo fechado.
+   * @param lo O início do intervalo.
+   * @param hi O fim do intervalo.
+   * @return A soma, em segundos, dos tempos `t` com `lo <= t <= hi`.
+   */
+  long long sum_between(const Hours &lo, const Hours &hi) const;
+
+  /**
+   * @brief Conta os tempos em faixas de mesma largura a partir de 00:00:00.
+   *
+   * O tempo `t` cai na faixa `t.to_seconds() / width`; tempos negativos ou
+   * além da última faixa são ignorados. Por exemplo, `histogram(3600,
+   * counts, 24)` conta os tempos de cada hora do dia, e `histogram(60,
+   * counts, 1440)` os de cada minuto.
+   *
+   * @param width Largura de cada faixa, em segundos.
+   * @param counts Recebe a contagem de cada faixa (é zerado antes).
+   * @param buckets Número de faixas.
+   * @throw std::invalid_argument Se a largura não for positiva.
+   */
+  void histogram(int width, size_t *counts, size_t buckets) const;
+
+ private:
+  /**
+   * @brief Metadados de um bloco fechado.
+   */
+  struct Block {
+    int min;         ///< Menor valor do bloco, base da codificação.
+    int max;         ///< Maior valor do bloco.
+    long long sum;   ///< Soma dos valores do bloco.
+    size_t offset;   ///< Posição do primeiro valor em `narrow` ou `wide`.
+    bool is_narrow;  ///< Se os valores estão em `narrow`.
+  };
+
+  /**
+   * @brief Codifica o bloco aberto e inicia um novo.
+   */
+  void seal();
+
+  /**
+   * @brief Conta e soma os valores de um bloco em um intervalo fechado.
+   * @param block Índice do bloco (o bloco aberto é o último).
+   * @param lo Início do intervalo, em segundos.
+   * @param hi Fim do intervalo, em segundos.
+   * @param count Recebe o acréscimo na contagem.
+   * @param sum Recebe o acréscimo na soma.
+   */
+  void scan_block(size_t block, int lo, int hi, size_t &count,
+                  long long &sum) const;
+
+  /**
+   * @brief Acumula em um histograma os valores de um bloco.
+   * @param block Índice do bloco (o bloco aberto é o último).
+   * @param width Largura de cada faixa, em segundos.
+   * @param counts Contagem de cada faixa.
+   * @param buckets Número de faixas.
+   */
+  void histogram_block(size_t block, int width, size_t *counts,
+                       size_t buckets) const;
+
+  /**
+   * @brief Executa `f(primeiro, ultimo, thread)` sobre partes contíguas dos
+   * blocos, em paralelo.
+   * @param f Função que processa os blocos `[primeiro, ultimo)`.
+   * @return Número de partes usadas.
+   */
+  template <class F>
+  unsigned parallel_blocks(F f) const;
+
+  Block *blocks;          ///< Metadados dos blocos fechados.
+  size_t block_count;     ///< Número de blocos fechados.
+  size_t block_capacity;  ///< Capacidade de `blocks`.
+  uint16_t *narrow;       ///< Valores dos blocos de 16 bits.
+  size_t narrow_size;     ///< Número de valores em `narrow`.
+  size_t narrow_capacity; ///< Capacidade de `narrow`.
+  int *wide;              ///< Valores dos blocos de 32 bits.
+  size_t wide_size;       ///< Número de valores em `wide`.
+  size_t wide_capacity;   ///< Capacidade de `wide`.
+  int *open;              ///< Valores do bloco aberto.
+  size_t open_size;       ///< Número de valores do bloco aberto.
+  unsigned _threads;      ///< Número de threads das agregações.
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+#include "hours.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @brief Resultado de uma leitura em lote de tempos.
+ */
+struct HoursParseResult {
+  size_t lines;     ///< Número de linhas lidas.
+  size_t parsed;    ///< Número de linhas com um tempo válido.
+  size_t malformed; ///< Número de linhas inválidas.
+};
+
+/**
+ * @brief Função chamada para cada linha inválida.
+ *
+ * Recebe o número da linha (a partir de 1) e o intervalo com o seu conteúdo,
+ * sem a quebra de linha.
+ */
+using MalformedLineCallback =
+    std::function<void(size_t line, const char* first, const char* last)>;
+
+/**
+ * @brief Verifica se a leitura em lote pode usar instruções SIMD (AVX2)
+ * neste processador.
+ * @return Verdadeiro se o caminho vetorizado estiver disponível.
+ */
+bool hours_parser_has_simd();
+
+/**
+ * @brief Lê um tempo "HH:MM:SS" por linha e grava os totais de segundos em
+ * um arranjo.
+ *
+ * O texto pode estar em qualquer região de memória, inclusive em um arquivo
+ * mapeado com `mmap`. As linhas terminam em "\n" ou "\r\n", e a última pode
+ * não ter quebra. Cada linha deve conter exatamente um tempo no formato de
+ * `Hours::from_chars`; as demais são contadas como inválidas e informadas a
+ * `on_malformed`.
+ *
+ * Quando o processador tem AVX2, blocos de 8 linhas consecutivas no formato
+ * fixo "HH:MM:SS\n" são validados e convertidos de uma só vez; as demais
+ * linhas (horas com mais de dois dígitos, sinal, "\r\n" ou linhas
+ * inválidas) seguem pelo caminho escalar.
+ *
+ * @param first Início do texto.
+ * @param last Fim do texto.
+ * @param seconds Arranjo que recebe os tempos válidos, em ordem.
+ * @param capacity Tamanho do arranjo.
+ * @param on_malformed Função chamada para cada linha inválida (opcional).
+ * @param use_simd Falso para forçar o caminho escalar.
+ * @return Contagem de linhas lidas, válidas e inválidas.
+ * @throw std::length_error Se houver mais tempos válidos que `capacity`.
+ */
+HoursParseResult parse_hours(const char* first, const char* last,
+                             int* seconds, size_t capacity,
+                             const MalformedLineCallback& on_malformed = nullptr,
+                             bool use_simd = true);
+
+/**
+ * @brief Lê um tempo "HH:MM:SS" por linha e adiciona os tempos válidos ao
+ * final de uma VectorList.
+ *
+ * Segue as mesmas regras da versão que grava em um arranjo de segundos.
+ *
+ * @param first Início do texto.
+ * @param last Fim do texto.
+ * @param list Lista que recebe os tempos válidos, em ordem.
+ * @param on_malformed Função chamada para cada linha inválida (opcional).
+ * @param use_simd Falso para forçar o caminho escalar.
+ * @return Contagem de linhas lidas, válidas e inválidas.
+ * @throw std::length_error Se a capacidade da lista for excedida.
+ */
+HoursParseResult parse_hours(const char* first, const char* last,
+                             VectorList<Hours>& list,
+                             const MalformedLineCallback& on_malformed = nullptr,
+                             bool use_simd = true);
@@ -0,0 +1,361 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+/**
+ * @class IndexedSequence
+ * @brief Sequência de elementos com acesso, inserção e remoção por índice em
+ * O(log n).
+ *
+ * A VectorList insere no meio em O(n) porque desloca os elementos seguintes,
+ * e a LinkedList porque precisa caminhar até a posição. A IndexedSequence
+ * guarda os elementos em uma treap implícita: uma árvore binária cuja ordem
+ * em-ordem é a ordem da sequência, balanceada por prioridades aleatórias, e
+ * em que cada nó sabe quantos elementos há na sua subárvore. Assim, o índice
+ * de um elemento é descoberto durante a descida, sem chave armazenada.
+ *
+ * Cada nó guarda um bloco de até `Chunk` elementos contíguos, o que reduz o
+ * número de nós, a altura da árvore e os saltos de ponteiro. Inserir em um
+ * bloco cheio o divide ao meio; um bloco que fica vazio é liberado.
+ *
+ * Além da interface das outras listas, a sequência pode ser cortada em duas
+ * (`split`) e concatenada com outra (`concat`), também em O(log n).
+ *
+ * @tparam T Tipo dos elementos armazenados na sequência.
+ * @tparam Chunk Número máximo de elementos em cada nó.
+ */
+template <class T, size_t Chunk = 64>
+class IndexedSequence {
+  static_assert(Chunk >= 2, "Cada bloco precisa de ao menos dois elementos");
+
+  /**
+   * @struct Node
+   * @brief Nó da árvore, com um bloco de elementos contíguos.
+   */
+  struct Node {
+    /**
+     * @brief Construtor do nó. Cria um nó vazio, sem filhos.
+     * @param priority Prioridade do nó na treap.
+     */
+    Node(uint32_t priority);
+
+    Node *left;         /**< Subárvore com os elementos anteriores. */
+    Node *right;        /**< Subárvore com os elementos posteriores. */
+    uint32_t priority;  /**< Prioridade, maior que a dos filhos. */
+    size_t count;       /**< Número de elementos no bloco. */
+    size_t total;       /**< Número de elementos na subárvore. */
+    T values[Chunk];    /**< Elementos do bloco, em ordem. */
+  };
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria uma sequência vazia.
+   */
+  IndexedSequence();
+
+  /**
+   * @brief Destruidor. Libera todos os nós.
+   */
+  ~IndexedSequence();
+
+  /**
+   * @brief Construtor de cópia.
+   *
+   * @param other A sequência a ser copiada.
+   */
+  IndexedSequence(const IndexedSequence &other);
+
+  /**
+   * @brief Construtor de movimento. Os nós passam para a nova sequência, e
+   * `other` fica vazia.
+   *
+   * @param other A sequência a ser movida.
+   */
+  IndexedSequence(IndexedSequence &&other);
+
+  /**
+   * @brief Operador de atribuição.
+   *
+   * @param other A sequência a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  IndexedSequence &operator=(const IndexedSequence &other);
+
+  /**
+   * @brief Operador de atribuição por movimento. Os nós de `other` passam
+   * para esta sequência, e `other` fica vazia.
+   *
+   * @param other A sequência a ser movida.
+   * @return Uma referência para o objeto da classe.
+   */
+  IndexedSequence &operator=(IndexedSequence &&other);
+
+  /**
+   * @brief Retorna o número de elementos armazenados na sequência.
+   *
+   * @return O tamanho atual da sequência.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a sequência está vazia.
+   *
+   * @return Verdadeiro se a sequência estiver vazia, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Adiciona um elemento no início da sequência.
+   *
+   * @param value O valor do elemento a ser adicionado.
+   */
+  void push_front(const T &value);
+
+  /**
+   * @brief Adiciona um elemento no final da sequência.
+   *
+   * @param value O valor do elemento a ser adicionado.
+   */
+  void push_back(const T &value);
+
+  /**
+   * @brief Insere um elemento na posição especificada em O(log n).
+   *
+   * @param index O índice onde o elemento será inserido.
+   * @param value O valor do elemento a ser inserido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void insert(size_t index, const T &value);
+
+  /**
+   * @brief Remove o primeiro elemento da sequência.
+   *
+   * @throw std::out_of_range Se a sequência estiver vazia.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o último elemento da sequência.
+   *
+   * @throw std::out_of_range Se a sequência estiver vazia.
+   */
+  void pop_back();
+
+  /**
+   * @brief Remove o elemento na posição especificada em O(log n).
+   *
+   * @param index O índice do elemento a ser removido.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  void remove(size_t index);
+
+  /**
+   * @brief Limpa todos os elementos da sequência.
+   */
+  void clear();
+
+  /**
+   * @brief Corta a sequência em duas.
+   *
+   * Os elementos a partir de `index` são movidos para a sequência retornada,
+   * e esta fica apenas com os anteriores.
+   *
+   * @param index O índice do primeiro elemento da segunda parte.
+   * @return A sequência com os elementos a partir de `index`.
+   * @throw std::out_of_range Se o índice for maior que o tamanho.
+   */
+  IndexedSequence split(size_t index);
+
+  /**
+   * @brief Acrescenta todos os elementos de outra sequência ao final desta.
+   *
+   * Os nós são religados, sem cópia dos elementos, e `other` fica vazia.
+   *
+   * @param other A sequência a ser concatenada.
+   */
+  void concat(IndexedSequence &other);
+
+  /**
+   * @brief Encontra um elemento na sequência.
+   *
+   * @param item O elemento a ser buscado.
+   * @return A referência para o elemento encontrado.
+   * @throw std::out_of_range Se o elemento não for encontrado.
+   */
+  T &find(const T &item);
+
+  /**
+   * @brief Encontra um elemento na sequência (const).
+   *
+   * @param item O elemento a ser buscado.
+   * @return A referência constante para o elemento encontrado.
+   * @throw std::out_of_range Se o elemento não for encontrado.
+   */
+  const T &find(const T &item) const;
+
+  /**
+   * @brief Verifica se um elemento está contido na sequência.
+   *
+   * @param item O elemento a ser verificado.
+   * @return Verdadeiro se o elemento estiver na sequência, caso contrário
+   * falso.
+   */
+  bool contains(const T &item) const;
+
+  /**
+   * @brief Acesso ao elemento na posição especificada em O(log n).
+   *
+   * @param index O índice do elemento.
+   * @return A referência para o elemento no índice especificado.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  T &operator[](size_t index);
+
+  /**
+   * @brief Acesso ao elemento na posição especificada (const).
+   *
+   * @param index O índice do elemento.
+   * @return A referência constante para o elemento no índice especificado.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  const T &operator[](size_t index) const;
+
+  /**
+   * @brief Imprime os elementos da sequência no formato "elemento1,
+   * elemento2, ...".
+   */
+  void print() const;
+
+ private:
+  /**
+   * @brief Retorna o número de elementos de uma subárvore.
+   *
+   * @param node A raiz da subárvore (pode ser nullptr).
+   * @return O número de elementos.
+   */
+  static size_t total_of(const Node *node);
+
+  /**
+   * @brief Recalcula o total de um nó a partir dos filhos.
+   *
+   * @param node O nó a ser atualizado.
+   */
+  static void update(Node *node);
+
+  /**
+   * @brief Gira uma subárvore para a direita, subindo o filho esquerdo.
+   *
+   * @param node A raiz da subárvore.
+   * @return A nova raiz.
+   */
+  static Node *rotate_right(Node *node);
+
+  /**
+   * @brief Gira uma subárvore para a esquerda, subindo o filho direito.
+   *
+   * @param node A raiz da subárvore.
+   * @return A nova raiz.
+   */
+  static Node *rotate_left(Node *node);
+
+  /**
+   * @brief Une duas árvores, com todos os elementos de `left` antes dos de
+   * `right`.
+   *
+   * @param left A primeira árvore.
+   * @param right A segunda árvore.
+   * @return A raiz da árvore resultante.
+   */
+  static Node *merge(Node *left, Node *right);
+
+  /**
+   * @brief Copia uma subárvore inteira.
+   *
+   * @param node A raiz da subárvore.
+   * @return A raiz da cópia.
+   */
+  static Node *clone(const Node *node);
+
+  /**
+   * @brief Libera uma subárvore inteira.
+   *
+   * @param node A raiz da subárvore.
+   */
+  static void destroy(Node *node);
+
+  /**
+   * @brief Sorteia a prioridade de um novo nó.
+   *
+   * @return A prioridade sorteada.
+   */
+  uint32_t next_priority();
+
+  /**
+   * @brief Insere um elemento em uma subárvore.
+   *
+   * @param node A raiz da subárvore.
+   * @param index O índice de inserção, relativo à subárvore.
+   * @param value O valor a ser inserido.
+   * @return A nova raiz da subárvore.
+   */
+  Node *insert_into(Node *node, size_t index, const T &value);
+
+  /**
+   * @brief Insere um nó antes de todos os outros de uma subárvore.
+   *
+   * @param node A raiz da subárvore.
+   * @param first O nó a ser inserido.
+   * @return A nova raiz da subárvore.
+   */
+  static Node *insert_first(Node *node, Node *first);
+
+  /**
+   * @brief Remove um elemento de uma subárvore.
+   *
+   * @param node A raiz da subárvore.
+   * @param index O índice do elemento, relativo à subárvore.
+   * @return A nova raiz da subárvore.
+   */
+  static Node *remove_from(Node *node, size_t index);
+
+  /**
+   * @brief Separa os primeiros `index` elementos de uma subárvore.
+   *
+   * @param node A raiz da subárvore.
+   * @param index Número de elementos da primeira parte.
+   * @return As raízes das duas partes.
+   */
+  static std::pair<Node *, Node *> split_at(Node *node, size_t index);
+
+  /**
+   * @brief Localiza o elemento em uma posição.
+   *
+   * @param index O índice do elemento (deve ser menor que `size()`).
+   * @return Ponteiro para o elemento.
+   */
+  T *element_at(size_t index) const;
+
+  /**
+   * @brief Procura um elemento, percorrendo uma subárvore em ordem.
+   *
+   * @param node A raiz da subárvore.
+   * @param item O elemento a ser buscado.
+   * @return Ponteiro para o elemento, ou nullptr se ele não for encontrado.
+   */
+  static T *find_in(Node *node, const T &item);
+
+  /**
+   * @brief Imprime os elementos de uma subárvore, em ordem.
+   *
+   * @param node A raiz da subárvore.
+   */
+  static void print_from(const Node *node);
+
+  Node *root;     /**< Raiz da árvore (nullptr se a sequência estiver
+                     vazia). */
+  uint32_t seed;  /**< Estado do gerador de prioridades. */
+};
+
+#include "../src/indexed_sequence.hpp"
@@ -0,0 +1,266 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pair.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @class IntervalTree
+ * @brief Árvore de intervalos fechados `[start, end]`, com consultas de
+ * sobreposição em O(log n + k).
+ *
+ * Os intervalos ficam em uma treap ordenada pelo início (e pelo fim, em caso
+ * de empate), como na IndexedSequence. Cada nó guarda também o maior fim da
+ * sua subárvore, o que permite descartar subárvores inteiras: nenhuma
+ * subárvore cujo maior fim é anterior à consulta, nem nenhum nó que começa
+ * depois dela, é visitado. Inserir e remover custam O(log n) esperado.
+ *
+ * Como na TimerWheel, os nós ficam em um único arranjo e são ligados por
+ * índices de 32 bits; os nós removidos são reaproveitados. A construção a
+ * partir de uma lista ordena os intervalos e monta a treap em O(n log n),
+ * sem rotações.
+ *
+ * Intervalos repetidos são permitidos; `erase` remove uma das cópias.
+ *
+ * @tparam T Tipo dos extremos, como Hours. Precisa apenas de `operator<`.
+ */
+template <class T>
+class IntervalTree {
+ private:
+  /**
+   * @brief Estrutura que representa um nó no arranjo.
+   */
+  struct Node {
+    T start;           ///< Início do intervalo.
+    T end;             ///< Fim do intervalo.
+    T max_end;         ///< Maior fim da subárvore.
+    uint32_t left;     ///< Índice do filho esquerdo.
+    uint32_t right;    ///< Índice do filho direito.
+    uint32_t priority; ///< Prioridade aleatória (heap de máximo).
+  };
+
+  static constexpr uint32_t npos = UINT32_MAX; ///< Índice nulo.
+
+ public:
+  /**
+   * @brief Construtor padrão. Cria uma árvore vazia.
+   */
+  IntervalTree();
+
+  /**
+   * @brief Construtor. Cria uma árvore com os intervalos de uma lista.
+   * @param intervals Os intervalos, como pares (início, fim).
+   * @throw std::invalid_argument Se algum intervalo começar depois de
+   * terminar.
+   */
+  IntervalTree(const VectorList<Pair<T, T>> &intervals);
+
+  /**
+   * @brief Destruidor. Libera o arranjo de nós.
+   */
+  ~IntervalTree();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other A árvore a ser copiada.
+   */
+  IntervalTree(const IntervalTree &other);
+
+  /**
+   * @brief Construtor de movimento. A outra árvore fica vazia.
+   * @param other A árvore a ser movida.
+   */
+  IntervalTree(IntervalTree &&other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other A árvore a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  IntervalTree &operator=(const IntervalTree &other);
+
+  /**
+   * @brief Operador de atribuição por movimento. A outra árvore fica vazia.
+   * @param other A árvore a ser movida.
+   * @return Uma referência para o objeto da classe.
+   */
+  IntervalTree &operator=(IntervalTree &&other);
+
+  /**
+   * @brief Obtém o número de intervalos.
+   * @return O tamanho da árvore.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a árvore está vazia.
+   * @return Verdadeiro se não houver intervalos.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Garante espaço para `capacity` intervalos sem realocar o arranjo.
+   * @param capacity Número de intervalos desejado.
+   * @throw std::length_error Se a capacidade não couber em índices de 32
+   * bits.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Insere um intervalo.
+   * @param start O início do intervalo.
+   * @param end O fim do intervalo.
+   * @throw std::invalid_argument Se `end < start`.
+   */
+  void insert(const T &start, const T &end);
+
+  /**
+   * @brief Insere um intervalo.
+   * @param interval O intervalo, como um par (início, fim).
+   * @throw std::invalid_argument Se o intervalo começar depois de terminar.
+   */
+  void insert(const Pair<T, T> &interval);
+
+  /**
+   * @brief Remove um intervalo.
+   * @param start O início do intervalo.
+   * @param end O fim do intervalo.
+   * @return Verdadeiro se o intervalo estava na árvore.
+   */
+  bool erase(const T &start, const T &end);
+
+  /**
+   * @brief Verifica se um intervalo está na árvore.
+   * @param start O início do intervalo.
+   * @param end O fim do intervalo.
+   * @return Verdadeiro se o intervalo estiver na árvore.
+   */
+  bool contains(const T &start, const T &end) const;
+
+  /**
+   * @brief Visita os intervalos que se sobrepõem a `[start, end]`, em ordem
+   * de início.
+   *
+   * Um intervalo `[s, e]` se sobrepõe à consulta se `s <= end` e
+   * `start <= e`; intervalos que apenas se tocam nos extremos contam.
+   *
+   * @param start O início da consulta.
+   * @param end O fim da consulta.
+   * @param visit Função chamada com o início e o fim de cada intervalo.
+   * @return Número de intervalos visitados.
+   * @throw std::invalid_argument Se `end < start`.
+   */
+  template <class F>
+  size_t overlapping(const T &start, const T &end, F visit) const;
+
+  /**
+   * @brief Visita os intervalos que contêm um instante, em ordem de início.
+   * @param time O instante.
+   * @param visit Função chamada com o início e o fim de cada intervalo.
+   * @return Número de intervalos visitados.
+   */
+  template <class F>
+  size_t stabbing(const T &time, F visit) const;
+
+  /**
+   * @brief Visita todos os intervalos, em ordem de início.
+   * @param visit Função chamada com o início e o fim de cada intervalo.
+   */
+  template <class F>
+  void for_each(F visit) const;
+
+  /**
+   * @brief Remove todos os intervalos.
+   */
+  void clear();
+
+ private:
+  /**
+   * @brief Compara dois intervalos pelo início e, em seguida, pelo fim.
+   */
+  static bool less(const T &start, const T &end, const Node &node);
+
+  /**
+   * @brief Sorteia a prioridade de um novo nó.
+   */
+  uint32_t next_priority();
+
+  /**
+   * @brief Obtém um nó livre, reaproveitando os removidos.
+   */
+  uint32_t allocate_node();
+
+  /**
+   * @brief Devolve um nó à lista de livres.
+   */
+  void release_node(uint32_t index);
+
+  /**
+   * @brief Recalcula o maior fim da subárvore de um nó.
+   */
+  void update(uint32_t index);
+
+  /**
+   * @brief Recalcula o maior fim de todos os nós de uma subárvore.
+   */
+  void update_all(uint32_t index);
+
+  /**
+   * @brief Gira uma subárvore para a direita, subindo o filho esquerdo.
+   *
+   * @param index A raiz da subárvore.
+   * @return A nova raiz.
+   */
+  uint32_t rotate_right(uint32_t index);
+
+  /**
+   * @brief Gira uma subárvore para a esquerda, subindo o filho direito.
+   *
+   * @param index A raiz da subárvore.
+   * @return A nova raiz.
+   */
+  uint32_t rotate_left(uint32_t index);
+
+  /**
+   * @brief Une duas subárvores, sendo todos os intervalos de `left` menores
+   * que os de `right`.
+   */
+  uint32_t merge(uint32_t left, uint32_t right);
+
+  /**
+   * @brief Insere um nó já preenchido na subárvore.
+   * @return A nova raiz da subárvore.
+   */
+  uint32_t insert_into(uint32_t index, uint32_t node);
+
+  /**
+   * @brief Remove um intervalo da subárvore.
+   * @return A nova raiz da subárvore.
+   */
+  uint32_t erase_from(uint32_t index, const T &start, const T &end,
+                      bool &found);
+
+  /**
+   * @brief Visita os intervalos da subárvore que se sobrepõem à consulta.
+   */
+  template <class F>
+  size_t visit_overlapping(uint32_t index, const T &start, const T &end,
+                           F &visit) const;
+
+  /**
+   * @brief Visita todos os intervalos da subárvore, em ordem.
+   */
+  template <class F>
+  void visit_all(uint32_t index, F &visit) const;
+
+  Node *nodes;        ///< Arranjo de nós.
+  uint32_t root;      ///< Índice da raiz.
+  uint32_t free_head; ///< Primeiro nó livre (ligados por `left`).
+  uint32_t used;      ///< Número de posições já usadas do arranjo.
+  size_t _size;       ///< Número de intervalos.
+  size_t _capacity;   ///< Tamanho do arranjo.
+  uint32_t seed;      ///< Estado do gerador de prioridades.
+};
+
+#include "../src/interval_tree.hpp"
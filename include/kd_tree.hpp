@@ -0,0 +1,169 @@
+#pragma once
+#include <stddef.h>
+
+#include "point.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @class KdTree
+ * @brief Índice espacial estático (árvore k-d) para consultas de vizinhos
+ * mais próximos e de raio sobre pontos.
+ *
+ * A árvore não tem nós com ponteiros: os pontos ficam em um único arranjo,
+ * arrumado de modo que o ponto do meio de cada trecho `[lo, hi)` é a raiz da
+ * subárvore, com os pontos de coordenada menor à esquerda e os de
+ * coordenada maior à direita. A coordenada comparada alterna entre x e y a
+ * cada nível. Trechos com até `leaf_size` pontos não são divididos e são
+ * percorridos em sequência, o que aproveita melhor a cache.
+ *
+ * As consultas descem primeiro pelo lado do ponto consultado e só visitam o
+ * outro lado se a faixa de divisão estiver mais perto que o melhor
+ * resultado até então, comparando distâncias ao quadrado (sem raiz).
+ *
+ * Os resultados são os índices dos pontos na sequência usada para construir
+ * a árvore.
+ */
+class KdTree {
+ public:
+  /// Maior número de pontos de um trecho percorrido em sequência.
+  static constexpr size_t leaf_size = 8;
+
+  /**
+   * @brief Construtor. Cria uma árvore a partir de um arranjo de pontos.
+   * @param first Início do arranjo.
+   * @param last Fim do arranjo.
+   * @param threads Número de threads da construção (0 usa uma por núcleo).
+   */
+  KdTree(const Point *first, const Point *last, unsigned threads = 1);
+
+  /**
+   * @brief Construtor. Cria uma árvore com os pontos de uma lista.
+   * @param points Os pontos.
+   * @param threads Número de threads da construção (0 usa uma por núcleo).
+   */
+  KdTree(const VectorList<Point> &points, unsigned threads = 1);
+
+  /**
+   * @brief Destruidor. Libera o arranjo de pontos.
+   */
+  ~KdTree();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other A árvore a ser copiada.
+   */
+  KdTree(const KdTree &other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other A árvore a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  KdTree &operator=(const KdTree &other);
+
+  /**
+   * @brief Obtém o número de pontos.
+   * @return O tamanho da árvore.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a árvore está vazia.
+   * @return Verdadeiro se não houver pontos.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Encontra o ponto mais próximo.
+   * @param query O ponto consultado.
+   * @return O índice do ponto mais próximo.
+   * @throw std::out_of_range Se a árvore estiver vazia.
+   */
+  size_t nearest(const Point &query) const;
+
+  /**
+   * @brief Encontra os `k` pontos mais próximos.
+   * @param query O ponto consultado.
+   * @param k Número de pontos desejado.
+   * @param indices Recebe os índices, do mais próximo ao mais distante
+   * (deve ter espaço para `k` valores).
+   * @return Número de índices gravados, o menor entre `k` e `size()`.
+   */
+  size_t k_nearest(const Point &query, size_t k, size_t *indices) const;
+
+  /**
+   * @brief Encontra os pontos a uma distância de até `radius`.
+   * @param query O ponto consultado.
+   * @param radius O raio.
+   * @param indices Lista que recebe os índices, sem ordem definida.
+   * @return Número de pontos encontrados.
+   * @throw std::length_error Se a capacidade da lista for excedida.
+   */
+  size_t within_radius(const Point &query, double radius,
+                       VectorList<size_t> &indices) const;
+
+  /**
+   * @brief Conta os pontos a uma distância de até `radius`.
+   * @param query O ponto consultado.
+   * @param radius O raio.
+   * @return Número de pontos encontrados.
+   */
+  size_t count_within_radius(const Point &query, double radius) const;
+
+ private:
+  /**
+   * @brief Um ponto no arranjo da árvore.
+   */
+  struct Entry {
+    double x;     ///< Coordenada x.
+    double y;     ///< Coordenada y.
+    size_t index; ///< Posição do ponto na sequência original.
+  };
+
+  /**
+   * @brief Um candidato da busca pelos `k` mais próximos.
+   */
+  struct Candidate {
+    double distance; ///< Distância ao quadrado até o ponto consultado.
+    size_t index;    ///< Posição do ponto na sequência original.
+  };
+
+  /**
+   * @brief Monta a árvore sobre os pontos já copiados para `entries`.
+   * @param threads Número de threads (0 usa uma por núcleo).
+   */
+  void build(unsigned threads);
+
+  /**
+   * @brief Arruma o trecho `[lo, hi)` como uma subárvore.
+   * @param depth Nível da subárvore, que define a coordenada comparada.
+   * @param threads Threads disponíveis para este trecho.
+   */
+  void build_range(size_t lo, size_t hi, size_t depth, unsigned threads);
+
+  /**
+   * @brief Busca o ponto mais próximo no trecho `[lo, hi)`.
+   */
+  void search_nearest(size_t lo, size_t hi, size_t depth, double x, double y,
+                      size_t &best, double &best_distance) const;
+
+  /**
+   * @brief Busca os `k` pontos mais próximos no trecho `[lo, hi)`.
+   * @param heap Heap de máximo com os melhores candidatos até então.
+   * @param heap_size Número de candidatos no heap.
+   */
+  void search_k_nearest(size_t lo, size_t hi, size_t depth, double x,
+                        double y, size_t k, Candidate *heap,
+                        size_t &heap_size) const;
+
+  /**
+   * @brief Visita os pontos do trecho `[lo, hi)` a uma distância ao
+   * quadrado de até `radius_squared`.
+   */
+  template <class F>
+  void search_radius(size_t lo, size_t hi, size_t depth, double x, double y,
+                     double radius_squared, F &visit) const;
+
+  Entry *entries; ///< Pontos na ordem da árvore.
+  size_t _size;   ///< Número de pontos.
+};
@@ -0,0 +1,226 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+#include "doubly_linked_list.hpp"
+#include "hash_index.hpp"
+
+/**
+ * @class LfuCache
+ * @brief Cache que descarta primeiro a entrada usada menos vezes (LFU).
+ *
+ * As entradas ficam em uma única DoublyLinkedList ordenada pela frequência
+ * de uso, da menor para a maior. Entradas com a mesma frequência formam um
+ * grupo contíguo, da usada há mais tempo para a mais recente, de modo que o
+ * início da lista é sempre a próxima entrada a ser descartada (em caso de
+ * empate, a menos recente).
+ *
+ * Uma HashIndex associa cada chave ao nó da sua entrada, e outra associa
+ * cada frequência ao último nó do seu grupo. Um acesso move a entrada para
+ * o final do grupo seguinte com `splice`, então consultar, inserir e
+ * descartar custam O(1) esperado.
+ *
+ * A capacidade é medida pela soma dos pesos das entradas, como na LruCache.
+ *
+ * @tparam K Tipo das chaves.
+ * @tparam V Tipo dos valores.
+ * @tparam Hash Função hash usada para as chaves.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class LfuCache {
+  /**
+   * @struct Entry
+   * @brief Entrada armazenada na lista de frequências.
+   */
+  struct Entry {
+    K key;            /**< Chave da entrada. */
+    V value;          /**< Valor da entrada. */
+    size_t weight;    /**< Peso da entrada na capacidade. */
+    size_t frequency; /**< Número de usos da entrada. */
+  };
+
+ public:
+  /// Função que calcula o peso de uma entrada.
+  using Weigher = std::function<size_t(const K &, const V &)>;
+
+  /// Função chamada para cada entrada descartada pela cache.
+  using EvictionCallback = std::function<void(const K &, const V &)>;
+
+  /**
+   * @brief Construtor. Cria uma cache vazia.
+   *
+   * @param capacity A soma máxima dos pesos das entradas.
+   * @param weigher Função que calcula o peso de cada entrada (se vazia, cada
+   * entrada pesa 1).
+   */
+  LfuCache(size_t capacity, Weigher weigher = nullptr);
+
+  /**
+   * @brief A cópia não é permitida, pois os índices guardam iteradores para
+   * a lista da própria cache.
+   */
+  LfuCache(const LfuCache &) = delete;
+
+  /**
+   * @brief A atribuição não é permitida, pois os índices guardam iteradores
+   * para a lista da própria cache.
+   */
+  LfuCache &operator=(const LfuCache &) = delete;
+
+  /**
+   * @brief Retorna o número de entradas armazenadas.
+   *
+   * @return O número de entradas.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a cache está vazia.
+   *
+   * @return Verdadeiro se não houver entradas, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna a soma máxima dos pesos das entradas.
+   *
+   * @return A capacidade da cache.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Retorna a soma atual dos pesos das entradas.
+   *
+   * @return O peso total armazenado.
+   */
+  size_t weight() const;
+
+  /**
+   * @brief Busca o valor de uma chave e incrementa sua frequência.
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro para o valor, ou nullptr se a chave não estiver na
+   * cache.
+   */
+  V *get(const K &key);
+
+  /**
+   * @brief Verifica se uma chave está na cache, sem alterar a frequência nem
+   * os contadores.
+   *
+   * @param key A chave procurada.
+   * @return Verdadeiro se a chave estiver na cache, caso contrário falso.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Retorna a frequência de uso de uma chave.
+   *
+   * @param key A chave procurada.
+   * @return O número de usos da chave, ou 0 se ela não estiver na cache.
+   */
+  size_t frequency(const K &key) const;
+
+  /**
+   * @brief Insere ou atualiza uma entrada.
+   *
+   * Uma entrada nova começa com frequência 1; atualizar uma entrada
+   * existente conta como um uso. Se a capacidade for excedida, as entradas
+   * menos usadas são descartadas. Uma entrada mais pesada que a capacidade
+   * inteira não é armazenada, e a cache fica como estava.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   */
+  void put(const K &key, const V &value);
+
+  /**
+   * @brief Remove uma entrada, sem contá-la como descarte.
+   *
+   * @param key A chave a ser removida.
+   * @return Verdadeiro se a chave existia, caso contrário falso.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Descarta a entrada menos usada (a menos recente, em caso de
+   * empate).
+   *
+   * @throw std::out_of_range Se a cache estiver vazia.
+   */
+  void evict();
+
+  /**
+   * @brief Remove todas as entradas, sem contá-las como descartes.
+   */
+  void clear();
+
+  /**
+   * @brief Define a função chamada para cada entrada descartada.
+   *
+   * @param callback A função a ser chamada.
+   */
+  void set_eviction_callback(EvictionCallback callback);
+
+  /**
+   * @brief Retorna quantas consultas encontraram a chave.
+   *
+   * @return O número de acertos.
+   */
+  size_t hits() const;
+
+  /**
+   * @brief Retorna quantas consultas não encontraram a chave.
+   *
+   * @return O número de faltas.
+   */
+  size_t misses() const;
+
+  /**
+   * @brief Retorna quantas entradas foram descartadas.
+   *
+   * @return O número de descartes.
+   */
+  size_t evictions() const;
+
+ private:
+  using iterator = typename DoublyLinkedList<Entry>::iterator;
+
+  /**
+   * @brief Retira um nó do seu grupo de frequência, atualizando o último nó
+   * do grupo se necessário.
+   *
+   * @param it O nó a ser retirado.
+   */
+  void leave_group(iterator it);
+
+  /**
+   * @brief Incrementa a frequência de uma entrada, movendo-a para o final do
+   * grupo da nova frequência.
+   *
+   * @param it O nó da entrada.
+   */
+  void touch(iterator it);
+
+  /**
+   * @brief Remove o nó de uma entrada da lista e dos índices.
+   *
+   * @param it O nó a ser removido.
+   */
+  void remove(iterator it);
+
+  DoublyLinkedList<Entry> entries; /**< Entradas, por frequência crescente. */
+  HashIndex<K, iterator, Hash> index; /**< Nó de cada chave. */
+  HashIndex<size_t, iterator> group_last; /**< Último nó de cada
+                                             frequência. */
+  size_t _capacity;          /**< Soma máxima dos pesos. */
+  size_t _weight;            /**< Soma atual dos pesos. */
+  Weigher weigher;           /**< Função de peso. */
+  EvictionCallback on_evict; /**< Função chamada nos descartes. */
+  size_t _hits;              /**< Número de acertos. */
+  size_t _misses;            /**< Número de faltas. */
+  size_t _evictions;         /**< Número de descartes. */
+};
+
+#include "../src/lfu_cache.hpp"
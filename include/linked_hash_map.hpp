@@ -0,0 +1,180 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+#include "doubly_linked_list.hpp"
+#include "hash_index.hpp"
+
+/**
+ * @class LinkedHashMap
+ * @brief Mapa que preserva a ordem de inserção, com busca em O(1) esperado.
+ *
+ * As entradas ficam em uma DoublyLinkedList na ordem em que foram inseridas,
+ * e uma HashIndex associa cada chave ao nó da sua entrada. Assim, consultar,
+ * inserir, remover e mover uma entrada para o final custam O(1) esperado, e
+ * percorrer o mapa visita as entradas na ordem de inserção.
+ *
+ * Reinserir uma chave existente apenas atualiza o valor, sem mudar a posição;
+ * para isso existe `move_to_back`.
+ *
+ * @tparam K Tipo das chaves.
+ * @tparam V Tipo dos valores.
+ * @tparam Hash Função hash usada para as chaves.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class LinkedHashMap {
+ public:
+  /**
+   * @struct Entry
+   * @brief Entrada do mapa. A chave é constante, pois é ela que localiza a
+   * entrada no índice.
+   */
+  struct Entry {
+    const K key; /**< Chave da entrada. */
+    V value;     /**< Valor da entrada. */
+  };
+
+  using iterator = typename DoublyLinkedList<Entry>::iterator;
+  using const_iterator = typename DoublyLinkedList<Entry>::const_iterator;
+
+  /**
+   * @brief Construtor. Cria um mapa vazio.
+   *
+   * @param capacity Número de entradas que o mapa deve comportar sem
+   * realocar o índice.
+   * @param hash Função hash a ser usada.
+   */
+  LinkedHashMap(size_t capacity = 0, const Hash &hash = Hash());
+
+  /**
+   * @brief Construtor de cópia. A cópia mantém a ordem das entradas.
+   *
+   * @param other O mapa a ser copiado.
+   */
+  LinkedHashMap(const LinkedHashMap &other);
+
+  /**
+   * @brief Operador de atribuição.
+   *
+   * @param other O mapa a ser copiado.
+   * @return Uma referência para o objeto da classe.
+   */
+  LinkedHashMap &operator=(const LinkedHashMap &other);
+
+  /**
+   * @brief Retorna o número de entradas armazenadas.
+   *
+   * @return O número de entradas.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se o mapa está vazio.
+   *
+   * @return Verdadeiro se não houver entradas, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Garante espaço para `capacity` entradas sem realocar o índice.
+   *
+   * @param capacity O número de entradas desejado.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Procura o valor associado a uma chave.
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro para o valor, ou nullptr se a chave não existir.
+   */
+  V *find(const K &key);
+
+  /**
+   * @brief Procura o valor associado a uma chave (const).
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro constante para o valor, ou nullptr se a chave não
+   * existir.
+   */
+  const V *find(const K &key) const;
+
+  /**
+   * @brief Verifica se uma chave está no mapa.
+   *
+   * @param key A chave procurada.
+   * @return Verdadeiro se a chave existir, caso contrário falso.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Insere uma entrada no final, ou atualiza o valor de uma chave
+   * existente sem mudar a sua posição.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   * @return Verdadeiro se a chave era nova, falso se o valor foi atualizado.
+   */
+  bool insert(const K &key, const V &value);
+
+  /**
+   * @brief Remove uma entrada.
+   *
+   * @param key A chave a ser removida.
+   * @return Verdadeiro se a chave existia, caso contrário falso.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Move uma entrada para o final da ordem.
+   *
+   * @param key A chave da entrada.
+   * @return Verdadeiro se a chave existia, caso contrário falso.
+   */
+  bool move_to_back(const K &key);
+
+  /**
+   * @brief Remove a entrada mais antiga (a primeira da ordem).
+   *
+   * @throw std::out_of_range Se o mapa estiver vazio.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove todas as entradas.
+   */
+  void clear();
+
+  /**
+   * @brief Retorna um iterador para a primeira entrada, na ordem de
+   * inserção.
+   * @return Iterador para o início do mapa.
+   */
+  iterator begin();
+
+  /**
+   * @brief Retorna um iterador para após a última entrada.
+   * @return Iterador para o final do mapa.
+   */
+  iterator end();
+
+  /**
+   * @brief Retorna um iterador constante para a primeira entrada, na ordem
+   * de inserção.
+   * @return Iterador constante para o início do mapa.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna um iterador constante para após a última entrada.
+   * @return Iterador constante para o final do mapa.
+   */
+  const_iterator end() const;
+
+ private:
+  DoublyLinkedList<Entry> entries;    /**< Entradas, na ordem de inserção. */
+  HashIndex<K, iterator, Hash> index; /**< Nó de cada chave. */
+};
+
+#include "../src/linked_hash_map.hpp"
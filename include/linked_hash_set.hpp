@@ -0,0 +1,148 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+#include "doubly_linked_list.hpp"
+#include "hash_index.hpp"
+
+/**
+ * @class LinkedHashSet
+ * @brief Conjunto que preserva a ordem de inserção, com busca em O(1)
+ * esperado.
+ *
+ * Os elementos ficam em uma DoublyLinkedList na ordem em que foram
+ * inseridos, e uma HashIndex associa cada elemento ao seu nó. Ao contrário
+ * de `DoublyLinkedList::contains`, que percorre a lista inteira, verificar,
+ * inserir, remover e mover um elemento para o final custam O(1) esperado.
+ *
+ * A travessia só é feita com iteradores constantes, pois alterar um elemento
+ * no lugar o deixaria na posição errada do índice.
+ *
+ * @tparam T Tipo dos elementos armazenados no conjunto.
+ * @tparam Hash Função hash usada para os elementos.
+ */
+template <class T, class Hash = std::hash<T>>
+class LinkedHashSet {
+ public:
+  using const_iterator = typename DoublyLinkedList<T>::const_iterator;
+
+  /**
+   * @brief Construtor. Cria um conjunto vazio.
+   *
+   * @param capacity Número de elementos que o conjunto deve comportar sem
+   * realocar o índice.
+   * @param hash Função hash a ser usada.
+   */
+  LinkedHashSet(size_t capacity = 0, const Hash &hash = Hash());
+
+  /**
+   * @brief Construtor de cópia. A cópia mantém a ordem dos elementos.
+   *
+   * @param other O conjunto a ser copiado.
+   */
+  LinkedHashSet(const LinkedHashSet &other);
+
+  /**
+   * @brief Operador de atribuição.
+   *
+   * @param other O conjunto a ser copiado.
+   * @return Uma referência para o objeto da classe.
+   */
+  LinkedHashSet &operator=(const LinkedHashSet &other);
+
+  /**
+   * @brief Retorna o número de elementos armazenados.
+   *
+   * @return O número de elementos.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se o conjunto está vazio.
+   *
+   * @return Verdadeiro se não houver elementos, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Garante espaço para `capacity` elementos sem realocar o índice.
+   *
+   * @param capacity O número de elementos desejado.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Verifica se um elemento está no conjunto.
+   *
+   * @param item O elemento procurado.
+   * @return Verdadeiro se o elemento existir, caso contrário falso.
+   */
+  bool contains(const T &item) const;
+
+  /**
+   * @brief Insere um elemento no final, se ele ainda não estiver no
+   * conjunto.
+   *
+   * @param item O elemento a ser inserido.
+   * @return Verdadeiro se o elemento era novo, caso contrário falso.
+   */
+  bool insert(const T &item);
+
+  /**
+   * @brief Remove um elemento.
+   *
+   * @param item O elemento a ser removido.
+   * @return Verdadeiro se o elemento existia, caso contrário falso.
+   */
+  bool erase(const T &item);
+
+  /**
+   * @brief Move um elemento para o final da ordem.
+   *
+   * @param item O elemento a ser movido.
+   * @return Verdadeiro se o elemento existia, caso contrário falso.
+   */
+  bool move_to_back(const T &item);
+
+  /**
+   * @brief Retorna o elemento mais antigo (o primeiro da ordem).
+   *
+   * @return Referência constante ao primeiro elemento.
+   * @throw std::out_of_range Se o conjunto estiver vazio.
+   */
+  const T &front() const;
+
+  /**
+   * @brief Remove o elemento mais antigo (o primeiro da ordem).
+   *
+   * @throw std::out_of_range Se o conjunto estiver vazio.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove todos os elementos.
+   */
+  void clear();
+
+  /**
+   * @brief Retorna um iterador constante para o primeiro elemento, na ordem
+   * de inserção.
+   * @return Iterador constante para o início do conjunto.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna um iterador constante para após o último elemento.
+   * @return Iterador constante para o final do conjunto.
+   */
+  const_iterator end() const;
+
+ private:
+  using iterator = typename DoublyLinkedList<T>::iterator;
+
+  DoublyLinkedList<T> items;          /**< Elementos, na ordem de inserção. */
+  HashIndex<T, iterator, Hash> index; /**< Nó de cada elemento. */
+};
+
+#include "../src/linked_hash_set.hpp"
@@ -151,6 +151,9 @@ class LinkedList {
   /**
    * @brief Acesso ao elemento na posição especificada (const).
    *
+   * Aproveita o último nó acessado pela versão não constante, mas não o
+   * altera; várias threads podem ler a mesma lista ao mesmo tempo.
+   *
    * @param index O índice do elemento.
    * @return A referência constante para o elemento no índice especificado.
    * @throw std::out_of_range Se o índice for inválido.
@@ -164,8 +167,31 @@ class LinkedList {
   void print() const;
 
  private:
+  /**
+   * @brief Localiza o nó na posição especificada.
+   *
+   * A busca parte da cabeça ou do último nó acessado (o "dedo"), o que
+   * estiver mais próximo sem passar do índice, e atualiza o dedo com o nó
+   * encontrado. Assim, acessos sequenciais custam O(1) amortizado.
+   *
+   * @param index O índice do nó (deve ser menor que `size()`).
+   * @return Ponteiro para o nó no índice especificado.
+   */
+  Node *node_at(size_t index);
+
+  /**
+   * @brief Localiza o nó na posição especificada sem atualizar o dedo.
+   *
+   * @param index O índice do nó (deve ser menor que `size()`).
+   * @return Ponteiro para o nó no índice especificado.
+   */
+  Node *node_at(size_t index) const;
+
   Node *head;   /**< Ponteiro para o primeiro nó da lista. */
   size_t _size; /**< Tamanho da lista. */
+
+  Node *finger; /**< Último nó acessado por índice (nullptr se inválido). */
+  size_t finger_index; /**< Índice do nó apontado por `finger`. */
 };
 
 #include "../src/linked_list.hpp"
@@ -0,0 +1,188 @@
+#pragma once
+#include <stddef.h>
+
+#include <functional>
+
+#include "doubly_linked_list.hpp"
+#include "hash_index.hpp"
+
+/**
+ * @class LruCache
+ * @brief Cache que descarta primeiro a entrada usada há mais tempo (LRU).
+ *
+ * As entradas ficam em uma DoublyLinkedList ordenada da mais recente para a
+ * menos recente, e uma HashIndex associa cada chave ao nó da sua entrada.
+ * Consultar, inserir e descartar custam O(1) esperado: um acesso apenas
+ * religa o nó no início da lista com `splice`.
+ *
+ * A capacidade é medida pela soma dos pesos das entradas. Por padrão cada
+ * entrada pesa 1, e a capacidade é o número máximo de entradas; para limitar
+ * a cache em bytes, basta informar uma função que retorna o tamanho de cada
+ * entrada.
+ *
+ * @tparam K Tipo das chaves.
+ * @tparam V Tipo dos valores.
+ * @tparam Hash Função hash usada para as chaves.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class LruCache {
+  /**
+   * @struct Entry
+   * @brief Entrada armazenada na lista de recência.
+   */
+  struct Entry {
+    K key;         /**< Chave da entrada. */
+    V value;       /**< Valor da entrada. */
+    size_t weight; /**< Peso da entrada na capacidade. */
+  };
+
+ public:
+  /// Função que calcula o peso de uma entrada.
+  using Weigher = std::function<size_t(const K &, const V &)>;
+
+  /// Função chamada para cada entrada descartada pela cache.
+  using EvictionCallback = std::function<void(const K &, const V &)>;
+
+  /**
+   * @brief Construtor. Cria uma cache vazia.
+   *
+   * @param capacity A soma máxima dos pesos das entradas.
+   * @param weigher Função que calcula o peso de cada entrada (se vazia, cada
+   * entrada pesa 1).
+   */
+  LruCache(size_t capacity, Weigher weigher = nullptr);
+
+  /**
+   * @brief A cópia não é permitida, pois o índice guarda iteradores para a
+   * lista da própria cache.
+   */
+  LruCache(const LruCache &) = delete;
+
+  /**
+   * @brief A atribuição não é permitida, pois o índice guarda iteradores
+   * para a lista da própria cache.
+   */
+  LruCache &operator=(const LruCache &) = delete;
+
+  /**
+   * @brief Retorna o número de entradas armazenadas.
+   *
+   * @return O número de entradas.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a cache está vazia.
+   *
+   * @return Verdadeiro se não houver entradas, caso contrário falso.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna a soma máxima dos pesos das entradas.
+   *
+   * @return A capacidade da cache.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Retorna a soma atual dos pesos das entradas.
+   *
+   * @return O peso total armazenado.
+   */
+  size_t weight() const;
+
+  /**
+   * @brief Busca o valor de uma chave e a marca como a mais recente.
+   *
+   * @param key A chave procurada.
+   * @return Ponteiro para o valor, ou nullptr se a chave não estiver na
+   * cache.
+   */
+  V *get(const K &key);
+
+  /**
+   * @brief Verifica se uma chave está na cache, sem alterar a recência nem
+   * os contadores.
+   *
+   * @param key A chave procurada.
+   * @return Verdadeiro se a chave estiver na cache, caso contrário falso.
+   */
+  bool contains(const K &key) const;
+
+  /**
+   * @brief Insere ou atualiza uma entrada e a marca como a mais recente.
+   *
+   * Se a capacidade for excedida, as entradas menos recentes são
+   * descartadas. Uma entrada mais pesada que a capacidade inteira não é
+   * armazenada, e a cache fica como estava.
+   *
+   * @param key A chave.
+   * @param value O valor.
+   */
+  void put(const K &key, const V &value);
+
+  /**
+   * @brief Remove uma entrada, sem contá-la como descarte.
+   *
+   * @param key A chave a ser removida.
+   * @return Verdadeiro se a chave existia, caso contrário falso.
+   */
+  bool erase(const K &key);
+
+  /**
+   * @brief Descarta a entrada usada há mais tempo.
+   *
+   * @throw std::out_of_range Se a cache estiver vazia.
+   */
+  void evict();
+
+  /**
+   * @brief Remove todas as entradas, sem contá-las como descartes.
+   */
+  void clear();
+
+  /**
+   * @brief Define a função chamada para cada entrada descartada.
+   *
+   * @param callback A função a ser chamada.
+   */
+  void set_eviction_callback(EvictionCallback callback);
+
+  /**
+   * @brief Retorna quantas consultas encontraram a chave.
+   *
+   * @return O número de acertos.
+   */
+  size_t hits() const;
+
+  /**
+   * @brief Retorna quantas consultas não encontraram a chave.
+   *
+   * @return O número de faltas.
+   */
+  size_t misses() const;
+
+  /**
+   * @brief Retorna quantas entradas foram descartadas.
+   *
+   * @return O número de descartes.
+   */
+  size_t evictions() const;
+
+ private:
+  using iterator = typename DoublyLinkedList<Entry>::iterator;
+
+  DoublyLinkedList<Entry> entries; /**< Entradas, da mais recente para a
+                                      menos recente. */
+  HashIndex<K, iterator, Hash> index; /**< Nó de cada chave. */
+  size_t _capacity;                   /**< Soma máxima dos pesos. */
+  size_t _weight;                     /**< Soma atual dos pesos. */
+  Weigher weigher;                    /**< Função de peso. */
+  EvictionCallback on_evict;          /**< Função chamada nos descartes. */
+  size_t _hits;                       /**< Número de acertos. */
+  size_t _misses;                     /**< Número de faltas. */
+  size_t _evictions;                  /**< Número de descartes. */
+};
+
+#include "../src/lru_cache.hpp"
@@ -1,4 +1,65 @@
 #pragma once
+#include <stddef.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_three_way_comparison) && \
+    __cpp_impl_three_way_comparison >= 201907L && __has_include(<compare>)
+#include <compare>
+#define PAIR_THREE_WAY 1
+#endif
+
+namespace pair_detail {
+
+/**
+ * @brief Guarda um dos valores do par.
+ *
+ * Um tipo vazio (como um comparador sem estado) vira classe base, e a
+ * otimização de base vazia faz com que ele não ocupe espaço no par. O
+ * índice distingue as duas bases quando `T` e `U` são o mesmo tipo.
+ *
+ * @tparam T Tipo do valor.
+ * @tparam Index 0 para o primeiro valor, 1 para o segundo.
+ */
+template <class T, int Index,
+          bool Empty = std::is_empty<T>::value && !std::is_final<T>::value>
+struct Element {
+  constexpr Element() : value() {}
+
+  template <class... Args>
+  constexpr explicit Element(std::in_place_t, Args&&... args)
+      : value(std::forward<Args>(args)...) {}
+
+  constexpr T& get() { return value; }
+  constexpr const T& get() const { return value; }
+
+  T value; ///< O valor.
+};
+
+template <class T, int Index>
+struct Element<T, Index, true> : T {
+  constexpr Element() : T() {}
+
+  template <class... Args>
+  constexpr explicit Element(std::in_place_t, Args&&... args)
+      : T(std::forward<Args>(args)...) {}
+
+  constexpr T& get() { return *this; }
+  constexpr const T& get() const { return *this; }
+};
+
+/**
+ * @brief Compara dois valores com `<`, sem desvios.
+ * @return -1, 0 ou 1.
+ */
+template <class T>
+constexpr int compare_values(const T& a, const T& b) {
+  return static_cast<int>(b < a) - static_cast<int>(a < b);
+}
+
+}  // namespace pair_detail
 
 /**
  * @brief Classe genérica que representa um par de valores de tipos diferentes.
@@ -10,22 +71,57 @@
  * heterogêneos, como por exemplo, em algoritmos de ordenação, contagem,
  * mapeamento e mais.
  *
+ * Valores de tipos vazios não ocupam espaço, e o par é trivialmente
+ * copiável sempre que `T` e `U` forem; assim, uma VectorList de pares é
+ * copiada com `memcpy`. O par pode ser desestruturado:
+ * `auto [key, value] = pair;`.
+ *
  * @tparam T Tipo do primeiro valor do par.
  * @tparam U Tipo do segundo valor do par.
  */
 template <class T, class U>
-class Pair {
+class Pair : private pair_detail::Element<T, 0>,
+             private pair_detail::Element<U, 1> {
+  using First = pair_detail::Element<T, 0>;
+  using Second = pair_detail::Element<U, 1>;
+
  public:
+  /**
+   * @brief Construtor padrão que inicializa os dois valores com os
+   * construtores padrão de `T` e `U`.
+   *
+   * Permite guardar pares em estruturas que pré-alocam os elementos, como a
+   * VectorList.
+   */
+  constexpr Pair();
+
   /**
    * @brief Construtor que inicializa o par com dois valores.
    *
    * Este construtor cria um par de valores, onde o primeiro valor é do tipo `T`
-   * e o segundo valor é do tipo `U`.
+   * e o segundo valor é do tipo `U`. Os argumentos são repassados como
+   * recebidos, de modo que temporários são movidos, e não copiados.
+   *
+   * @param first O primeiro valor do par, ou um argumento para construir `T`.
+   * @param second O segundo valor do par, ou um argumento para construir `U`.
+   */
+  template <class A = T, class B = U,
+            std::enable_if_t<std::is_constructible<T, A&&>::value &&
+                                 std::is_constructible<U, B&&>::value,
+                             int> = 0>
+  constexpr Pair(A&& first, B&& second);
+
+  /**
+   * @brief Constrói cada valor no lugar, a partir de uma tupla de
+   * argumentos, como em `std::pair`.
    *
-   * @param first O primeiro valor do par, do tipo `T`.
-   * @param second O segundo valor do par, do tipo `U`.
+   * @param first Argumentos do construtor de `T`, em geral criados com
+   * `std::forward_as_tuple`.
+   * @param second Argumentos do construtor de `U`.
    */
-  Pair(const T& first, const U& second);
+  template <class... A, class... B>
+  constexpr Pair(std::piecewise_construct_t, std::tuple<A...> first,
+                 std::tuple<B...> second);
 
   /**
    * @brief Obtém o primeiro valor do par.
@@ -36,7 +132,7 @@ class Pair {
    *
    * @return O primeiro valor do par.
    */
-  const T& first() const;
+  constexpr const T& first() const;
 
   /**
    * @brief Obtém o primeiro valor do par (não constante).
@@ -47,7 +143,7 @@ class Pair {
    *
    * @return O primeiro valor do par.
    */
-  T& first();
+  constexpr T& first();
 
   /**
    * @brief Obtém o segundo valor do par.
@@ -58,7 +154,7 @@ class Pair {
    *
    * @return O segundo valor do par.
    */
-  const U& second() const;
+  constexpr const U& second() const;
 
   /**
    * @brief Obtém o segundo valor do par (não constante).
@@ -69,7 +165,7 @@ class Pair {
    *
    * @return O segundo valor do par.
    */
-  U& second();
+  constexpr U& second();
 
   /**
    * @brief Compara se dois pares são iguais.
@@ -80,7 +176,7 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se os pares forem iguais, `false` caso contrário.
    */
-  bool operator==(const Pair<T, U>& other) const;
+  constexpr bool operator==(const Pair<T, U>& other) const;
 
   /**
    * @brief Compara se dois pares são diferentes.
@@ -91,7 +187,7 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se os pares forem diferentes, `false` caso contrário.
    */
-  bool operator!=(const Pair<T, U>& other) const;
+  constexpr bool operator!=(const Pair<T, U>& other) const;
 
   /**
    * @brief Compara se o par atual é maior que o outro.
@@ -104,7 +200,7 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se o par atual for maior, `false` caso contrário.
    */
-  bool operator>(const Pair<T, U>& other) const;
+  constexpr bool operator>(const Pair<T, U>& other) const;
 
   /**
    * @brief Compara se o par atual é menor que o outro.
@@ -117,7 +213,7 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se o par atual for menor, `false` caso contrário.
    */
-  bool operator<(const Pair<T, U>& other) const;
+  constexpr bool operator<(const Pair<T, U>& other) const;
 
   /**
    * @brief Compara se o par atual é maior ou igual ao outro.
@@ -130,7 +226,7 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se o par atual for maior ou igual, `false` caso contrário.
    */
-  bool operator>=(const Pair<T, U>& other) const;
+  constexpr bool operator>=(const Pair<T, U>& other) const;
 
   /**
    * @brief Compara se o par atual é menor ou igual ao outro.
@@ -143,11 +239,77 @@ class Pair {
    * @param other Outro par a ser comparado.
    * @return `true` se o par atual for menor ou igual, `false` caso contrário.
    */
-  bool operator<=(const Pair<T, U>& other) const;
+  constexpr bool operator<=(const Pair<T, U>& other) const;
+
+  /**
+   * @brief Compara os pares em ordem lexicográfica: pelo primeiro valor e,
+   * em caso de empate, pelo segundo.
+   *
+   * Só usa `<` de cada tipo; os operadores relacionais são definidos a
+   * partir deste método.
+   *
+   * @param other Outro par a ser comparado.
+   * @return Um número negativo se o par atual for menor, zero se forem
+   * equivalentes e positivo se for maior.
+   */
+  constexpr int compare(const Pair<T, U>& other) const;
+
+#ifdef PAIR_THREE_WAY
+  /**
+   * @brief Comparação de três vias, disponível a partir do C++20.
+   * @param other Outro par a ser comparado.
+   * @return A ordem entre os pares, com a categoria comum de `T` e `U`.
+   */
+  constexpr auto operator<=>(const Pair<T, U>& other) const;
+#endif
+
+  /**
+   * @brief Obtém um dos valores pelo índice, para a desestruturação
+   * (`auto [a, b] = pair`).
+   * @tparam I 0 para o primeiro valor, 1 para o segundo.
+   * @return O valor.
+   */
+  template <size_t I>
+  constexpr std::tuple_element_t<I, Pair>& get() &;
+
+  /// @copydoc get()
+  template <size_t I>
+  constexpr const std::tuple_element_t<I, Pair>& get() const&;
+
+  /// @copydoc get()
+  template <size_t I>
+  constexpr std::tuple_element_t<I, Pair>&& get() &&;
+
+  /// @copydoc get()
+  template <size_t I>
+  constexpr const std::tuple_element_t<I, Pair>&& get() const&&;
 
  private:
-  T _first;   ///< O primeiro valor do par.
-  U _second;  ///< O segundo valor do par.
+  /**
+   * @brief Construção por partes, com os índices das duas tuplas.
+   */
+  template <class TupleA, class TupleB, size_t... I, size_t... J>
+  constexpr Pair(TupleA& first, TupleB& second, std::index_sequence<I...>,
+                 std::index_sequence<J...>);
+};
+
+namespace std {
+
+/**
+ * @brief Número de valores do par, para a desestruturação.
+ */
+template <class T, class U>
+struct tuple_size<Pair<T, U>> : integral_constant<size_t, 2> {};
+
+/**
+ * @brief Tipo de cada valor do par, para a desestruturação.
+ */
+template <size_t I, class T, class U>
+struct tuple_element<I, Pair<T, U>> {
+  static_assert(I < 2, "Pair tem apenas dois valores");
+  using type = conditional_t<I == 0, T, U>; ///< `T` ou `U`.
 };
 
+}  // namespace std
+
 #include "../src/pair.hpp"
\ No newline at end of file
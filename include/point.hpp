@@ -3,6 +3,11 @@
 /**
  * @class Point
  * @brief Representa um ponto no plano cartesiano 2D.
+ *
+ * As operações são definidas no cabeçalho e, exceto `distance` e `print`,
+ * são `constexpr`; assim, elas são expandidas no lugar da chamada dentro
+ * dos contêineres. Para comparar distâncias, prefira `distance_squared` e
+ * `within`, que não calculam a raiz quadrada.
  */
 class Point {
  public:
@@ -11,19 +16,19 @@ class Point {
    * @param x Coordenada x do ponto (padrão 0).
    * @param y Coordenada y do ponto (padrão 0).
    */
-  Point(double x = 0, double y = 0);
+  constexpr Point(double x = 0, double y = 0);
 
   /**
    * @brief Retorna a coordenada x do ponto.
    * @return Coordenada x.
    */
-  double get_x() const;
+  constexpr double get_x() const;
 
   /**
    * @brief Retorna a coordenada y do ponto.
    * @return Coordenada y.
    */
-  double get_y() const;
+  constexpr double get_y() const;
 
   /**
    * @brief Calcula a distância entre o ponto atual e outro ponto.
@@ -47,19 +52,49 @@ class Point {
    */
   double distance(const Point& other) const;
 
+  /**
+   * @brief Calcula o quadrado da distância euclidiana até outro ponto.
+   *
+   * Como a raiz quadrada é crescente, comparar os quadrados dá o mesmo
+   * resultado que comparar as distâncias, sem o custo de `sqrt`.
+   *
+   * @param other Outro ponto.
+   * @return \f$(x_2 - x_1)^2 + (y_2 - y_1)^2\f$.
+   */
+  constexpr double distance_squared(const Point& other) const;
+
+  /**
+   * @brief Verifica se outro ponto está a uma distância de até `radius`.
+   *
+   * Equivale a `distance(other) <= radius`, mas compara o quadrado da
+   * distância com `radius * radius`.
+   *
+   * @param other Outro ponto.
+   * @param radius O raio.
+   * @return Verdadeiro se a distância for no máximo `radius`; falso se o
+   * raio for negativo.
+   */
+  constexpr bool within(const Point& other, double radius) const;
+
   /**
    * @brief Desloca o ponto pelas coordenadas dx e dy.
    * @param dx Deslocamento na coordenada x.
    * @param dy Deslocamento na coordenada y.
    */
-  void move(double dx, double dy);
+  constexpr void move(double dx, double dy);
 
   /**
    * @brief Compara se o ponto atual é igual a outro ponto.
+   *
+   * Com `epsilon` positivo, as coordenadas podem diferir em até `epsilon`,
+   * o que absorve erros de arredondamento de pontos calculados.
+   *
    * @param other Outro ponto.
+   * @param epsilon Diferença máxima em cada coordenada (padrão 0, igualdade
+   * exata).
    * @return Verdadeiro se os pontos forem iguais, falso caso contrário.
    */
-  bool is_equal(const Point& other) const;
+  constexpr bool is_equal(const Point& other, double epsilon = 0) const;
 
   /**
    * @brief Imprime as coordenadas do ponto no formato (x, y).
@@ -70,3 +105,5 @@ class Point {
   double x;  ///< Coordenada x do ponto.
   double y;  ///< Coordenada y do ponto.
 };
+
+#include "../src/point.hpp"
@@ -0,0 +1,183 @@
+#pragma once
+#include <stddef.h>
+
+#include "point.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @class PointCloud
+ * @brief Coleção de pontos guardada como estrutura de arranjos, com
+ * operações em lote.
+ *
+ * Em vez de um arranjo de Point, as coordenadas x e y ficam em dois arranjos
+ * separados. Assim, as operações que percorrem todos os pontos leem apenas
+ * memória contígua e processam quatro coordenadas por instrução com AVX2,
+ * quando o processador tem suporte; nos demais casos, uma versão escalar
+ * produz os mesmos resultados.
+ *
+ * Os arranjos crescem sob demanda, dobrando a capacidade.
+ */
+class PointCloud {
+ public:
+  /**
+   * @brief Construtor padrão. Cria uma nuvem vazia.
+   */
+  PointCloud();
+
+  /**
+   * @brief Construtor. Cria uma nuvem com os pontos de uma lista.
+   * @param points Os pontos, na mesma ordem.
+   */
+  PointCloud(const VectorList<Point> &points);
+
+  /**
+   * @brief Destruidor. Libera os arranjos de coordenadas.
+   */
+  ~PointCloud();
+
+  /**
+   * @brief Construtor de cópia.
+   * @param other A nuvem a ser copiada.
+   */
+  PointCloud(const PointCloud &other);
+
+  /**
+   * @brief Operador de atribuição.
+   * @param other A nuvem a ser copiada.
+   * @return Uma referência para o objeto da classe.
+   */
+  PointCloud &operator=(const PointCloud &other);
+
+  /**
+   * @brief Verifica se as operações em lote usam AVX2 neste processador.
+   * @return Verdadeiro se o caminho vetorizado estiver disponível.
+   */
+  static bool has_simd();
+
+  /**
+   * @brief Obtém o número de pontos.
+   * @return O tamanho da nuvem.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a nuvem está vazia.
+   * @return Verdadeiro se não houver pontos.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Obtém a capacidade dos arranjos.
+   * @return Número de pontos que cabem sem realocar.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Garante espaço para `capacity` pontos sem realocar.
+   * @param capacity Número de pontos desejado.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Adiciona um ponto ao final da nuvem.
+   * @param point O ponto.
+   */
+  void push_back(const Point &point);
+
+  /**
+   * @brief Acesso ao ponto na posição especificada.
+   * @param index O índice do ponto.
+   * @return Uma cópia do ponto.
+   * @throw std::out_of_range Se o índice for inválido.
+   */
+  Point operator[](size_t index) const;
+
+  /**
+   * @brief Remove todos os pontos.
+   */
+  void clear();
+
+  /**
+   * @brief Acesso direto às coordenadas x.
+   * @return O arranjo de coordenadas x, com `size()` valores.
+   */
+  const double *x_data() const;
+
+  /**
+   * @brief Acesso direto às coordenadas y.
+   * @return O arranjo de coordenadas y, com `size()` valores.
+   */
+  const double *y_data() const;
+
+  /**
+   * @brief Copia os pontos para uma VectorList.
+   * @return Uma lista com capacidade `size()` e os pontos na mesma ordem.
+   */
+  VectorList<Point> to_vector_list() const;
+
+  /**
+   * @brief Calcula a distância de cada ponto até um ponto de referência.
+   * @param query O ponto de referência.
+   * @param distances Recebe `size()` distâncias, na ordem dos pontos.
+   */
+  void distances(const Point &query, double *distances) const;
+
+  /**
+   * @brief Calcula o quadrado da distância de cada ponto até um ponto de
+   * referência, sem raiz quadrada.
+   * @param query O ponto de referência.
+   * @param distances Recebe `size()` valores, na ordem dos pontos.
+   */
+  void distances_squared(const Point &query, double *distances) const;
+
+  /**
+   * @brief Calcula um bloco da matriz de distâncias entre duas nuvens.
+   *
+   * O valor na linha `i` e coluna `j` do bloco é a distância entre o ponto
+   * `row_first + i` desta nuvem e o ponto `col_first + j` de `other`. Para
+   * a matriz completa de uma nuvem, passe a própria nuvem como `other` e
+   * percorra os blocos; blocos pequenos (por exemplo, 64 x 64) cabem na
+   * cache.
+   *
+   * @param other A nuvem das colunas (pode ser esta).
+   * @param row_first Primeiro ponto desta nuvem.
+   * @param rows Número de linhas.
+   * @param col_first Primeiro ponto de `other`.
+   * @param cols Número de colunas.
+   * @param tile Recebe `rows * cols` distâncias, linha por linha.
+   * @throw std::out_of_range Se o bloco sair de alguma das nuvens.
+   */
+  void distance_tile(const PointCloud &other, size_t row_first, size_t rows,
+                     size_t col_first, size_t cols, double *tile) const;
+
+  /**
+   * @brief Desloca todos os pontos pelas coordenadas dx e dy.
+   * @param dx Deslocamento na coordenada x.
+   * @param dy Deslocamento na coordenada y.
+   */
+  void move_all(double dx, double dy);
+
+  /**
+   * @brief Conta os pontos iguais a um ponto, com a mesma comparação de
+   * `Point::is_equal`.
+   * @param point O ponto procurado.
+   * @return Número de pontos iguais.
+   */
+  size_t count_equal(const Point &point) const;
+
+  /**
+   * @brief Encontra os pontos iguais a um ponto, com a mesma comparação de
+   * `Point::is_equal`.
+   * @param point O ponto procurado.
+   * @param indices Lista que recebe os índices, em ordem crescente.
+   * @return Número de pontos iguais.
+   * @throw std::length_error Se a capacidade da lista for excedida.
+   */
+  size_t filter_equal(const Point &point, VectorList<size_t> &indices) const;
+
+ private:
+  double *xs;       ///< Coordenadas x.
+  double *ys;       ///< Coordenadas y.
+  size_t _size;     ///< Número de pontos.
+  size_t _capacity; ///< Capacidade dos arranjos.
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hours.hpp"
+#include "pair.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @brief Extrai o próprio valor como chave (para listas de inteiros).
+ */
+struct IdentityKey {
+  template <class T>
+  constexpr T operator()(const T &value) const {
+    return value;
+  }
+};
+
+/**
+ * @brief Usa `to_seconds()` como chave (para listas de Hours).
+ */
+struct SecondsKey {
+  constexpr int operator()(const Hours &time) const {
+    return time.to_seconds();
+  }
+};
+
+/**
+ * @brief Usa o primeiro valor como chave (para listas de Pair).
+ */
+struct FirstKey {
+  template <class T, class U>
+  constexpr const T &operator()(const Pair<T, U> &pair) const {
+    return pair.first();
+  }
+};
+
+/**
+ * @brief Ordena uma lista pela chave inteira de cada elemento, com radix
+ * sort LSD (do dígito menos significativo para o mais significativo).
+ *
+ * Cada passada distribui os elementos por um dígito da chave, de 8 ou de 11
+ * bits, alternando entre a lista e um arranjo auxiliar; chaves de 32 bits
+ * levam quatro passadas de 8 bits ou três de 11. Os histogramas de todas as
+ * passadas são contados de uma vez, e as passadas em que todos os elementos
+ * têm o mesmo dígito são puladas. Chaves com sinal são ordenadas
+ * corretamente, com os negativos antes.
+ *
+ * A ordenação é estável: elementos com a mesma chave mantêm a ordem
+ * relativa. Com mais de uma thread, cada uma conta e distribui uma faixa
+ * contígua da lista; as posições de cada faixa em cada dígito são
+ * calculadas antes, de modo que a ordem continua estável. Listas pequenas
+ * são ordenadas com `std::stable_sort`.
+ *
+ * @tparam T Tipo dos elementos. Precisa de um construtor padrão.
+ * @tparam Key Função que recebe um elemento e devolve um inteiro.
+ * @param list A lista a ser ordenada.
+ * @param key A função que extrai a chave.
+ * @param digit_bits Bits por dígito: 8 ou 11.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @throw std::invalid_argument Se `digit_bits` não for 8 nem 11.
+ */
+template <class T, class Key>
+void radix_sort_by(VectorList<T> &list, Key key, unsigned digit_bits = 8,
+                   unsigned threads = 1);
+
+/**
+ * @brief Ordena uma lista de inteiros com radix sort.
+ * @param list A lista a ser ordenada.
+ * @param digit_bits Bits por dígito: 8 ou 11.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @throw std::invalid_argument Se `digit_bits` não for 8 nem 11.
+ */
+void radix_sort(VectorList<int> &list, unsigned digit_bits = 8,
+                unsigned threads = 1);
+
+/**
+ * @brief Ordena uma lista de Hours por `to_seconds()` com radix sort.
+ * @param list A lista a ser ordenada.
+ * @param digit_bits Bits por dígito: 8 ou 11.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @throw std::invalid_argument Se `digit_bits` não for 8 nem 11.
+ */
+void radix_sort(VectorList<Hours> &list, unsigned digit_bits = 8,
+                unsigned threads = 1);
+
+/**
+ * @brief Ordena uma lista de pares pela chave de 32 bits com radix sort,
+ * mantendo a ordem dos valores de mesma chave.
+ * @tparam V Tipo dos valores.
+ * @param list A lista a ser ordenada.
+ * @param digit_bits Bits por dígito: 8 ou 11.
+ * @param threads Número de threads (0 usa uma por núcleo).
+ * @throw std::invalid_argument Se `digit_bits` não for 8 nem 11.
+ */
+template <class V>
+void radix_sort(VectorList<Pair<uint32_t, V>> &list, unsigned digit_bits = 8,
+                unsigned threads = 1);
+
+#include "../src/radix_sort.hpp"
@@ -0,0 +1,80 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "geometry.hpp"
+#include "point.hpp"
+#include "point_cloud.hpp"
+#include "vector_list.hpp"
+
+/**
+ * @brief Curvas que percorrem o plano passando por células vizinhas.
+ *
+ * Ordenar pontos pela posição na curva deixa próximos na memória os pontos
+ * próximos no plano. Na curva de Morton (ordem Z), a chave é o entrelaçamento
+ * dos bits das coordenadas; ela é barata de calcular, mas dá saltos longos
+ * entre quadrantes. Na curva de Hilbert, células consecutivas são sempre
+ * vizinhas, o que preserva melhor a localidade.
+ */
+enum class Curve {
+  morton,  ///< Ordem Z.
+  hilbert, ///< Curva de Hilbert.
+};
+
+/**
+ * @brief Calcula a chave de Morton de um ponto dentro de um retângulo.
+ *
+ * Cada coordenada é quantizada em 32 bits, relativa ao retângulo; pontos
+ * fora dele são levados para a borda. Os bits de x ocupam as posições
+ * pares da chave e os de y, as ímpares.
+ *
+ * @param point O ponto.
+ * @param box O retângulo que contém os pontos.
+ * @return A chave de 64 bits.
+ */
+uint64_t morton_key(const Point &point, const BoundingBox &box);
+
+/**
+ * @brief Calcula a posição de um ponto na curva de Hilbert dentro de um
+ * retângulo, com a mesma quantização de `morton_key`.
+ * @param point O ponto.
+ * @param box O retângulo que contém os pontos.
+ * @return A chave de 64 bits.
+ */
+uint64_t hilbert_key(const Point &point, const BoundingBox &box);
+
+/**
+ * @brief Reordena os pontos pela curva dentro do seu retângulo envolvente.
+ *
+ * As chaves são ordenadas com `radix_sort_by`, de 8 bits por passada,
+ * pulando as passadas em que todas as chaves têm o mesmo dígito. A
+ * ordenação é estável: pontos com a mesma chave mantêm a ordem relativa.
+ *
+ * @param points Os pontos, reordenados no lugar.
+ * @param curve A curva (padrão Hilbert).
+ * @return A permutação aplicada: a posição `i` passa a guardar o ponto que
+ * estava na posição `order[i]`.
+ */
+VectorList<size_t> sort_by_curve(VectorList<Point> &points,
+                                 Curve curve = Curve::hilbert);
+
+/**
+ * @brief Reordena os pontos de uma PointCloud pela curva.
+ * @param points Os pontos, reordenados no lugar.
+ * @param curve A curva (padrão Hilbert).
+ * @return A permutação aplicada, como na versão para VectorList.
+ */
+VectorList<size_t> sort_by_curve(PointCloud &points,
+                                 Curve curve = Curve::hilbert);
+
+/**
+ * @brief Inverte uma permutação devolvida por `sort_by_curve`.
+ *
+ * O resultado leva um índice antigo à nova posição do ponto, o que permite
+ * atualizar índices guardados fora da coleção.
+ *
+ * @param order A permutação.
+ * @return A permutação inversa.
+ * @throw std::invalid_argument Se `order` não for uma permutação.
+ */
+VectorList<size_t> invert_permutation(const VectorList<size_t> &order);
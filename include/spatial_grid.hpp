@@ -0,0 +1,260 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "point.hpp"
+
+/**
+ * @class SpatialGrid
+ * @brief Grade uniforme para pontos que se movem com frequência, com
+ * consultas de vizinhança.
+ *
+ * O plano é dividido em células quadradas de lado `cell_size`, e cada
+ * célula é espalhada (hash) em um número fixo de baldes. Cada balde guarda
+ * os seus pontos em um arranjo contíguo, com as coordenadas e o valor
+ * associado, de modo que uma consulta percorre memória sequencial. Inserir,
+ * remover e mudar um ponto de célula custam O(1): a remoção troca o ponto
+ * com o último do balde, e uma tabela de posições, indexada pelo
+ * identificador, é atualizada.
+ *
+ * Uma consulta de raio percorre apenas as células que cruzam o quadrado em
+ * volta do centro; células diferentes que caem no mesmo balde são
+ * separadas pelas coordenadas de célula guardadas em cada ponto.
+ *
+ * Mover um ponto dentro do mesmo balde só atualiza as coordenadas. Com
+ * `update`, todos os pontos são visitados em paralelo, por faixas de
+ * baldes, e apenas os que mudam de balde são realocados depois, em série.
+ *
+ * As coordenadas divididas por `cell_size` devem caber em um `int32_t`.
+ *
+ * @tparam T Tipo do valor associado a cada ponto.
+ */
+template <class T>
+class SpatialGrid {
+ private:
+  /**
+   * @brief Um ponto no arranjo de um balde.
+   */
+  struct Entry {
+    double x;      ///< Coordenada x.
+    double y;      ///< Coordenada y.
+    T value;       ///< Valor associado.
+    int32_t cx;    ///< Coluna da célula.
+    int32_t cy;    ///< Linha da célula.
+    uint32_t slot; ///< Índice na tabela de posições.
+  };
+
+  /**
+   * @brief Pontos das células espalhadas em um balde.
+   */
+  struct Bucket {
+    Entry *entries;    ///< Arranjo de pontos.
+    uint32_t size;     ///< Número de pontos.
+    uint32_t capacity; ///< Tamanho do arranjo.
+  };
+
+  /**
+   * @brief Posição de um ponto, indexada pelo seu identificador.
+   */
+  struct Slot {
+    uint32_t bucket;     ///< Balde do ponto (`npos` se o slot estiver livre).
+    uint32_t position;   ///< Posição no balde, ou próximo slot livre.
+    uint32_t generation; ///< Incrementado sempre que o slot é liberado.
+  };
+
+  static constexpr uint32_t npos = UINT32_MAX; ///< Índice nulo.
+
+ public:
+  /**
+   * @brief Identifica um ponto inserido.
+   *
+   * Depois que o ponto é removido, o identificador deixa de ser válido,
+   * mesmo que o slot seja reaproveitado.
+   */
+  struct Handle {
+    uint32_t index;      ///< Índice na tabela de posições.
+    uint32_t generation; ///< Geração do slot no momento da inserção.
+  };
+
+  /**
+   * @brief Construtor. Cria uma grade vazia.
+   * @param cell_size Lado de cada célula; de preferência, perto do raio
+   * típico das consultas.
+   * @param buckets Número de baldes (arredondado para uma potência de 2).
+   * @throw std::invalid_argument Se o lado não for positivo.
+   */
+  SpatialGrid(double cell_size, size_t buckets = 4096);
+
+  /**
+   * @brief Destruidor. Libera os baldes.
+   */
+  ~SpatialGrid();
+
+  /**
+   * @brief A cópia não é permitida, pois os identificadores entregues se
+   * referem a esta grade.
+   */
+  SpatialGrid(const SpatialGrid &) = delete;
+
+  /**
+   * @brief A atribuição não é permitida, pois os identificadores entregues
+   * se referem a esta grade.
+   */
+  SpatialGrid &operator=(const SpatialGrid &) = delete;
+
+  /**
+   * @brief Obtém o número de pontos.
+   * @return O tamanho da grade.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a grade está vazia.
+   * @return Verdadeiro se não houver pontos.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Obtém o lado de cada célula.
+   * @return O lado das células.
+   */
+  double cell_size() const;
+
+  /**
+   * @brief Insere um ponto.
+   * @param point A posição do ponto.
+   * @param value O valor associado.
+   * @return Identificador do ponto.
+   * @throw std::length_error Se os identificadores de 32 bits se esgotarem.
+   */
+  Handle insert(const Point &point, const T &value);
+
+  /**
+   * @brief Remove um ponto.
+   * @param handle Identificador do ponto.
+   * @return Verdadeiro se o ponto estava na grade.
+   */
+  bool remove(Handle handle);
+
+  /**
+   * @brief Verifica se um identificador ainda se refere a um ponto.
+   * @param handle Identificador do ponto.
+   * @return Verdadeiro se o ponto não foi removido.
+   */
+  bool contains(Handle handle) const;
+
+  /**
+   * @brief Obtém a posição de um ponto.
+   * @param handle Identificador do ponto.
+   * @return A posição.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  Point position(Handle handle) const;
+
+  /**
+   * @brief Obtém o valor associado a um ponto.
+   * @param handle Identificador do ponto.
+   * @return Uma referência para o valor.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  T &value(Handle handle);
+
+  /**
+   * @brief Obtém o valor associado a um ponto.
+   * @param handle Identificador do ponto.
+   * @return Uma referência constante para o valor.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  const T &value(Handle handle) const;
+
+  /**
+   * @brief Muda a posição de um ponto, trocando-o de balde se necessário.
+   * @param handle Identificador do ponto.
+   * @param point A nova posição.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  void relocate(Handle handle, const Point &point);
+
+  /**
+   * @brief Desloca um ponto pelas coordenadas dx e dy, como `Point::move`.
+   * @param handle Identificador do ponto.
+   * @param dx Deslocamento na coordenada x.
+   * @param dy Deslocamento na coordenada y.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  void move(Handle handle, double dx, double dy);
+
+  /**
+   * @brief Visita os pontos a uma distância de até `radius` de um centro.
+   * @param center O centro da consulta.
+   * @param radius O raio.
+   * @param visit Função chamada com a posição e o valor de cada ponto.
+   * @return Número de pontos visitados.
+   */
+  template <class F>
+  size_t for_each_within(const Point &center, double radius, F visit) const;
+
+  /**
+   * @brief Atualiza todos os pontos, possivelmente em paralelo.
+   *
+   * `f` recebe a posição e o valor de cada ponto e pode alterar os dois,
+   * por exemplo chamando `Point::move`. As chamadas não têm ordem definida
+   * e, com mais de uma thread, acontecem ao mesmo tempo; `f` não deve
+   * acessar a grade. Os pontos que mudam de balde são realocados ao final.
+   *
+   * @param f Função chamada com `Point&` e `T&` de cada ponto.
+   * @param threads Número de threads (0 usa uma por núcleo).
+   */
+  template <class F>
+  void update(F f, unsigned threads = 1);
+
+  /**
+   * @brief Remove todos os pontos. Os identificadores deixam de ser
+   * válidos.
+   */
+  void clear();
+
+ private:
+  /**
+   * @brief Calcula a coordenada de célula de uma coordenada.
+   */
+  int32_t cell_of(double coordinate) const;
+
+  /**
+   * @brief Calcula o balde de uma célula.
+   */
+  uint32_t bucket_of(int32_t cx, int32_t cy) const;
+
+  /**
+   * @brief Verifica o identificador e retorna o ponto correspondente.
+   * @throw std::out_of_range Se o identificador for inválido.
+   */
+  Entry &entry_of(Handle handle) const;
+
+  /**
+   * @brief Adiciona um ponto ao final de um balde, atualizando o seu slot.
+   */
+  void append(uint32_t bucket, const Entry &entry);
+
+  /**
+   * @brief Retira um ponto de um balde, colocando o último no seu lugar.
+   */
+  void detach(uint32_t bucket, uint32_t position);
+
+  /**
+   * @brief Coloca um ponto no balde da sua célula atual, se for outro.
+   */
+  void rehome(uint32_t slot);
+
+  Bucket *buckets;        ///< Arranjo de baldes.
+  uint32_t bucket_mask;   ///< Número de baldes menos 1.
+  Slot *slots;            ///< Tabela de posições.
+  uint32_t slots_used;    ///< Número de slots já utilizados.
+  uint32_t slot_capacity; ///< Tamanho da tabela de posições.
+  uint32_t free_head;     ///< Primeiro slot livre (ou `npos`).
+  size_t _size;           ///< Número de pontos.
+  double _cell_size;      ///< Lado de cada célula.
+  double inverse_size;    ///< 1 / `cell_size`.
+};
+
+#include "../src/spatial_grid.hpp"
@@ -0,0 +1,252 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hours.hpp"
+
+/**
+ * @class TimerWheel
+ * @brief Agendador de temporizadores em roda hierárquica, com resolução de
+ * um segundo.
+ *
+ * Em vez de uma lista percorrida inteira a cada segundo, os temporizadores
+ * ficam em baldes de três rodas: 60 baldes de um segundo, 60 de um minuto e
+ * 24 de uma hora, além de um balde de transbordo para prazos em dias
+ * futuros. Um temporizador vai para a roda mais fina que contém o seu prazo
+ * no minuto, hora ou dia atuais; quando o relógio entra em um novo minuto
+ * (ou hora, ou dia), o balde correspondente da roda superior é redistribuído
+ * nas rodas inferiores. Assim, agendar e cancelar custam O(1), e cada
+ * segundo custa O(1) mais o número de temporizadores que vencem ou descem de
+ * roda.
+ *
+ * Como na CompactDoublyLinkedList, os nós ficam em um único arranjo e são
+ * ligados por índices de 32 bits. Cada balde é uma lista circular com um nó
+ * sentinela no próprio arranjo, como na DoublyLinkedList, de modo que
+ * cancelar um temporizador apenas o desliga dos vizinhos, sem saber em que
+ * balde ele está.
+ *
+ * Os prazos são absolutos, em segundos, e podem ser informados como Hours
+ * ou como o resultado de `Hours::to_seconds()`.
+ *
+ * @tparam T Tipo do valor associado a cada temporizador.
+ */
+template <class T>
+class TimerWheel {
+ private:
+  /**
+   * @brief Estrutura que representa um nó no arranjo.
+   */
+  struct Node {
+    T value;             ///< Valor associado ao temporizador.
+    uint64_t deadline;   ///< Prazo, em segundos.
+    uint32_t next;       ///< Índice do próximo nó do balde.
+    uint32_t prev;       ///< Índice do nó anterior do balde.
+    uint32_t generation; ///< Incrementado sempre que o nó é liberado.
+  };
+
+  static constexpr uint32_t npos = UINT32_MAX; ///< Índice nulo.
+
+  static constexpr uint32_t second_slots = 60; ///< Baldes da roda de segundos.
+  static constexpr uint32_t minute_slots = 60; ///< Baldes da roda de minutos.
+  static constexpr uint32_t hour_slots = 24;   ///< Baldes da roda de horas.
+
+  /// Primeiro balde da roda de minutos.
+  static constexpr uint32_t minute_base = second_slots;
+  /// Primeiro balde da roda de horas.
+  static constexpr uint32_t hour_base = minute_base + minute_slots;
+  /// Balde de transbordo, para prazos em outro dia.
+  static constexpr uint32_t overflow = hour_base + hour_slots;
+  /// Número de baldes, que ocupam as primeiras posições do arranjo.
+  static constexpr uint32_t bucket_count = overflow + 1;
+
+ public:
+  /**
+   * @brief Identifica um temporizador agendado.
+   *
+   * Depois que o temporizador vence ou é cancelado, o identificador deixa de
+   * ser válido, mesmo que o nó seja reaproveitado.
+   */
+  struct Handle {
+    uint32_t index;      ///< Índice do nó.
+    uint32_t generation; ///< Geração do nó no momento do agendamento.
+  };
+
+  /**
+   * @brief Construtor. Cria uma roda vazia.
+   * @param now O instante atual, em segundos.
+   */
+  TimerWheel(uint64_t now = 0);
+
+  /**
+   * @brief Construtor. Cria uma roda vazia.
+   * @param now O instante atual.
+   */
+  TimerWheel(const Hours &now);
+
+  /**
+   * @brief Destruidor. Libera o arranjo de nós.
+   */
+  ~TimerWheel();
+
+  /**
+   * @brief A cópia não é permitida, pois os identificadores entregues se
+   * referem aos nós desta roda.
+   */
+  TimerWheel(const TimerWheel &) = delete;
+
+  /**
+   * @brief A atribuição não é permitida, pois os identificadores entregues se
+   * referem aos nós desta roda.
+   */
+  TimerWheel &operator=(const TimerWheel &) = delete;
+
+  /**
+   * @brief Obtém o número de temporizadores agendados.
+   * @return Número de temporizadores que ainda não venceram nem foram
+   * cancelados.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se não há temporizadores agendados.
+   * @return Verdadeiro se a roda estiver vazia.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Obtém o instante atual da roda.
+   * @return O instante atual, em segundos.
+   */
+  uint64_t now() const;
+
+  /**
+   * @brief Garante espaço para `capacity` temporizadores sem realocar o
+   * arranjo.
+   * @param capacity Número de temporizadores desejado.
+   * @throw std::length_error Se a capacidade não couber em índices de 32
+   * bits.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Agenda um temporizador.
+   *
+   * Um prazo que já passou vence no próximo segundo.
+   *
+   * @param deadline O prazo, em segundos.
+   * @param value Valor entregue quando o temporizador vencer.
+   * @return Identificador do temporizador.
+   */
+  Handle schedule(uint64_t deadline, const T &value);
+
+  /**
+   * @brief Agenda um temporizador.
+   * @param deadline O prazo.
+   * @param value Valor entregue quando o temporizador vencer.
+   * @return Identificador do temporizador.
+   */
+  Handle schedule(const Hours &deadline, const T &value);
+
+  /**
+   * @brief Cancela um temporizador, descartando o seu valor.
+   * @param handle Identificador do temporizador.
+   * @return Verdadeiro se o temporizador ainda estava agendado.
+   */
+  bool cancel(Handle handle);
+
+  /**
+   * @brief Verifica se um temporizador ainda está agendado.
+   * @param handle Identificador do temporizador.
+   * @return Verdadeiro se ele não venceu nem foi cancelado.
+   */
+  bool pending(Handle handle) const;
+
+  /**
+   * @brief Avança o relógio em um segundo, disparando os temporizadores que
+   * vencem.
+   *
+   * A função pode agendar e cancelar temporizadores; os agendados vencem a
+   * partir do segundo seguinte.
+   *
+   * @param on_expire Função chamada com o valor de cada temporizador
+   * vencido.
+   * @return Número de temporizadores vencidos.
+   */
+  template <class F>
+  size_t tick(F on_expire);
+
+  /**
+   * @brief Avança o relógio até um instante, disparando em ordem os
+   * temporizadores que vencem no caminho.
+   * @param now O novo instante, em segundos (ignorado se já passou).
+   * @param on_expire Função chamada com o valor de cada temporizador
+   * vencido.
+   * @return Número de temporizadores vencidos.
+   */
+  template <class F>
+  size_t advance(uint64_t now, F on_expire);
+
+  /**
+   * @brief Avança o relógio até um instante, disparando em ordem os
+   * temporizadores que vencem no caminho.
+   * @param now O novo instante.
+   * @param on_expire Função chamada com o valor de cada temporizador
+   * vencido.
+   * @return Número de temporizadores vencidos.
+   */
+  template <class F>
+  size_t advance(const Hours &now, F on_expire);
+
+  /**
+   * @brief Cancela todos os temporizadores.
+   */
+  void clear();
+
+ private:
+  /**
+   * @brief Obtém um nó livre, reaproveitando um nó liberado se houver.
+   * @return Índice do nó.
+   */
+  uint32_t allocate_node();
+
+  /**
+   * @brief Devolve um nó à lista de nós livres, substituindo o seu valor
+   * por `T()`.
+   * @param index Índice do nó.
+   */
+  void release_node(uint32_t index);
+
+  /**
+   * @brief Liga um nó ao final de um balde.
+   * @param bucket Índice do sentinela do balde.
+   * @param index Índice do nó.
+   */
+  void link_back(uint32_t bucket, uint32_t index);
+
+  /**
+   * @brief Desliga um nó do seu balde.
+   * @param index Índice do nó.
+   */
+  void unlink(uint32_t index);
+
+  /**
+   * @brief Coloca um nó no balde correspondente ao seu prazo.
+   * @param index Índice do nó.
+   */
+  void place(uint32_t index);
+
+  /**
+   * @brief Redistribui nas rodas inferiores todos os nós de um balde.
+   * @param bucket Índice do sentinela do balde.
+   */
+  void cascade(uint32_t bucket);
+
+  Node *nodes;        ///< Arranjo com os sentinelas e os nós.
+  uint32_t free_head; ///< Índice do primeiro nó livre (ou `npos`).
+  uint32_t used;      ///< Número de posições do arranjo já utilizadas.
+  size_t _size;       ///< Número de temporizadores agendados.
+  size_t _capacity;   ///< Número de posições do arranjo.
+  uint64_t current;   ///< Instante atual, em segundos.
+};
+
+#include "../src/timer_wheel.hpp"
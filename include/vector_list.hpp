@@ -155,6 +155,13 @@ class VectorList {
   void print() const;
 
  private:
+  /**
+   * @brief Copia os elementos de outra lista para esta, que deve estar
+   * vazia e ter capacidade suficiente. Tipos trivialmente copiáveis são
+   * copiados com `memcpy`.
+   */
+  void copy_from(const VectorList &list);
+
   T *data;          /**< Ponteiro para os dados armazenados na lista. */
   size_t _size;     /**< Tamanho atual da lista. */
   size_t _capacity; /**< Capacidade da lista. */
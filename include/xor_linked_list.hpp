@@ -0,0 +1,250 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class XorLinkedList
+ * @brief Representa uma lista duplamente encadeada que usa um único campo de
+ * ligação por nó.
+ *
+ * Em vez de guardar os ponteiros `prev` e `next` separadamente, cada nó
+ * armazena o XOR dos dois endereços. Conhecendo um nó vizinho, é possível
+ * recuperar o outro: `next = prev ^ link` e `prev = next ^ link`. Assim, a
+ * lista pode ser percorrida nos dois sentidos gastando metade da memória de
+ * ligação de uma DoublyLinkedList.
+ *
+ * Como um nó sozinho não identifica seus vizinhos, os iteradores carregam dois
+ * ponteiros: o nó atual e o nó anterior a ele.
+ *
+ * @tparam T Tipo dos elementos armazenados na lista.
+ */
+template <class T>
+class XorLinkedList {
+ private:
+  /**
+   * @brief Estrutura que representa um nó da lista.
+   */
+  struct Node {
+    /**
+     * @brief Construtor do nó.
+     * @param value Valor do nó a ser armazenado.
+     */
+    Node(const T &value);
+
+    T value;        ///< Valor armazenado no nó.
+    uintptr_t link; ///< XOR dos endereços do nó anterior e do próximo.
+  };
+
+  /**
+   * @brief Obtém o vizinho de um nó a partir do outro vizinho.
+   * @param node Nó cujo vizinho será calculado.
+   * @param other Vizinho conhecido de `node` (ou nullptr).
+   * @return O vizinho de `node` do lado oposto a `other`.
+   */
+  template <class N>
+  static N *neighbor(N *node, N *other);
+
+ public:
+  /**
+   * @brief Iterador bidirecional da lista XOR.
+   *
+   * @tparam U Tipo do nó (constante ou não).
+   */
+  template <class U>
+  class Iterator {
+   public:
+    /**
+     * @brief Desreferencia o iterador.
+     * @return Referência ao valor armazenado no nó atual.
+     */
+    auto &operator*() const;
+
+    /**
+     * @brief Incrementa o iterador para o próximo nó.
+     * @return Referência ao iterador atualizado.
+     */
+    Iterator<U> &operator++();
+
+    /**
+     * @brief Decrementa o iterador para o nó anterior.
+     * @return Referência ao iterador atualizado.
+     */
+    Iterator<U> &operator--();
+
+    /**
+     * @brief Compara dois iteradores para verificar se são iguais.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem iguais, falso caso
+     * contrário.
+     */
+    bool operator==(const Iterator<U> &other) const;
+
+    /**
+     * @brief Compara dois iteradores para verificar se são diferentes.
+     * @param other Outro iterador para comparação.
+     * @return Verdadeiro se os iteradores forem diferentes, falso caso
+     * contrário.
+     */
+    bool operator!=(const Iterator<U> &other) const;
+
+   private:
+    /**
+     * @brief Construtor do iterador.
+     * @param prev Nó anterior ao atual (nullptr no início da lista).
+     * @param node Nó atual (nullptr no final da lista).
+     */
+    Iterator(U *prev, U *node);
+
+    U *prev; ///< Nó anterior ao atual.
+    U *node; ///< Nó atual.
+
+    friend class XorLinkedList;
+  };
+
+  using iterator = XorLinkedList<T>::Iterator<Node>;
+  using const_iterator = XorLinkedList<T>::Iterator<const Node>;
+
+  /**
+   * @brief Construtor padrão da lista.
+   */
+  XorLinkedList();
+
+  /**
+   * @brief Construtor de cópia da lista.
+   * @param list Lista a ser copiada.
+   */
+  XorLinkedList(const XorLinkedList &list);
+
+  /**
+   * @brief Operador de atribuição para copiar uma lista.
+   * @param list Lista a ser atribuída.
+   * @return Referência para a lista atual.
+   */
+  XorLinkedList &operator=(const XorLinkedList &list);
+
+  /**
+   * @brief Destruidor da lista. Desaloca todos os nós.
+   */
+  ~XorLinkedList();
+
+  /**
+   * @brief Obtém o tamanho da lista.
+   * @return Número de elementos na lista.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Verifica se a lista está vazia.
+   * @return Verdadeiro se a lista estiver vazia, falso caso contrário.
+   */
+  bool empty() const;
+
+  /**
+   * @brief Retorna a memória, em bytes, ocupada por um único nó.
+   * @return O tamanho de um nó da lista.
+   */
+  static constexpr size_t node_bytes() { return sizeof(Node); }
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o primeiro elemento.
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Retorna um iterador para o final da lista (após o último nó).
+   * @return Iterador para o final da lista.
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Retorna um iterador para o início da lista.
+   * @return Iterador para o primeiro elemento.
+   */
+  iterator begin();
+
+  /**
+   * @brief Retorna um iterador para o final da lista (após o último nó).
+   * @return Iterador para o final da lista.
+   */
+  iterator end();
+
+  /**
+   * @brief Acessa o primeiro elemento da lista.
+   * @return Referência ao primeiro elemento.
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  T &front();
+
+  /**
+   * @brief Acessa o primeiro elemento da lista.
+   * @return Referência constante ao primeiro elemento.
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  const T &front() const;
+
+  /**
+   * @brief Acessa o último elemento da lista.
+   * @return Referência ao último elemento.
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  T &back();
+
+  /**
+   * @brief Acessa o último elemento da lista.
+   * @return Referência constante ao último elemento.
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  const T &back() const;
+
+  /**
+   * @brief Adiciona um elemento ao início da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_front(const T &value);
+
+  /**
+   * @brief Adiciona um elemento ao final da lista.
+   * @param value Valor a ser adicionado.
+   */
+  void push_back(const T &value);
+
+  /**
+   * @brief Remove o primeiro elemento da lista.
+   *
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  void pop_front();
+
+  /**
+   * @brief Remove o último elemento da lista.
+   *
+   * @throw std::out_of_range Se a lista estiver vazia.
+   */
+  void pop_back();
+
+  /**
+   * @brief Remove todos os elementos da lista.
+   */
+  void clear();
+
+  /**
+   * @brief Verifica se um item existe na lista.
+   * @param item Valor a ser verificado.
+   * @return Verdadeiro se o item estiver presente na lista, falso caso
+   * contrário.
+   */
+  bool contains(const T &item) const;
+
+  /**
+   * @brief Imprime os elementos da lista.
+   */
+  void print() const;
+
+ private:
+  Node *head;   ///< Ponteiro para o primeiro nó (nullptr se vazia).
+  Node *tail;   ///< Ponteiro para o último nó (nullptr se vazia).
+  size_t _size; ///< Número de elementos da lista.
+};
+
+#include "../src/xor_linked_list.hpp"
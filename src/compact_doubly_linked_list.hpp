@@ -0,0 +1,387 @@
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../include/compact_doubly_linked_list.hpp"
+
+template <class T>
+CompactDoublyLinkedList<T>::CompactDoublyLinkedList()
+    : nodes{nullptr}, head{npos}, tail{npos}, free_head{npos}, used{0},
+      _size(0), _capacity(0) {}
+
+template <class T>
+CompactDoublyLinkedList<T>::CompactDoublyLinkedList(
+    const CompactDoublyLinkedList<T>& list)
+    : nodes{nullptr}, head{npos}, tail{npos}, free_head{npos}, used{0},
+      _size(0), _capacity(0) {
+    *this = list;
+}
+
+template <class T>
+CompactDoublyLinkedList<T>& CompactDoublyLinkedList<T>::operator=(
+    const CompactDoublyLinkedList<T>& list) {
+    if (this == &list) {
+        return *this;
+    }
+    clear();
+    reserve(list.size());
+    for (auto& i : list) {
+        push_back(i);
+    }
+    return *this;
+}
+
+template <class T>
+CompactDoublyLinkedList<T>::~CompactDoublyLinkedList() {
+    delete[] nodes;
+}
+
+template <class T>
+size_t CompactDoublyLinkedList<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool CompactDoublyLinkedList<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+size_t CompactDoublyLinkedList<T>::capacity() const {
+    return _capacity;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::reserve(size_t capacity) {
+    if (capacity <= _capacity) {
+        return;
+    } else if (capacity > npos) {
+        throw std::length_error("A lista esta cheia");
+    }
+    auto new_nodes = new Node[capacity];
+    for (uint32_t i = 0; i < used; i++) {
+        new_nodes[i].value = std::move(nodes[i].value);
+        new_nodes[i].next = nodes[i].next;
+        new_nodes[i].prev = nodes[i].prev;
+    }
+    delete[] nodes;
+    nodes = new_nodes;
+    _capacity = capacity;
+}
+
+template <class T>
+size_t CompactDoublyLinkedList<T>::memory_usage() const {
+    return capacity() * node_bytes();
+}
+
+template <class T>
+uint32_t CompactDoublyLinkedList<T>::allocate_node(const T& value) {
+    if (free_head == npos && used == capacity()) {
+        // `value` pode ser um elemento desta lista, e `reserve` libera o
+        // arranjo antigo: a cópia é feita antes de crescer.
+        T copy = value;
+        reserve(capacity() == 0 ? 8 : capacity() * 2);
+        return allocate_node(copy);
+    }
+    uint32_t index;
+    if (free_head != npos) {
+        index = free_head;
+        free_head = nodes[index].next;
+    } else {
+        index = used++;
+    }
+    nodes[index].value = value;
+    nodes[index].next = npos;
+    nodes[index].prev = npos;
+    return index;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::release_node(uint32_t index) {
+    // O valor é descartado agora, e não quando o nó for reaproveitado.
+    nodes[index].value = T();
+    nodes[index].next = free_head;
+    free_head = index;
+}
+
+template <class T>
+uint32_t CompactDoublyLinkedList<T>::node_at(size_t index) const {
+    if (index < size() - index) {
+        auto pos = head;
+        for (size_t i = 0; i < index; i++) {
+            pos = nodes[pos].next;
+        }
+        return pos;
+    }
+    auto pos = tail;
+    for (size_t i = size() - 1; i > index; i--) {
+        pos = nodes[pos].prev;
+    }
+    return pos;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::push_front(const T& value) {
+    auto new_node = allocate_node(value);
+    if (empty()) {
+        tail = new_node;
+    } else {
+        nodes[new_node].next = head;
+        nodes[head].prev = new_node;
+    }
+    head = new_node;
+    _size++;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::push_back(const T& value) {
+    auto new_node = allocate_node(value);
+    if (empty()) {
+        head = new_node;
+    } else {
+        nodes[new_node].prev = tail;
+        nodes[tail].next = new_node;
+    }
+    tail = new_node;
+    _size++;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::print() const {
+    for (auto& v : *this) {
+        std::cout << v << " <-> ";
+    }
+    std::cout << "NULL (" << size() << ")\n";
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    auto old_head = head;
+    head = nodes[head].next;
+    if (head != npos) {
+        nodes[head].prev = npos;
+    } else {
+        tail = npos;
+    }
+    release_node(old_head);
+    _size--;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("Lista esta vazia");
+    }
+    auto old_tail = tail;
+    tail = nodes[tail].prev;
+    if (tail != npos) {
+        nodes[tail].next = npos;
+    } else {
+        head = npos;
+    }
+    release_node(old_tail);
+    _size--;
+}
+
+template <class T>
+template <class L>
+CompactDoublyLinkedList<T>::Iterator<L>::Iterator(L* list, uint32_t index)
+    : list{list}, index{index} {}
+
+template <class T>
+template <class L>
+auto& CompactDoublyLinkedList<T>::Iterator<L>::operator*() const {
+    return list->nodes[index].value;
+}
+
+template <class T>
+template <class L>
+auto CompactDoublyLinkedList<T>::Iterator<L>::operator++() -> Iterator<L>& {
+    index = list->nodes[index].next;
+    return *this;
+}
+
+template <class T>
+template <class L>
+auto CompactDoublyLinkedList<T>::Iterator<L>::operator--() -> Iterator<L>& {
+    if (index == npos) {
+        index = list->tail;
+    } else {
+        index = list->nodes[index].prev;
+    }
+    return *this;
+}
+
+template <class T>
+template <class L>
+bool CompactDoublyLinkedList<T>::Iterator<L>::operator==(
+    const Iterator<L>& other) const {
+    return list == other.list && index == other.index;
+}
+
+template <class T>
+template <class L>
+bool CompactDoublyLinkedList<T>::Iterator<L>::operator!=(
+    const Iterator<L>& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+template <class L>
+auto CompactDoublyLinkedList<T>::Iterator<L>::operator+(size_t offset) const
+    -> Iterator<L> {
+    auto it = *this;
+    for (size_t i = 0; i < offset; i++) {
+        ++it;
+    }
+    return it;
+}
+
+template <class T>
+template <class L>
+auto CompactDoublyLinkedList<T>::Iterator<L>::operator-(size_t offset) const
+    -> Iterator<L> {
+    auto it = *this;
+    for (size_t i = 0; i < offset; i++) {
+        --it;
+    }
+    return it;
+}
+
+template <class T>
+template <class L>
+size_t CompactDoublyLinkedList<T>::Iterator<L>::operator-(
+    const Iterator<L> other) const {
+    auto pos = other;
+    size_t count = 0;
+    while (pos != *this) {
+        count++;
+        ++pos;
+    }
+    return count;
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::begin() const -> const_iterator {
+    return const_iterator(this, head);
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::begin() -> iterator {
+    return iterator(this, head);
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::end() const -> const_iterator {
+    return const_iterator(this, npos);
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::end() -> iterator {
+    return iterator(this, npos);
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::insert(iterator pos, const T& value) {
+    if (pos.index == npos) {
+        return push_back(value);
+    } else if (pos.index == head) {
+        return push_front(value);
+    }
+    auto node_pos = pos.index;
+    auto node_prev = nodes[node_pos].prev;
+    auto new_node = allocate_node(value);
+    nodes[node_prev].next = new_node;
+    nodes[new_node].next = node_pos;
+    nodes[new_node].prev = node_prev;
+    nodes[node_pos].prev = new_node;
+    _size++;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::erase(iterator first, iterator last) {
+    if (first == last) {
+        return;
+    }
+    auto before = nodes[first.index].prev;
+    auto after = last.index;
+
+    // Libera os nós da faixa contando-os, sem uma segunda travessia.
+    auto pos = first.index;
+    while (pos != after) {
+        auto next = nodes[pos].next;
+        release_node(pos);
+        _size--;
+        pos = next;
+    }
+
+    if (before == npos) {
+        head = after;
+    } else {
+        nodes[before].next = after;
+    }
+    if (after == npos) {
+        tail = before;
+    } else {
+        nodes[after].prev = before;
+    }
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::find(const T& item) -> iterator {
+    auto it = begin();
+    while (it != end()) {
+        if (*it == item) break;
+        ++it;
+    }
+    return it;
+}
+
+template <class T>
+auto CompactDoublyLinkedList<T>::find(const T& item) const -> const_iterator {
+    auto it = begin();
+    while (it != end()) {
+        if (*it == item) break;
+        ++it;
+    }
+    return it;
+}
+
+template <class T>
+bool CompactDoublyLinkedList<T>::contains(const T& item) const {
+    return find(item) != end();
+}
+
+template <class T>
+T& CompactDoublyLinkedList<T>::operator[](size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return nodes[node_at(index)].value;
+}
+
+template <class T>
+const T& CompactDoublyLinkedList<T>::operator[](size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return nodes[node_at(index)].value;
+}
+
+template <class T>
+void CompactDoublyLinkedList<T>::clear() {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (uint32_t i = 0; i < used; i++) {
+            nodes[i].value = T();
+        }
+    }
+    head = npos;
+    tail = npos;
+    free_head = npos;
+    used = 0;
+    _size = 0;
+}
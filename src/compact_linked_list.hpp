@@ -0,0 +1,305 @@
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../include/compact_linked_list.hpp"
+
+template <class T>
+CompactLinkedList<T>::CompactLinkedList()
+    : nodes{nullptr}, head{npos}, free_head{npos}, used{0}, _size(0),
+      _capacity(0) {}
+
+template <class T>
+CompactLinkedList<T>::~CompactLinkedList() {
+    delete[] nodes;
+}
+
+template <class T>
+CompactLinkedList<T>::CompactLinkedList(const CompactLinkedList& other)
+    : nodes{nullptr}, head{npos}, free_head{npos}, used{0}, _size(0),
+      _capacity(0) {
+    *this = other;
+}
+
+template <class T>
+CompactLinkedList<T>& CompactLinkedList<T>::operator=(
+    const CompactLinkedList<T>& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    reserve(other.size());
+
+    // Copia os nós na ordem da lista, deixando-os contíguos no arranjo.
+    auto pos = other.head;
+    uint32_t prev = npos;
+    while (pos != npos) {
+        auto new_node = allocate_node(other.nodes[pos].value);
+        if (prev == npos) {
+            head = new_node;
+        } else {
+            nodes[prev].next = new_node;
+        }
+        prev = new_node;
+        pos = other.nodes[pos].next;
+    }
+
+    _size = other.size();
+    return *this;
+}
+
+template <class T>
+size_t CompactLinkedList<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool CompactLinkedList<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+size_t CompactLinkedList<T>::capacity() const {
+    return _capacity;
+}
+
+template <class T>
+void CompactLinkedList<T>::reserve(size_t capacity) {
+    if (capacity <= _capacity) {
+        return;
+    } else if (capacity > npos) {
+        throw std::length_error("A lista esta cheia");
+    }
+    auto new_nodes = new Node[capacity];
+    for (uint32_t i = 0; i < used; i++) {
+        new_nodes[i].value = std::move(nodes[i].value);
+        new_nodes[i].next = nodes[i].next;
+    }
+    delete[] nodes;
+    nodes = new_nodes;
+    _capacity = capacity;
+}
+
+template <class T>
+size_t CompactLinkedList<T>::memory_usage() const {
+    return capacity() * node_bytes();
+}
+
+template <class T>
+uint32_t CompactLinkedList<T>::allocate_node(const T& value) {
+    if (free_head == npos && used == capacity()) {
+        // `value` pode ser um elemento desta lista, e `reserve` libera o
+        // arranjo antigo: a cópia é feita antes de crescer.
+        T copy = value;
+        reserve(capacity() == 0 ? 8 : capacity() * 2);
+        return allocate_node(copy);
+    }
+    uint32_t index;
+    if (free_head != npos) {
+        index = free_head;
+        free_head = nodes[index].next;
+    } else {
+        index = used++;
+    }
+    nodes[index].value = value;
+    nodes[index].next = npos;
+    return index;
+}
+
+template <class T>
+void CompactLinkedList<T>::release_node(uint32_t index) {
+    // O valor é descartado agora, e não quando o nó for reaproveitado.
+    nodes[index].value = T();
+    nodes[index].next = free_head;
+    free_head = index;
+}
+
+template <class T>
+uint32_t CompactLinkedList<T>::node_at(size_t index) const {
+    auto pos = head;
+    for (size_t i = 0; i < index; i++) {
+        pos = nodes[pos].next;
+    }
+    return pos;
+}
+
+template <class T>
+template <class L>
+CompactLinkedList<T>::Iterator<L>::Iterator(L* list, uint32_t index)
+    : list{list}, index{index} {}
+
+template <class T>
+template <class L>
+auto& CompactLinkedList<T>::Iterator<L>::operator*() const {
+    return list->nodes[index].value;
+}
+
+template <class T>
+template <class L>
+auto CompactLinkedList<T>::Iterator<L>::operator++() -> Iterator<L>& {
+    index = list->nodes[index].next;
+    return *this;
+}
+
+template <class T>
+template <class L>
+bool CompactLinkedList<T>::Iterator<L>::operator==(
+    const Iterator<L>& other) const {
+    return list == other.list && index == other.index;
+}
+
+template <class T>
+template <class L>
+bool CompactLinkedList<T>::Iterator<L>::operator!=(
+    const Iterator<L>& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+auto CompactLinkedList<T>::begin() const -> const_iterator {
+    return const_iterator(this, head);
+}
+
+template <class T>
+auto CompactLinkedList<T>::end() const -> const_iterator {
+    return const_iterator(this, npos);
+}
+
+template <class T>
+auto CompactLinkedList<T>::begin() -> iterator {
+    return iterator(this, head);
+}
+
+template <class T>
+auto CompactLinkedList<T>::end() -> iterator {
+    return iterator(this, npos);
+}
+
+template <class T>
+void CompactLinkedList<T>::push_front(const T& value) {
+    auto new_node = allocate_node(value);
+    nodes[new_node].next = head;
+    head = new_node;
+    _size++;
+}
+
+template <class T>
+void CompactLinkedList<T>::insert(size_t index, const T& value) {
+    if (index > size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    if (index == 0) {
+        return push_front(value);
+    }
+
+    auto prev = node_at(index - 1);
+    auto new_node = allocate_node(value);
+    nodes[new_node].next = nodes[prev].next;
+    nodes[prev].next = new_node;
+
+    _size++;
+}
+
+template <class T>
+void CompactLinkedList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("Lista vazia");
+    }
+
+    auto old_head = head;
+    head = nodes[head].next;
+    release_node(old_head);
+
+    _size--;
+}
+
+template <class T>
+void CompactLinkedList<T>::remove(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+
+    if (index == 0) {
+        return pop_front();
+    }
+
+    auto prev = node_at(index - 1);
+    auto pos = nodes[prev].next;
+    nodes[prev].next = nodes[pos].next;
+    release_node(pos);
+
+    _size--;
+}
+
+template <class T>
+void CompactLinkedList<T>::clear() {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (uint32_t i = 0; i < used; i++) {
+            nodes[i].value = T();
+        }
+    }
+    head = npos;
+    free_head = npos;
+    used = 0;
+    _size = 0;
+}
+
+template <class T>
+T& CompactLinkedList<T>::find(const T& item) {
+    for (auto& value : *this) {
+        if (value == item) {
+            return value;
+        }
+    }
+
+    throw std::out_of_range("O item nao foi encontrado");
+}
+
+template <class T>
+const T& CompactLinkedList<T>::find(const T& item) const {
+    for (auto& value : *this) {
+        if (value == item) {
+            return value;
+        }
+    }
+
+    throw std::out_of_range("O item nao foi encontrado");
+}
+
+template <class T>
+bool CompactLinkedList<T>::contains(const T& item) const {
+    for (auto& value : *this) {
+        if (value == item) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class T>
+T& CompactLinkedList<T>::operator[](size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+
+    return nodes[node_at(index)].value;
+}
+
+template <class T>
+const T& CompactLinkedList<T>::operator[](size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+
+    return nodes[node_at(index)].value;
+}
+
+template <class T>
+void CompactLinkedList<T>::print() const {
+    for (auto& value : *this) {
+        std::cout << value << " -> ";
+    }
+    std::cout << "NULL\n";
+}
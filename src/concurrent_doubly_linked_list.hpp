@@ -0,0 +1,177 @@
+#include <stdexcept>
+#include <thread>
+
+#include "../include/concurrent_doubly_linked_list.hpp"
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::Node::Node(const T& value) : value{value} {
+    this->next = nullptr;
+    this->prev = nullptr;
+}
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::ConcurrentDoublyLinkedList() : _size(0) {
+    head.next = &tail;
+    head.prev = nullptr;
+    tail.next = nullptr;
+    tail.prev = &head;
+}
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::~ConcurrentDoublyLinkedList() {
+    auto pos = head.next;
+    while (pos != &tail) {
+        auto next = pos->next;
+        delete static_cast<Node*>(pos);
+        pos = next;
+    }
+}
+
+template <class T>
+size_t ConcurrentDoublyLinkedList<T>::size() const {
+    return _size.load();
+}
+
+template <class T>
+bool ConcurrentDoublyLinkedList<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::Cursor::Cursor(ConcurrentDoublyLinkedList* list,
+                                              Link* prev, Link* node)
+    : list{list}, prev{prev}, node{node} {}
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::Cursor::Cursor(Cursor&& other)
+    : list{other.list}, prev{other.prev}, node{other.node} {
+    other.list = nullptr;
+}
+
+template <class T>
+ConcurrentDoublyLinkedList<T>::Cursor::~Cursor() {
+    if (list != nullptr) {
+        node->lock.unlock();
+        prev->lock.unlock();
+    }
+}
+
+template <class T>
+bool ConcurrentDoublyLinkedList<T>::Cursor::valid() const {
+    return node != &list->tail;
+}
+
+template <class T>
+T& ConcurrentDoublyLinkedList<T>::Cursor::operator*() const {
+    return static_cast<Node*>(node)->value;
+}
+
+template <class T>
+auto ConcurrentDoublyLinkedList<T>::Cursor::operator++() -> Cursor& {
+    if (!valid()) {
+        throw std::out_of_range("O cursor esta no final da lista");
+    }
+    auto next = node->next;
+    next->lock.lock();
+    prev->lock.unlock();
+    prev = node;
+    node = next;
+    return *this;
+}
+
+template <class T>
+auto ConcurrentDoublyLinkedList<T>::begin() -> Cursor {
+    head.lock.lock();
+    auto first = head.next;
+    first->lock.lock();
+    return Cursor(this, &head, first);
+}
+
+template <class T>
+void ConcurrentDoublyLinkedList<T>::push_front(const T& value) {
+    auto pos = begin();
+    insert(pos, value);
+}
+
+template <class T>
+void ConcurrentDoublyLinkedList<T>::push_back(const T& value) {
+    while (true) {
+        tail.lock.lock();
+        // Com o sentinela final travado, o último nó não pode ser removido,
+        // mas travá-lo agora inverte a ordem das travas: só tentamos, e em
+        // caso de falha soltamos tudo e recomeçamos.
+        auto last = tail.prev;
+        if (last->lock.try_lock()) {
+            Cursor pos(this, last, &tail);
+            insert(pos, value);
+            return;
+        }
+        tail.lock.unlock();
+        std::this_thread::yield();
+    }
+}
+
+template <class T>
+void ConcurrentDoublyLinkedList<T>::insert(Cursor& pos, const T& value) {
+    // O novo nó passa a ser o anterior do cursor, então é travado antes de
+    // ser ligado; ninguém mais o alcança, e a tentativa sempre funciona.
+    auto new_node = new Node(value);
+    new_node->lock.try_lock();
+    new_node->prev = pos.prev;
+    new_node->next = pos.node;
+    pos.prev->next = new_node;
+    pos.node->prev = new_node;
+    _size++;
+
+    pos.prev->lock.unlock();
+    pos.prev = new_node;
+}
+
+template <class T>
+void ConcurrentDoublyLinkedList<T>::erase(Cursor& pos) {
+    if (!pos.valid()) {
+        throw std::out_of_range("O cursor esta no final da lista");
+    }
+    auto victim = pos.node;
+    auto next = victim->next;
+    next->lock.lock();
+    pos.prev->next = next;
+    next->prev = pos.prev;
+    pos.node = next;
+    _size--;
+
+    victim->lock.unlock();
+    delete static_cast<Node*>(victim);
+}
+
+template <class T>
+bool ConcurrentDoublyLinkedList<T>::erase(const T& item) {
+    auto pos = find(item);
+    if (!pos.valid()) {
+        return false;
+    }
+    erase(pos);
+    return true;
+}
+
+template <class T>
+auto ConcurrentDoublyLinkedList<T>::find(const T& item) -> Cursor {
+    auto pos = begin();
+    while (pos.valid() && !(*pos == item)) {
+        ++pos;
+    }
+    return pos;
+}
+
+template <class T>
+bool ConcurrentDoublyLinkedList<T>::contains(const T& item) {
+    return find(item).valid();
+}
+
+template <class T>
+template <class F>
+void ConcurrentDoublyLinkedList<T>::for_each(F f) {
+    for (auto pos = begin(); pos.valid(); ++pos) {
+        f(*pos);
+    }
+}
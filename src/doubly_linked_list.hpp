@@ -1,26 +1,19 @@
 #include <iostream>
+#include <stdexcept>
 #include "../include/doubly_linked_list.hpp"
 
 template <class T>
 DoublyLinkedList<T>::Node::Node(const T& value)
-    : value{value}, next{nullptr}, prev{nullptr} {}
-
-template <class T>
-DoublyLinkedList<T>::Node::~Node() {
-    if (next != nullptr) {
-        delete next;
-    }
-}
+    : Link{nullptr, nullptr}, value{value} {}
 
 template <class T>
 DoublyLinkedList<T>::DoublyLinkedList()
-    : head{nullptr}, tail{nullptr}, _size(0) {}
+    : sentinel{&sentinel, &sentinel}, _size(0), finger{nullptr},
+      finger_index(0) {}
 
 template <class T>
 DoublyLinkedList<T>::~DoublyLinkedList() {
-    if (head != nullptr) {
-        delete head;
-    }
+    clear();
 }
 
 template <class T>
@@ -35,15 +28,7 @@ bool DoublyLinkedList<T>::empty() const {
 
 template <class T>
 void DoublyLinkedList<T>::push_front(const T& value) {
-    auto new_node = new Node(value);
-    if (empty()) {
-        tail = new_node;
-    } else {
-        new_node->next = head;
-        head->prev = new_node;
-    }
-    head = new_node;
-    _size++;
+    insert(begin(), value);
 }
 
 template <class T>
@@ -56,15 +41,7 @@ void DoublyLinkedList<T>::print() const {
 
 template <class T>
 void DoublyLinkedList<T>::push_back(const T& value) {
-    auto new_node = new Node(value);
-    if (empty()) {
-        head = new_node;
-    } else {
-        new_node->prev = tail;
-        tail->next = new_node;
-    }
-    tail = new_node;
-    _size++;
+    insert(end(), value);
 }
 
 template <class T>
@@ -72,55 +49,48 @@ void DoublyLinkedList<T>::pop_front() {
     if (empty()) {
         throw std::out_of_range("A lista esta vazia");
     }
-    auto tmp = head;
-    head = head->next;
-    if (head != nullptr) {
-        head->prev = nullptr;
-    } else {
-        tail = nullptr;
-    }
-    tmp->next = nullptr;
-    delete tmp;
-    _size--;
+    erase(begin(), ++begin());
 }
 
 template <class T>
 void DoublyLinkedList<T>::pop_back() {
     if (empty()) {
         throw std::out_of_range("Lista esta vazia");
-    } else if (size() == 1) {
-        delete tail;
-        head = nullptr;
-        tail = nullptr;
-    } else {
-        auto temp = tail;
-        tail = tail->prev;
-        tail->next = nullptr;
-        delete temp;
     }
-    _size--;
+    erase(--end(), end());
 }
 
 template <class T>
 template <class U>
-DoublyLinkedList<T>::Iterator<U>::Iterator(U* ptr, bool end)
-    : node{ptr}, end{end} {}
+DoublyLinkedList<T>::Iterator<U>::Iterator() : node{nullptr} {}
 
 template <class T>
 template <class U>
-auto& DoublyLinkedList<T>::Iterator<U>::operator*() const {
-    return node->value;
+DoublyLinkedList<T>::Iterator<U>::Iterator(link_type* ptr) : node{ptr} {}
+
+template <class T>
+template <class U>
+template <class V, class>
+DoublyLinkedList<T>::Iterator<U>::Iterator(const Iterator<V>& other)
+    : node{other.node} {}
+
+template <class T>
+template <class U>
+auto DoublyLinkedList<T>::Iterator<U>::operator*() const -> reference {
+    return static_cast<U*>(node)->value;
+}
+
+template <class T>
+template <class U>
+auto DoublyLinkedList<T>::Iterator<U>::operator->() const -> pointer {
+    return &static_cast<U*>(node)->value;
 }
 
 template <class T>
 template <class U>
 DoublyLinkedList<T>::Iterator<U>&
 DoublyLinkedList<T>::Iterator<U>::operator++() {
-    if (node->next == nullptr) {
-        end = true;
-    } else {
-        node = node->next;
-    }
+    node = node->next;
     return *this;
 }
 
@@ -128,46 +98,100 @@ template <class T>
 template <class U>
 DoublyLinkedList<T>::Iterator<U>&
 DoublyLinkedList<T>::Iterator<U>::operator--() {
-    if (end) {
-        end = false;
-    } else {
-        node = node->prev;
-    }
+    node = node->prev;
     return *this;
 }
 
 template <class T>
 template <class U>
+auto DoublyLinkedList<T>::Iterator<U>::operator++(int) -> Iterator<U> {
+    auto old = *this;
+    node = node->next;
+    return old;
+}
+
+template <class T>
+template <class U>
+auto DoublyLinkedList<T>::Iterator<U>::operator--(int) -> Iterator<U> {
+    auto old = *this;
+    node = node->prev;
+    return old;
+}
+
+template <class T>
+template <class U>
+template <class V>
 bool DoublyLinkedList<T>::Iterator<U>::operator==(
-    const Iterator<U>& other) const {
-    return node == other.node && end == other.end;
+    const Iterator<V>& other) const {
+    return node == other.node;
 }
 
 template <class T>
 template <class U>
+template <class V>
 bool DoublyLinkedList<T>::Iterator<U>::operator!=(
-    const Iterator<U>& other) const {
+    const Iterator<V>& other) const {
     return !(*this == other);
 }
 
 template <class T>
 auto DoublyLinkedList<T>::begin() const -> const_iterator {
-    return const_iterator(head, empty());
+    return const_iterator(sentinel.next);
 }
 
 template <class T>
 auto DoublyLinkedList<T>::begin() -> iterator {
-    return iterator(head, empty());
+    return iterator(sentinel.next);
 }
 
 template <class T>
 auto DoublyLinkedList<T>::end() const -> const_iterator {
-    return const_iterator(tail, true);
+    return const_iterator(&sentinel);
 }
 
 template <class T>
 auto DoublyLinkedList<T>::end() -> iterator {
-    return iterator(tail, true);
+    return iterator(&sentinel);
+}
+
+template <class T>
+auto DoublyLinkedList<T>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template <class T>
+auto DoublyLinkedList<T>::cend() const -> const_iterator {
+    return end();
+}
+
+template <class T>
+auto DoublyLinkedList<T>::rbegin() -> reverse_iterator {
+    return reverse_iterator(end());
+}
+
+template <class T>
+auto DoublyLinkedList<T>::rend() -> reverse_iterator {
+    return reverse_iterator(begin());
+}
+
+template <class T>
+auto DoublyLinkedList<T>::rbegin() const -> const_reverse_iterator {
+    return const_reverse_iterator(end());
+}
+
+template <class T>
+auto DoublyLinkedList<T>::rend() const -> const_reverse_iterator {
+    return const_reverse_iterator(begin());
+}
+
+template <class T>
+auto DoublyLinkedList<T>::crbegin() const -> const_reverse_iterator {
+    return rbegin();
+}
+
+template <class T>
+auto DoublyLinkedList<T>::crend() const -> const_reverse_iterator {
+    return rend();
 }
 
 template <class T>
@@ -195,18 +219,16 @@ auto DoublyLinkedList<T>::Iterator<U>::operator-(size_t offset) const
 
 template <class T>
 void DoublyLinkedList<T>::insert(iterator pos, const T& value) {
-    if (pos == begin()) {
-        return push_front(value);
-    } else if (pos == end()) {
-        return push_back(value);
-    }
     auto node_pos = pos.node;
-    auto node_prev = (--pos).node;
+    auto node_prev = node_pos->prev;
     auto new_node = new Node(value);
     node_prev->next = new_node;
     new_node->next = node_pos;
     new_node->prev = node_prev;
     node_pos->prev = new_node;
+    if (node_pos != &sentinel) {
+        finger = nullptr;
+    }
     _size++;
 }
 
@@ -214,43 +236,47 @@ template <class T>
 void DoublyLinkedList<T>::erase(iterator first, iterator last) {
     if (first == last) {
         return;
-    } else if (first == begin() && last == end()) {
-        delete head;
-        head = nullptr;
-        tail = nullptr;
-        _size = 0;
-        return;
-    } else if (first == begin()) {
-        auto num_elementos_removido = last - first;
-        auto last_node = last.node;
-        auto last_prev_node = (--last).node;
-        last_node->prev = nullptr;
-        last_prev_node->next = nullptr;
-        head = last_node;
-        delete first.node;
-        _size -= num_elementos_removido;
-        return;
-    } else if (last == end()) {
-        auto num_elementos_removido = last - first;
-        auto first_node = first.node;
-        auto first_prev_node = (--first).node;
-        first_prev_node->next = nullptr;
-        tail = first_prev_node;
-        delete first_node;
-        _size -= num_elementos_removido;
+    }
+    finger = nullptr;
+
+    auto before = first.node->prev;
+    auto after = last.node;
+    before->next = after;
+    after->prev = before;
+
+    auto pos = first.node;
+    while (pos != after) {
+        auto next = pos->next;
+        delete static_cast<Node*>(pos);
+        _size--;
+        pos = next;
+    }
+}
+
+template <class T>
+void DoublyLinkedList<T>::splice(iterator pos, DoublyLinkedList<T>& other,
+                                 iterator first, iterator last,
+                                 size_t count) {
+    if (first == last || pos == first || pos == last) {
         return;
-    } else {
-        auto num_elementos_removido = last - first;
-        auto first_node = first.node;
-        auto first_prev_node = (--first).node;
-        auto last_node = last.node;
-        auto last_prev_node = (--last).node;
-        first_prev_node->next = last_node;
-        last_node->prev = first_prev_node;
-        last_prev_node->next = nullptr;
-        delete first_node;
-        _size -= num_elementos_removido;
     }
+    finger = nullptr;
+    other.finger = nullptr;
+
+    auto first_node = first.node;
+    auto last_node = last.node->prev;
+    first_node->prev->next = last.node;
+    last.node->prev = first_node->prev;
+
+    auto node_pos = pos.node;
+    auto node_prev = node_pos->prev;
+    node_prev->next = first_node;
+    first_node->prev = node_prev;
+    last_node->next = node_pos;
+    node_pos->prev = last_node;
+
+    other._size -= count;
+    _size += count;
 }
 
 template <class T>
@@ -296,7 +322,7 @@ T& DoublyLinkedList<T>::operator[](size_t index) {
     if (index >= size()) {
         throw std::out_of_range("Indice invalido");
     }
-    return *(begin() + index);
+    return node_at(index)->value;
 }
 
 template <class T>
@@ -304,7 +330,79 @@ const T& DoublyLinkedList<T>::operator[](size_t index) const {
     if (index >= size()) {
         throw std::out_of_range("Indice invalido");
     }
-    return *(begin() + index);
+    return node_at(index)->value;
+}
+
+template <class T>
+T& DoublyLinkedList<T>::at(size_t index) {
+    return (*this)[index];
+}
+
+template <class T>
+const T& DoublyLinkedList<T>::at(size_t index) const {
+    return (*this)[index];
+}
+
+template <class T>
+void DoublyLinkedList<T>::insert_at(size_t index, const T& value) {
+    if (index > size()) {
+        throw std::out_of_range("Indice invalido");
+    } else if (index == size()) {
+        return push_back(value);
+    }
+    auto node_pos = node_at(index);
+    insert(iterator(node_pos), value);
+    finger = static_cast<Node*>(node_pos->prev);
+    finger_index = index;
+}
+
+template <class T>
+void DoublyLinkedList<T>::erase_at(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    iterator pos(node_at(index));
+    auto next = pos.node->next;
+    erase(pos, iterator(next));
+    if (next != &sentinel) {
+        finger = static_cast<Node*>(next);
+        finger_index = index;
+    }
+}
+
+template <class T>
+auto DoublyLinkedList<T>::node_at(size_t index) const -> Node* {
+    const Link* pos = sentinel.next;
+    size_t pos_index = 0;
+    size_t distance = index;
+    if (size() - 1 - index < distance) {
+        pos = sentinel.prev;
+        pos_index = size() - 1;
+        distance = size() - 1 - index;
+    }
+    if (finger != nullptr) {
+        auto finger_distance = index > finger_index ? index - finger_index
+                                                    : finger_index - index;
+        if (finger_distance < distance) {
+            pos = finger;
+            pos_index = finger_index;
+        }
+    }
+    for (; pos_index < index; pos_index++) {
+        pos = pos->next;
+    }
+    for (; pos_index > index; pos_index--) {
+        pos = pos->prev;
+    }
+    return static_cast<Node*>(const_cast<Link*>(pos));
+}
+
+template <class T>
+auto DoublyLinkedList<T>::node_at(size_t index) -> Node* {
+    auto pos = static_cast<const DoublyLinkedList&>(*this).node_at(index);
+    finger = pos;
+    finger_index = index;
+    return pos;
 }
 
 template <class T>
@@ -314,7 +412,8 @@ void DoublyLinkedList<T>::clear() {
 
 template <class T>
 DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list)
-    : head{nullptr}, tail{nullptr}, _size(0) {
+    : sentinel{&sentinel, &sentinel}, _size(0), finger{nullptr},
+      finger_index(0) {
     for (auto& i : list) {
         push_back(i);
     }
@@ -323,9 +422,12 @@ DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& list)
 template <class T>
 DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(
     const DoublyLinkedList<T>& list) {
+    if (this == &list) {
+        return *this;
+    }
     clear();
     for (auto& i : list) {
         push_back(i);
     }
     return *this;
-}
\ No newline at end of file
+}
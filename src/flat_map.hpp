@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "../include/flat_map.hpp"
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap()
+    : keys{nullptr}, entries{nullptr}, _size{0}, _capacity{0} {}
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(const VectorList<Pair<K, V>>& pairs) : FlatMap() {
+    insert_or_assign_batch(pairs);
+}
+
+template <class K, class V>
+FlatMap<K, V>::~FlatMap() {
+    delete[] keys;
+    delete[] entries;
+}
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(const FlatMap& other) : FlatMap() {
+    *this = other;
+}
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(FlatMap&& other)
+    : keys{other.keys}, entries{other.entries}, _size{other._size},
+      _capacity{other._capacity} {
+    other.keys = nullptr;
+    other.entries = nullptr;
+    other._size = 0;
+    other._capacity = 0;
+}
+
+template <class K, class V>
+FlatMap<K, V>& FlatMap<K, V>::operator=(const FlatMap& other) {
+    if (this != &other) {
+        clear();
+        reserve(other._size);
+        std::copy(other.keys, other.keys + other._size, keys);
+        std::copy(other.entries, other.entries + other._size, entries);
+        _size = other._size;
+    }
+    return *this;
+}
+
+template <class K, class V>
+FlatMap<K, V>& FlatMap<K, V>::operator=(FlatMap&& other) {
+    if (this != &other) {
+        delete[] keys;
+        delete[] entries;
+        keys = other.keys;
+        entries = other.entries;
+        _size = other._size;
+        _capacity = other._capacity;
+        other.keys = nullptr;
+        other.entries = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+    return *this;
+}
+
+template <class K, class V>
+size_t FlatMap<K, V>::size() const {
+    return _size;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V>
+size_t FlatMap<K, V>::capacity() const {
+    return _capacity;
+}
+
+template <class K, class V>
+void FlatMap<K, V>::reserve(size_t capacity) {
+    if (capacity <= _capacity) {
+        return;
+    }
+    auto new_keys = new K[capacity];
+    auto new_entries = new Pair<K, V>[capacity];
+    std::move(keys, keys + _size, new_keys);
+    std::move(entries, entries + _size, new_entries);
+    delete[] keys;
+    delete[] entries;
+    keys = new_keys;
+    entries = new_entries;
+    _capacity = capacity;
+}
+
+template <class K, class V>
+void FlatMap<K, V>::grow(size_t count) {
+    if (count > _capacity) {
+        reserve(std::max(count, 2 * _capacity));
+    }
+}
+
+template <class K, class V>
+size_t FlatMap<K, V>::lower_bound(const K& key) const {
+    if (_size == 0) {
+        return 0;
+    }
+    // Busca sem desvios: o intervalo sempre cai pela metade, e a escolha da
+    // metade vira um movimento condicional.
+    const K* base = keys;
+    size_t length = _size;
+    while (length > 1) {
+        auto half = length / 2;
+        base = base[half] < key ? base + half : base;
+        length -= half;
+    }
+    return static_cast<size_t>(base - keys) + (*base < key);
+}
+
+template <class K, class V>
+V* FlatMap<K, V>::find(const K& key) {
+    auto position = lower_bound(key);
+    if (position == _size || key < keys[position]) {
+        return nullptr;
+    }
+    return &entries[position].second();
+}
+
+template <class K, class V>
+const V* FlatMap<K, V>::find(const K& key) const {
+    auto position = lower_bound(key);
+    if (position == _size || key < keys[position]) {
+        return nullptr;
+    }
+    return &entries[position].second();
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::contains(const K& key) const {
+    return find(key) != nullptr;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::insert_or_assign(const K& key, const V& value) {
+    auto position = lower_bound(key);
+    if (position < _size && !(key < keys[position])) {
+        entries[position].second() = value;
+        return false;
+    }
+    // A chave e o valor podem estar no próprio mapa, e tanto `grow` quanto
+    // o deslocamento mexem nos arranjos: o par é copiado antes.
+    Pair<K, V> entry(key, value);
+    grow(_size + 1);
+    std::move_backward(keys + position, keys + _size, keys + _size + 1);
+    std::move_backward(entries + position, entries + _size,
+                       entries + _size + 1);
+    keys[position] = entry.first();
+    entries[position] = std::move(entry);
+    _size++;
+    return true;
+}
+
+template <class K, class V>
+size_t FlatMap<K, V>::insert_or_assign_batch(
+    const VectorList<Pair<K, V>>& updates) {
+    auto count = updates.size();
+    if (count == 0) {
+        return 0;
+    }
+
+    // Ordena o lote e mantém, para cada chave, o último valor.
+    auto batch = new Pair<K, V>[count];
+    for (size_t i = 0; i < count; i++) {
+        batch[i] = updates[i];
+    }
+    std::stable_sort(batch, batch + count,
+                     [](const Pair<K, V>& a, const Pair<K, V>& b) {
+                         return a.first() < b.first();
+                     });
+    size_t unique = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (unique > 0 && !(batch[unique - 1].first() < batch[i].first())) {
+            batch[unique - 1].second() = std::move(batch[i].second());
+        } else {
+            batch[unique++] = std::move(batch[i]);
+        }
+    }
+
+    // Substitui os valores das chaves existentes e junta as novas no início
+    // do lote.
+    size_t added = 0;
+    for (size_t i = 0, j = 0; j < unique;) {
+        if (i == _size || batch[j].first() < keys[i]) {
+            if (added != j) {
+                batch[added] = std::move(batch[j]);
+            }
+            added++;
+            j++;
+        } else if (keys[i] < batch[j].first()) {
+            i++;
+        } else {
+            entries[i].second() = batch[j].second();
+            i++;
+            j++;
+        }
+    }
+
+    // Intercala de trás para frente: cada par muda de lugar uma única vez.
+    grow(_size + added);
+    auto i = _size;
+    auto j = added;
+    auto out = _size + added;
+    while (j > 0) {
+        if (i > 0 && batch[j - 1].first() < keys[i - 1]) {
+            i--;
+            out--;
+            keys[out] = std::move(keys[i]);
+            entries[out] = std::move(entries[i]);
+        } else {
+            j--;
+            out--;
+            keys[out] = batch[j].first();
+            entries[out] = std::move(batch[j]);
+        }
+    }
+    _size += added;
+    delete[] batch;
+    return added;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::erase(const K& key) {
+    auto position = lower_bound(key);
+    if (position == _size || key < keys[position]) {
+        return false;
+    }
+    std::move(keys + position + 1, keys + _size, keys + position);
+    std::move(entries + position + 1, entries + _size, entries + position);
+    _size--;
+    return true;
+}
+
+template <class K, class V>
+const Pair<K, V>& FlatMap<K, V>::operator[](size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return entries[index];
+}
+
+template <class K, class V>
+template <class F>
+size_t FlatMap<K, V>::range(const K& first, const K& last, F visit) const {
+    size_t count = 0;
+    for (auto i = lower_bound(first); i < _size && keys[i] < last; i++) {
+        visit(entries[i].first(), entries[i].second());
+        count++;
+    }
+    return count;
+}
+
+template <class K, class V>
+template <class F>
+void FlatMap<K, V>::for_each(F visit) const {
+    for (size_t i = 0; i < _size; i++) {
+        visit(entries[i].first(), entries[i].second());
+    }
+}
+
+template <class K, class V>
+void FlatMap<K, V>::clear() {
+    _size = 0;
+}
@@ -0,0 +1,430 @@
+#include "../include/geometry.hpp"
+
+#include <math.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define GEOMETRY_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// Menor número de pontos que vale a pena entregar a outra thread.
+constexpr size_t parallel_threshold = 1 << 15;
+
+/**
+ * @brief Um ponto copiado para os algoritmos, com a sua posição original.
+ */
+struct Vertex {
+    double x;
+    double y;
+    size_t index;
+};
+
+/**
+ * @brief Resolve o número de threads pedido e o limita pelo tamanho do
+ * problema.
+ */
+size_t parts_for(unsigned threads, size_t n) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t parts = threads == 0 ? 1 : threads;
+    auto useful = n / parallel_threshold;
+    if (parts > useful) {
+        parts = useful;
+    }
+    return parts == 0 ? 1 : parts;
+}
+
+/**
+ * @brief Executa `f(part, first, last)` sobre `parts` faixas contíguas de
+ * `[0, n)`, cada uma em uma thread.
+ */
+template <class F>
+void for_each_part(size_t n, size_t parts, F f) {
+    std::vector<std::thread> workers;
+    for (size_t part = 1; part < parts; part++) {
+        workers.emplace_back(f, part, n * part / parts,
+                             n * (part + 1) / parts);
+    }
+    f(0, 0, n / parts);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Copia os pontos de uma VectorList ou de uma PointCloud.
+ */
+Vertex* copy_vertices(const VectorList<Point>& points) {
+    auto vertices = new Vertex[points.size() > 0 ? points.size() : 1];
+    for (size_t i = 0; i < points.size(); i++) {
+        vertices[i] = Vertex{points[i].get_x(), points[i].get_y(), i};
+    }
+    return vertices;
+}
+
+Vertex* copy_vertices(const PointCloud& points) {
+    auto vertices = new Vertex[points.size() > 0 ? points.size() : 1];
+    auto xs = points.x_data();
+    auto ys = points.y_data();
+    for (size_t i = 0; i < points.size(); i++) {
+        vertices[i] = Vertex{xs[i], ys[i], i};
+    }
+    return vertices;
+}
+
+BoundingBox merge_boxes(const BoundingBox& a, const BoundingBox& b) {
+    return BoundingBox{std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y),
+                       std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y)};
+}
+
+void box_scalar(const double* xs, const double* ys, size_t n,
+                BoundingBox& box) {
+    for (size_t i = 0; i < n; i++) {
+        box.min_x = xs[i] < box.min_x ? xs[i] : box.min_x;
+        box.max_x = xs[i] > box.max_x ? xs[i] : box.max_x;
+        box.min_y = ys[i] < box.min_y ? ys[i] : box.min_y;
+        box.max_y = ys[i] > box.max_y ? ys[i] : box.max_y;
+    }
+}
+
+#ifdef GEOMETRY_AVX2
+bool has_avx2() {
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+}
+
+/// Reduz os quatro valores de um registro com `op`.
+template <class Op>
+__attribute__((target("avx2"))) double reduce(__m256d v, Op op) {
+    double values[4];
+    _mm256_storeu_pd(values, v);
+    return op(op(values[0], values[1]), op(values[2], values[3]));
+}
+
+__attribute__((target("avx2"))) void box_avx2(const double* xs,
+                                              const double* ys, size_t n,
+                                              BoundingBox& box) {
+    auto min_x = _mm256_set1_pd(box.min_x);
+    auto max_x = _mm256_set1_pd(box.max_x);
+    auto min_y = _mm256_set1_pd(box.min_y);
+    auto max_y = _mm256_set1_pd(box.max_y);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto x = _mm256_loadu_pd(xs + i);
+        auto y = _mm256_loadu_pd(ys + i);
+        min_x = _mm256_min_pd(min_x, x);
+        max_x = _mm256_max_pd(max_x, x);
+        min_y = _mm256_min_pd(min_y, y);
+        max_y = _mm256_max_pd(max_y, y);
+    }
+    auto lower = [](double a, double b) { return a < b ? a : b; };
+    auto upper = [](double a, double b) { return a > b ? a : b; };
+    box.min_x = reduce(min_x, lower);
+    box.max_x = reduce(max_x, upper);
+    box.min_y = reduce(min_y, lower);
+    box.max_y = reduce(max_y, upper);
+    box_scalar(xs + i, ys + i, n - i, box);
+}
+#endif
+
+/// Retângulo de `n > 0` pontos em arranjos separados.
+BoundingBox box_of(const double* xs, const double* ys, size_t n) {
+    BoundingBox box{xs[0], ys[0], xs[0], ys[0]};
+#ifdef GEOMETRY_AVX2
+    if (has_avx2()) {
+        box_avx2(xs, ys, n, box);
+        return box;
+    }
+#endif
+    box_scalar(xs, ys, n, box);
+    return box;
+}
+
+/**
+ * @brief Produto vetorial de `a - o` por `b - o`: positivo se `o`, `a`, `b`
+ * fazem uma curva à esquerda.
+ */
+double cross(const Vertex& o, const Vertex& a, const Vertex& b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+bool by_x(const Vertex& a, const Vertex& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+bool by_y(const Vertex& a, const Vertex& b) {
+    return a.y < b.y;
+}
+
+/**
+ * @brief Cadeia monótona de Andrew sobre `[first, first + n)`. Ordena o
+ * trecho e grava os vértices do fecho no seu início.
+ * @return Número de vértices do fecho.
+ */
+size_t monotone_chain(Vertex* first, size_t n) {
+    std::sort(first, first + n, by_x);
+    n = std::unique(first, first + n,
+                    [](const Vertex& a, const Vertex& b) {
+                        return a.x == b.x && a.y == b.y;
+                    }) -
+        first;
+    if (n < 3) {
+        return n;
+    }
+
+    auto hull = new Vertex[2 * n];
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], first[i]) <= 0) {
+            k--;
+        }
+        hull[k++] = first[i];
+    }
+    for (size_t i = n - 1, lower = k + 1; i > 0; i--) {
+        while (k >= lower &&
+               cross(hull[k - 2], hull[k - 1], first[i - 1]) <= 0) {
+            k--;
+        }
+        hull[k++] = first[i - 1];
+    }
+    // O último vértice repete o primeiro.
+    std::copy(hull, hull + k - 1, first);
+    delete[] hull;
+    return k - 1;
+}
+
+VectorList<Point> convex_hull_of(Vertex* vertices, size_t n,
+                                 unsigned threads) {
+    if (n == 0) {
+        return VectorList<Point>(0);
+    }
+
+    // Extremos em x e em y, que formam um quadrilátero dentro do fecho.
+    Vertex left = vertices[0], right = vertices[0];
+    Vertex bottom = vertices[0], top = vertices[0];
+    for (size_t i = 1; i < n; i++) {
+        const auto& v = vertices[i];
+        left = by_x(v, left) ? v : left;
+        right = by_x(right, v) ? v : right;
+        bottom = v.y < bottom.y ? v : bottom;
+        top = v.y > top.y ? v : top;
+    }
+    auto inside = [&](const Vertex& v) {
+        return cross(left, bottom, v) > 0 && cross(bottom, right, v) > 0 &&
+               cross(right, top, v) > 0 && cross(top, left, v) > 0;
+    };
+
+    // Cada faixa descarta os pontos internos e calcula o próprio fecho,
+    // gravado no início da faixa.
+    auto parts = parts_for(threads, n);
+    std::vector<size_t> firsts(parts);
+    std::vector<size_t> counts(parts);
+    for_each_part(n, parts, [&](size_t part, size_t first, size_t last) {
+        auto kept = first;
+        for (auto i = first; i < last; i++) {
+            if (!inside(vertices[i])) {
+                vertices[kept++] = vertices[i];
+            }
+        }
+        firsts[part] = first;
+        counts[part] = monotone_chain(vertices + first, kept - first);
+    });
+
+    // O fecho dos vértices das faixas é o fecho de todos os pontos.
+    size_t total = 0;
+    for (size_t part = 0; part < parts; part++) {
+        if (total != firsts[part]) {
+            std::copy(vertices + firsts[part],
+                      vertices + firsts[part] + counts[part],
+                      vertices + total);
+        }
+        total += counts[part];
+    }
+    if (parts > 1) {
+        total = monotone_chain(vertices, total);
+    }
+
+    VectorList<Point> hull(total);
+    for (size_t i = 0; i < total; i++) {
+        hull.push_back(Point(vertices[i].x, vertices[i].y));
+    }
+    return hull;
+}
+
+/**
+ * @brief Melhor par encontrado até então, com a distância ao quadrado.
+ */
+struct Best {
+    double distance;
+    size_t first;
+    size_t second;
+};
+
+void consider(Best& best, const Vertex& a, const Vertex& b) {
+    auto dx = a.x - b.x;
+    auto dy = a.y - b.y;
+    auto distance = dx * dx + dy * dy;
+    if (distance < best.distance) {
+        best = Best{distance, a.index, b.index};
+    }
+}
+
+/**
+ * @brief Resolve o trecho `[lo, hi)`, ordenado por x, deixando-o ordenado
+ * por y. `buffer` é usado no mesmo trecho, então trechos disjuntos podem
+ * ser resolvidos ao mesmo tempo.
+ */
+Best closest_in(Vertex* points, Vertex* buffer, size_t lo, size_t hi,
+                size_t threads) {
+    Best best{INFINITY, 0, 0};
+    if (hi - lo <= 3) {
+        for (auto i = lo; i < hi; i++) {
+            for (auto j = i + 1; j < hi; j++) {
+                consider(best, points[i], points[j]);
+            }
+        }
+        std::sort(points + lo, points + hi, by_y);
+        return best;
+    }
+
+    auto mid = lo + (hi - lo) / 2;
+    auto mid_x = points[mid].x;
+    Best left_best;
+    Best right_best;
+    if (threads > 1 && hi - lo >= parallel_threshold) {
+        auto left_threads = threads / 2;
+        std::thread left([&] {
+            left_best = closest_in(points, buffer, lo, mid, left_threads);
+        });
+        right_best =
+            closest_in(points, buffer, mid, hi, threads - left_threads);
+        left.join();
+    } else {
+        left_best = closest_in(points, buffer, lo, mid, 1);
+        right_best = closest_in(points, buffer, mid, hi, 1);
+    }
+    best = left_best.distance <= right_best.distance ? left_best : right_best;
+
+    std::merge(points + lo, points + mid, points + mid, points + hi,
+               buffer + lo, by_y);
+    std::copy(buffer + lo, buffer + hi, points + lo);
+
+    // Só os pontos a menos de `best` da divisão podem formar um par melhor,
+    // e cada um só precisa ser comparado com os seguintes até essa altura.
+    auto strip = buffer + lo;
+    size_t size = 0;
+    for (auto i = lo; i < hi; i++) {
+        auto dx = points[i].x - mid_x;
+        if (dx * dx < best.distance) {
+            strip[size++] = points[i];
+        }
+    }
+    for (size_t i = 0; i < size; i++) {
+        for (auto j = i + 1; j < size; j++) {
+            auto dy = strip[j].y - strip[i].y;
+            if (dy * dy >= best.distance) {
+                break;
+            }
+            consider(best, strip[i], strip[j]);
+        }
+    }
+    return best;
+}
+
+ClosestPair closest_pair_of(Vertex* vertices, size_t n, unsigned threads) {
+    if (n < 2) {
+        delete[] vertices;
+        throw std::invalid_argument("Sao necessarios pelo menos dois pontos");
+    }
+    std::sort(vertices, vertices + n, by_x);
+    auto buffer = new Vertex[n];
+    auto best = closest_in(vertices, buffer, 0, n, parts_for(threads, n));
+    delete[] buffer;
+    delete[] vertices;
+    return ClosestPair{std::min(best.first, best.second),
+                       std::max(best.first, best.second),
+                       sqrt(best.distance)};
+}
+
+}  // namespace
+
+BoundingBox bounding_box(const PointCloud& points, unsigned threads) {
+    if (points.empty()) {
+        throw std::out_of_range("A nuvem esta vazia");
+    }
+    auto xs = points.x_data();
+    auto ys = points.y_data();
+    auto parts = parts_for(threads, points.size());
+    std::vector<BoundingBox> boxes(parts);
+    for_each_part(points.size(), parts,
+                  [&](size_t part, size_t first, size_t last) {
+                      boxes[part] = box_of(xs + first, ys + first,
+                                           last - first);
+                  });
+    auto box = boxes[0];
+    for (size_t part = 1; part < parts; part++) {
+        box = merge_boxes(box, boxes[part]);
+    }
+    return box;
+}
+
+BoundingBox bounding_box(const VectorList<Point>& points, unsigned threads) {
+    if (points.empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    auto parts = parts_for(threads, points.size());
+    std::vector<BoundingBox> boxes(parts);
+    for_each_part(points.size(), parts,
+                  [&](size_t part, size_t first, size_t last) {
+                      BoundingBox box{points[first].get_x(),
+                                      points[first].get_y(),
+                                      points[first].get_x(),
+                                      points[first].get_y()};
+                      for (auto i = first + 1; i < last; i++) {
+                          auto x = points[i].get_x();
+                          auto y = points[i].get_y();
+                          box.min_x = x < box.min_x ? x : box.min_x;
+                          box.max_x = x > box.max_x ? x : box.max_x;
+                          box.min_y = y < box.min_y ? y : box.min_y;
+                          box.max_y = y > box.max_y ? y : box.max_y;
+                      }
+                      boxes[part] = box;
+                  });
+    auto box = boxes[0];
+    for (size_t part = 1; part < parts; part++) {
+        box = merge_boxes(box, boxes[part]);
+    }
+    return box;
+}
+
+VectorList<Point> convex_hull(const VectorList<Point>& points,
+                              unsigned threads) {
+    auto vertices = copy_vertices(points);
+    auto hull = convex_hull_of(vertices, points.size(), threads);
+    delete[] vertices;
+    return hull;
+}
+
+VectorList<Point> convex_hull(const PointCloud& points, unsigned threads) {
+    auto vertices = copy_vertices(points);
+    auto hull = convex_hull_of(vertices, points.size(), threads);
+    delete[] vertices;
+    return hull;
+}
+
+ClosestPair closest_pair(const VectorList<Point>& points, unsigned threads) {
+    return closest_pair_of(copy_vertices(points), points.size(), threads);
+}
+
+ClosestPair closest_pair(const PointCloud& points, unsigned threads) {
+    return closest_pair_of(copy_vertices(points), points.size(), threads);
+}
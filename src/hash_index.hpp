@@ -0,0 +1,181 @@
+#include <stdint.h>
+
+#include "../include/hash_index.hpp"
+
+template <class K, class V, class Hash>
+HashIndex<K, V, Hash>::HashIndex(size_t capacity, const Hash& hash)
+    : slots{nullptr}, _size(0), slot_count(0), hash(hash) {
+    reserve(capacity);
+}
+
+template <class K, class V, class Hash>
+HashIndex<K, V, Hash>::HashIndex(const HashIndex& other)
+    : slots{nullptr}, _size(0), slot_count(0), hash(other.hash) {
+    *this = other;
+}
+
+template <class K, class V, class Hash>
+HashIndex<K, V, Hash>& HashIndex<K, V, Hash>::operator=(
+    const HashIndex& other) {
+    if (this == &other) {
+        return *this;
+    }
+    delete[] slots;
+    slots = nullptr;
+    slot_count = other.slot_count;
+    _size = other._size;
+    hash = other.hash;
+    if (slot_count > 0) {
+        slots = new Slot[slot_count];
+        for (size_t i = 0; i < slot_count; i++) {
+            slots[i] = other.slots[i];
+        }
+    }
+    return *this;
+}
+
+template <class K, class V, class Hash>
+HashIndex<K, V, Hash>::~HashIndex() {
+    delete[] slots;
+}
+
+template <class K, class V, class Hash>
+size_t HashIndex<K, V, Hash>::size() const {
+    return _size;
+}
+
+template <class K, class V, class Hash>
+bool HashIndex<K, V, Hash>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V, class Hash>
+void HashIndex<K, V, Hash>::reserve(size_t capacity) {
+    size_t needed = 8;
+    while (needed / 4 * 3 < capacity) {
+        needed *= 2;
+    }
+    if (needed > slot_count) {
+        rehash(needed);
+    }
+}
+
+template <class K, class V, class Hash>
+size_t HashIndex<K, V, Hash>::home_of(const K& key) const {
+    // Mistura os bits do hash, pois std::hash costuma ser a identidade para
+    // inteiros e a tabela usa apenas os bits baixos.
+    uint64_t h = hash(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h) & (slot_count - 1);
+}
+
+template <class K, class V, class Hash>
+size_t HashIndex<K, V, Hash>::slot_of(const K& key) const {
+    auto pos = home_of(key);
+    while (slots[pos].used && !(slots[pos].key == key)) {
+        pos = (pos + 1) & (slot_count - 1);
+    }
+    return pos;
+}
+
+template <class K, class V, class Hash>
+void HashIndex<K, V, Hash>::rehash(size_t new_slot_count) {
+    auto old_slots = slots;
+    auto old_slot_count = slot_count;
+    slots = new Slot[new_slot_count];
+    slot_count = new_slot_count;
+    for (size_t i = 0; i < slot_count; i++) {
+        slots[i].used = false;
+    }
+    for (size_t i = 0; i < old_slot_count; i++) {
+        if (old_slots[i].used) {
+            auto pos = slot_of(old_slots[i].key);
+            slots[pos] = old_slots[i];
+        }
+    }
+    delete[] old_slots;
+}
+
+template <class K, class V, class Hash>
+V* HashIndex<K, V, Hash>::find(const K& key) {
+    if (empty()) {
+        return nullptr;
+    }
+    auto pos = slot_of(key);
+    return slots[pos].used ? &slots[pos].value : nullptr;
+}
+
+template <class K, class V, class Hash>
+const V* HashIndex<K, V, Hash>::find(const K& key) const {
+    if (empty()) {
+        return nullptr;
+    }
+    auto pos = slot_of(key);
+    return slots[pos].used ? &slots[pos].value : nullptr;
+}
+
+template <class K, class V, class Hash>
+bool HashIndex<K, V, Hash>::contains(const K& key) const {
+    return find(key) != nullptr;
+}
+
+template <class K, class V, class Hash>
+void HashIndex<K, V, Hash>::insert(const K& key, const V& value) {
+    if (slot_count / 4 * 3 < size() + 1) {
+        // A tabela vai crescer, e `key` e `value` podem estar nela: são
+        // copiados antes que `reserve` libere as posições antigas.
+        K key_copy = key;
+        V value_copy = value;
+        reserve(size() + 1);
+        return insert(key_copy, value_copy);
+    }
+    auto pos = slot_of(key);
+    if (!slots[pos].used) {
+        slots[pos].key = key;
+        slots[pos].used = true;
+        _size++;
+    }
+    slots[pos].value = value;
+}
+
+template <class K, class V, class Hash>
+bool HashIndex<K, V, Hash>::erase(const K& key) {
+    if (empty()) {
+        return false;
+    }
+    auto hole = slot_of(key);
+    if (!slots[hole].used) {
+        return false;
+    }
+
+    // Desloca para trás os elementos do agrupamento cuja posição ideal não
+    // fica entre o buraco e a posição atual.
+    auto mask = slot_count - 1;
+    auto pos = (hole + 1) & mask;
+    while (slots[pos].used) {
+        auto home = home_of(slots[pos].key);
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            slots[hole] = slots[pos];
+            hole = pos;
+        }
+        pos = (pos + 1) & mask;
+    }
+    slots[hole].used = false;
+    _size--;
+    return true;
+}
+
+template <class K, class V, class Hash>
+void HashIndex<K, V, Hash>::clear() {
+    for (size_t i = 0; i < slot_count; i++) {
+        slots[i].used = false;
+    }
+    _size = 0;
+}
+
+template <class K, class V, class Hash>
+Hash HashIndex<K, V, Hash>::hash_function() const {
+    return hash;
+}
@@ -0,0 +1,332 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "../include/hash_map.hpp"
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>::HashMap(size_t capacity, double max_load_factor,
+                                    const Hash& hash, const Equal& equal)
+    : entries{nullptr}, distances{nullptr}, _size{0}, slot_count{0},
+      _max_load{0}, hash(hash), equal(equal) {
+    this->max_load_factor(max_load_factor);
+    reserve(capacity);
+}
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>::~HashMap() {
+    delete[] entries;
+    delete[] distances;
+}
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>::HashMap(const HashMap& other)
+    : entries{nullptr}, distances{nullptr}, _size{0}, slot_count{0},
+      _max_load{other._max_load}, hash(other.hash), equal(other.equal) {
+    *this = other;
+}
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>::HashMap(HashMap&& other)
+    : entries{other.entries}, distances{other.distances}, _size{other._size},
+      slot_count{other.slot_count}, _max_load{other._max_load},
+      hash(other.hash), equal(other.equal) {
+    other.entries = nullptr;
+    other.distances = nullptr;
+    other._size = 0;
+    other.slot_count = 0;
+}
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>& HashMap<K, V, Hash, Equal>::operator=(
+    const HashMap& other) {
+    if (this != &other) {
+        auto new_entries =
+            other.slot_count > 0 ? new Pair<K, V>[other.slot_count] : nullptr;
+        auto new_distances =
+            other.slot_count > 0 ? new uint8_t[other.slot_count] : nullptr;
+        for (size_t i = 0; i < other.slot_count; i++) {
+            new_distances[i] = other.distances[i];
+            if (other.distances[i] != 0) {
+                new_entries[i] = other.entries[i];
+            }
+        }
+        delete[] entries;
+        delete[] distances;
+        entries = new_entries;
+        distances = new_distances;
+        _size = other._size;
+        slot_count = other.slot_count;
+        _max_load = other._max_load;
+        hash = other.hash;
+        equal = other.equal;
+    }
+    return *this;
+}
+
+template <class K, class V, class Hash, class Equal>
+HashMap<K, V, Hash, Equal>& HashMap<K, V, Hash, Equal>::operator=(
+    HashMap&& other) {
+    if (this != &other) {
+        delete[] entries;
+        delete[] distances;
+        entries = other.entries;
+        distances = other.distances;
+        _size = other._size;
+        slot_count = other.slot_count;
+        _max_load = other._max_load;
+        hash = other.hash;
+        equal = other.equal;
+        other.entries = nullptr;
+        other.distances = nullptr;
+        other._size = 0;
+        other.slot_count = 0;
+    }
+    return *this;
+}
+
+template <class K, class V, class Hash, class Equal>
+size_t HashMap<K, V, Hash, Equal>::size() const {
+    return _size;
+}
+
+template <class K, class V, class Hash, class Equal>
+bool HashMap<K, V, Hash, Equal>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V, class Hash, class Equal>
+size_t HashMap<K, V, Hash, Equal>::bucket_count() const {
+    return slot_count;
+}
+
+template <class K, class V, class Hash, class Equal>
+double HashMap<K, V, Hash, Equal>::load_factor() const {
+    return slot_count == 0 ? 0 : static_cast<double>(_size) / slot_count;
+}
+
+template <class K, class V, class Hash, class Equal>
+double HashMap<K, V, Hash, Equal>::max_load_factor() const {
+    return _max_load;
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::max_load_factor(double factor) {
+    if (!(factor > 0 && factor < 1)) {
+        throw std::invalid_argument("Fator de carga invalido");
+    }
+    _max_load = factor;
+    reserve(_size);
+}
+
+template <class K, class V, class Hash, class Equal>
+size_t HashMap<K, V, Hash, Equal>::buckets_for(size_t capacity) const {
+    size_t count = 8;
+    while (count * _max_load < capacity) {
+        count *= 2;
+    }
+    return count;
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::reserve(size_t capacity) {
+    if (capacity == 0) {
+        return;
+    }
+    auto needed = buckets_for(capacity);
+    if (needed > slot_count) {
+        rehash(needed);
+    }
+}
+
+template <class K, class V, class Hash, class Equal>
+size_t HashMap<K, V, Hash, Equal>::home_of(size_t h) const {
+    // Mistura os bits do hash, como na HashIndex.
+    uint64_t x = h;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x) & (slot_count - 1);
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class Q>
+size_t HashMap<K, V, Hash, Equal>::position_of(const Q& key) const {
+    if (_size == 0) {
+        return slot_count;
+    }
+    auto mask = slot_count - 1;
+    auto position = home_of(hash(key));
+    // A busca termina no primeiro par mais perto de casa do que a chave
+    // estaria naquela posição (ou em uma posição livre).
+    for (uint8_t distance = 1; distances[position] >= distance;) {
+        if (distances[position] == distance &&
+            equal(entries[position].first(), key)) {
+            return position;
+        }
+        position = (position + 1) & mask;
+        distance += distance < max_distance;
+    }
+    return slot_count;
+}
+
+template <class K, class V, class Hash, class Equal>
+size_t HashMap<K, V, Hash, Equal>::distance_at(size_t position) const {
+    if (distances[position] < max_distance) {
+        return distances[position];
+    }
+    // Distância saturada: a real vem da posição ideal.
+    auto home = home_of(hash(entries[position].first()));
+    return ((position - home) & (slot_count - 1)) + 1;
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::place(Pair<K, V>&& entry) {
+    auto mask = slot_count - 1;
+    auto position = home_of(hash(entry.first()));
+    size_t distance = 1;
+    while (distances[position] != 0) {
+        auto other = distance_at(position);
+        if (other < distance) {
+            std::swap(entry, entries[position]);
+            distances[position] =
+                static_cast<uint8_t>(std::min<size_t>(distance, max_distance));
+            distance = other;
+        }
+        position = (position + 1) & mask;
+        distance++;
+    }
+    entries[position] = std::move(entry);
+    distances[position] =
+        static_cast<uint8_t>(std::min<size_t>(distance, max_distance));
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::rehash(size_t count) {
+    auto old_entries = entries;
+    auto old_distances = distances;
+    auto old_count = slot_count;
+    entries = new Pair<K, V>[count];
+    distances = new uint8_t[count]();
+    slot_count = count;
+    for (size_t i = 0; i < old_count; i++) {
+        if (old_distances[i] != 0) {
+            place(std::move(old_entries[i]));
+        }
+    }
+    delete[] old_entries;
+    delete[] old_distances;
+}
+
+template <class K, class V, class Hash, class Equal>
+V* HashMap<K, V, Hash, Equal>::find(const K& key) {
+    auto position = position_of(key);
+    return position == slot_count ? nullptr : &entries[position].second();
+}
+
+template <class K, class V, class Hash, class Equal>
+const V* HashMap<K, V, Hash, Equal>::find(const K& key) const {
+    auto position = position_of(key);
+    return position == slot_count ? nullptr : &entries[position].second();
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class Q, class H, class E, class>
+V* HashMap<K, V, Hash, Equal>::find(const Q& key) {
+    auto position = position_of(key);
+    return position == slot_count ? nullptr : &entries[position].second();
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class Q, class H, class E, class>
+const V* HashMap<K, V, Hash, Equal>::find(const Q& key) const {
+    auto position = position_of(key);
+    return position == slot_count ? nullptr : &entries[position].second();
+}
+
+template <class K, class V, class Hash, class Equal>
+bool HashMap<K, V, Hash, Equal>::contains(const K& key) const {
+    return position_of(key) != slot_count;
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class Q, class H, class E, class>
+bool HashMap<K, V, Hash, Equal>::contains(const Q& key) const {
+    return position_of(key) != slot_count;
+}
+
+template <class K, class V, class Hash, class Equal>
+bool HashMap<K, V, Hash, Equal>::insert(const K& key, const V& value) {
+    auto position = position_of(key);
+    if (position != slot_count) {
+        entries[position].second() = value;
+        return false;
+    }
+    // A chave e o valor podem estar na própria tabela, que `reserve` pode
+    // liberar: o par é copiado antes.
+    Pair<K, V> entry(key, value);
+    reserve(_size + 1);
+    place(std::move(entry));
+    _size++;
+    return true;
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::erase_at(size_t position) {
+    // Desloca para trás os pares seguintes que não estão em casa; o primeiro
+    // livre ou em casa encerra a sequência.
+    auto mask = slot_count - 1;
+    auto next = (position + 1) & mask;
+    while (distances[next] > 1) {
+        auto distance = std::min<size_t>(distance_at(next) - 1, max_distance);
+        entries[position] = std::move(entries[next]);
+        distances[position] = static_cast<uint8_t>(distance);
+        position = next;
+        next = (next + 1) & mask;
+    }
+    entries[position] = Pair<K, V>();
+    distances[position] = 0;
+    _size--;
+}
+
+template <class K, class V, class Hash, class Equal>
+bool HashMap<K, V, Hash, Equal>::erase(const K& key) {
+    auto position = position_of(key);
+    if (position == slot_count) {
+        return false;
+    }
+    erase_at(position);
+    return true;
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class Q, class H, class E, class>
+bool HashMap<K, V, Hash, Equal>::erase(const Q& key) {
+    auto position = position_of(key);
+    if (position == slot_count) {
+        return false;
+    }
+    erase_at(position);
+    return true;
+}
+
+template <class K, class V, class Hash, class Equal>
+template <class F>
+void HashMap<K, V, Hash, Equal>::for_each(F visit) const {
+    for (size_t i = 0; i < slot_count; i++) {
+        if (distances[i] != 0) {
+            visit(entries[i].first(), entries[i].second());
+        }
+    }
+}
+
+template <class K, class V, class Hash, class Equal>
+void HashMap<K, V, Hash, Equal>::clear() {
+    for (size_t i = 0; i < slot_count; i++) {
+        if (distances[i] != 0) {
+            entries[i] = Pair<K, V>();
+            distances[i] = 0;
+        }
+    }
+    _size = 0;
+}
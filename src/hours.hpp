@@ -0,0 +1,151 @@
+#include <limits.h>
+
+#include "../include/hours.hpp"
+
+constexpr Hours::Hours() : total{0} {}
+
+constexpr Hours::Hours(int h, int m, int s) : total{h * 3600 + m * 60 + s} {}
+
+constexpr Hours Hours::from_seconds(int seconds) {
+    Hours time;
+    time.total = seconds;
+    return time;
+}
+
+constexpr void Hours::set_time(int h, int m, int s) {
+    total = h * 3600 + m * 60 + s;
+}
+
+constexpr int Hours::get_hours() const {
+    return total / 3600;
+}
+
+constexpr int Hours::get_minutes() const {
+    return total / 60 % 60;
+}
+
+constexpr int Hours::get_seconds() const {
+    return total % 60;
+}
+
+constexpr int Hours::to_seconds() const {
+    return total;
+}
+
+constexpr double Hours::to_minutes() const {
+    return total / 60.0;
+}
+
+constexpr double Hours::to_hours() const {
+    return total / 3600.0;
+}
+
+constexpr std::to_chars_result Hours::to_chars(char* first,
+                                               char* last) const {
+    // A magnitude é calculada em long long para que INT_MIN não transborde.
+    long long magnitude = total < 0 ? -static_cast<long long>(total) : total;
+    auto h = magnitude / 3600;
+    int m = magnitude / 60 % 60;
+    int s = magnitude % 60;
+
+    int digits = 2;
+    for (long long limit = 100; limit <= h; limit *= 10) {
+        digits++;
+    }
+    long long length = (total < 0 ? 1 : 0) + digits + 6;
+    if (last - first < length) {
+        return {last, std::errc::value_too_large};
+    }
+
+    auto pos = first;
+    if (total < 0) {
+        *pos++ = '-';
+    }
+    for (int i = digits - 1; i >= 0; i--) {
+        pos[i] = static_cast<char>('0' + h % 10);
+        h /= 10;
+    }
+    pos += digits;
+    *pos++ = ':';
+    *pos++ = static_cast<char>('0' + m / 10);
+    *pos++ = static_cast<char>('0' + m % 10);
+    *pos++ = ':';
+    *pos++ = static_cast<char>('0' + s / 10);
+    *pos++ = static_cast<char>('0' + s % 10);
+    return {pos, std::errc()};
+}
+
+constexpr std::from_chars_result Hours::from_chars(const char* first,
+                                                   const char* last,
+                                                   Hours& value) {
+    auto pos = first;
+    bool negative = pos != last && *pos == '-';
+    if (negative) {
+        pos++;
+    }
+
+    auto digits_start = pos;
+    long long h = 0;
+    bool too_large = false;
+    while (pos != last && *pos >= '0' && *pos <= '9') {
+        if (h <= INT_MAX) {
+            h = h * 10 + (*pos - '0');
+        } else {
+            too_large = true;
+        }
+        pos++;
+    }
+    if (pos == digits_start) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // Minutos e segundos: ":" seguido de dois dígitos, de 00 a 59.
+    int fields[2] = {0, 0};
+    for (auto& field : fields) {
+        if (last - pos < 3 || pos[0] != ':' || pos[1] < '0' || pos[1] > '5' ||
+            pos[2] < '0' || pos[2] > '9') {
+            return {first, std::errc::invalid_argument};
+        }
+        field = (pos[1] - '0') * 10 + (pos[2] - '0');
+        pos += 3;
+    }
+
+    long long seconds = h * 3600 + fields[0] * 60 + fields[1];
+    if (too_large || seconds > INT_MAX) {
+        return {pos, std::errc::result_out_of_range};
+    }
+    value = from_seconds(static_cast<int>(negative ? -seconds : seconds));
+    return {pos, std::errc()};
+}
+
+constexpr bool Hours::operator==(const Hours& other) const {
+    return total == other.total;
+}
+
+constexpr bool Hours::operator!=(const Hours& other) const {
+    return total != other.total;
+}
+
+constexpr bool Hours::operator>(const Hours& other) const {
+    return total > other.total;
+}
+
+constexpr bool Hours::operator<(const Hours& other) const {
+    return total < other.total;
+}
+
+constexpr bool Hours::operator>=(const Hours& other) const {
+    return total >= other.total;
+}
+
+constexpr bool Hours::operator<=(const Hours& other) const {
+    return total <= other.total;
+}
+
+constexpr Hours Hours::operator+(const Hours& other) const {
+    return from_seconds(total + other.total);
+}
+
+constexpr Hours Hours::operator-(const Hours& other) const {
+    return from_seconds(total - other.total);
+}
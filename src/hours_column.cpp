@@ -0,0 +1,547 @@
+#include "../include/hours_column.hpp"
+
+#include <limits.h>
+#include <string.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define HOURS_COLUMN_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Garante que um arranjo comporte `needed` elementos, dobrando a
+ * capacidade quando necessário.
+ */
+template <class U>
+void grow(U*& data, size_t size, size_t& capacity, size_t needed) {
+    if (needed <= capacity) {
+        return;
+    }
+    auto new_capacity = capacity == 0 ? needed : capacity;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    auto new_data = new U[new_capacity];
+    if (size > 0) {
+        memcpy(new_data, data, size * sizeof(U));
+    }
+    delete[] data;
+    data = new_data;
+    capacity = new_capacity;
+}
+
+/**
+ * @brief Copia um arranjo, alocando exatamente o necessário.
+ */
+template <class U>
+U* duplicate(const U* data, size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+    auto copy = new U[size];
+    memcpy(copy, data, size * sizeof(U));
+    return copy;
+}
+
+void summarize_scalar(const int* values, size_t n, int& min, int& max,
+                      long long& sum) {
+    for (size_t i = 0; i < n; i++) {
+        min = values[i] < min ? values[i] : min;
+        max = values[i] > max ? values[i] : max;
+        sum += values[i];
+    }
+}
+
+void scan_wide_scalar(const int* values, size_t n, int lo, int hi,
+                      size_t& count, long long& sum) {
+    for (size_t i = 0; i < n; i++) {
+        if (values[i] >= lo && values[i] <= hi) {
+            count++;
+            sum += values[i];
+        }
+    }
+}
+
+void scan_narrow_scalar(const uint16_t* values, size_t n, uint16_t lo,
+                        uint16_t hi, size_t& count, long long& sum) {
+    for (size_t i = 0; i < n; i++) {
+        if (values[i] >= lo && values[i] <= hi) {
+            count++;
+            sum += values[i];
+        }
+    }
+}
+
+#ifdef HOURS_COLUMN_AVX2
+bool has_avx2() {
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+}
+
+/// Soma os quatro inteiros de 64 bits de um registro.
+__attribute__((target("avx2"))) long long reduce_add_epi64(__m256i v) {
+    auto half = _mm_add_epi64(_mm256_castsi256_si128(v),
+                              _mm256_extracti128_si256(v, 1));
+    return _mm_cvtsi128_si64(half) + _mm_extract_epi64(half, 1);
+}
+
+/// Soma os oito inteiros de 32 bits de um registro, em 64 bits.
+__attribute__((target("avx2"))) long long reduce_add_epi32(__m256i v) {
+    auto low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+    auto high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+    return reduce_add_epi64(_mm256_add_epi64(low, high));
+}
+
+__attribute__((target("avx2"))) void summarize_avx2(const int* values,
+                                                    size_t n, int& min,
+                                                    int& max,
+                                                    long long& sum) {
+    auto vmin = _mm256_set1_epi32(min);
+    auto vmax = _mm256_set1_epi32(max);
+    auto vsum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        vmin = _mm256_min_epi32(vmin, v);
+        vmax = _mm256_max_epi32(vmax, v);
+        vsum = _mm256_add_epi64(vsum,
+                                _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        vsum = _mm256_add_epi64(
+            vsum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    int mins[8];
+    int maxs[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(mins), vmin);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(maxs), vmax);
+    for (int k = 0; k < 8; k++) {
+        min = mins[k] < min ? mins[k] : min;
+        max = maxs[k] > max ? maxs[k] : max;
+    }
+    sum += reduce_add_epi64(vsum);
+    summarize_scalar(values + i, n - i, min, max, sum);
+}
+
+__attribute__((target("avx2"))) void scan_wide_avx2(const int* values,
+                                                    size_t n, int lo, int hi,
+                                                    size_t& count,
+                                                    long long& sum) {
+    auto vlo = _mm256_set1_epi32(lo);
+    auto vhi = _mm256_set1_epi32(hi);
+    auto ones = _mm256_set1_epi32(-1);
+    auto vcount = _mm256_setzero_si256();
+    auto vsum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        auto outside = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, v),
+                                       _mm256_cmpgt_epi32(v, vhi));
+        auto inside = _mm256_andnot_si256(outside, ones);
+        vcount = _mm256_sub_epi32(vcount, inside);
+        auto selected = _mm256_and_si256(v, inside);
+        vsum = _mm256_add_epi64(
+            vsum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(selected)));
+        vsum = _mm256_add_epi64(
+            vsum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(selected, 1)));
+    }
+    count += reduce_add_epi32(vcount);
+    sum += reduce_add_epi64(vsum);
+    scan_wide_scalar(values + i, n - i, lo, hi, count, sum);
+}
+
+__attribute__((target("avx2"))) void scan_narrow_avx2(const uint16_t* values,
+                                                      size_t n, uint16_t lo,
+                                                      uint16_t hi,
+                                                      size_t& count,
+                                                      long long& sum) {
+    // Os contadores de 16 bits e as somas de 32 bits não transbordam para
+    // um bloco (n <= block_size).
+    auto vlo = _mm256_set1_epi16(static_cast<short>(lo));
+    auto vhi = _mm256_set1_epi16(static_cast<short>(hi));
+    auto zero = _mm256_setzero_si256();
+    auto vcount = _mm256_setzero_si256();
+    auto vsum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        auto v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        auto inside = _mm256_and_si256(
+            _mm256_cmpeq_epi16(_mm256_max_epu16(v, vlo), v),
+            _mm256_cmpeq_epi16(_mm256_min_epu16(v, vhi), v));
+        vcount = _mm256_sub_epi16(vcount, inside);
+        auto selected = _mm256_and_si256(v, inside);
+        vsum = _mm256_add_epi32(vsum, _mm256_unpacklo_epi16(selected, zero));
+        vsum = _mm256_add_epi32(vsum, _mm256_unpackhi_epi16(selected, zero));
+    }
+    count += reduce_add_epi32(_mm256_madd_epi16(vcount, _mm256_set1_epi16(1)));
+    sum += reduce_add_epi32(vsum);
+    scan_narrow_scalar(values + i, n - i, lo, hi, count, sum);
+}
+#endif
+
+/// Calcula mínimo, máximo e soma de um arranjo, acumulando nos parâmetros.
+void summarize(const int* values, size_t n, int& min, int& max,
+               long long& sum) {
+#ifdef HOURS_COLUMN_AVX2
+    if (has_avx2()) {
+        return summarize_avx2(values, n, min, max, sum);
+    }
+#endif
+    summarize_scalar(values, n, min, max, sum);
+}
+
+/// Conta e soma os valores em `[lo, hi]` de um arranjo de 32 bits.
+void scan_wide(const int* values, size_t n, int lo, int hi, size_t& count,
+               long long& sum) {
+#ifdef HOURS_COLUMN_AVX2
+    if (has_avx2()) {
+        return scan_wide_avx2(values, n, lo, hi, count, sum);
+    }
+#endif
+    scan_wide_scalar(values, n, lo, hi, count, sum);
+}
+
+/// Conta e soma os valores em `[lo, hi]` de um arranjo de 16 bits.
+void scan_narrow(const uint16_t* values, size_t n, uint16_t lo, uint16_t hi,
+                 size_t& count, long long& sum) {
+#ifdef HOURS_COLUMN_AVX2
+    if (has_avx2()) {
+        return scan_narrow_avx2(values, n, lo, hi, count, sum);
+    }
+#endif
+    scan_narrow_scalar(values, n, lo, hi, count, sum);
+}
+
+}  // namespace
+
+HoursColumn::HoursColumn()
+    : blocks{nullptr}, block_count(0), block_capacity(0), narrow{nullptr},
+      narrow_size(0), narrow_capacity(0), wide{nullptr}, wide_size(0),
+      wide_capacity(0), open{new int[block_size]}, open_size(0),
+      _threads(1) {}
+
+HoursColumn::HoursColumn(const VectorList<Hours>& list) : HoursColumn() {
+    for (size_t i = 0; i < list.size(); i++) {
+        push_back(list[i]);
+    }
+}
+
+HoursColumn::HoursColumn(const int* seconds, size_t count) : HoursColumn() {
+    for (size_t i = 0; i < count; i++) {
+        push_back_seconds(seconds[i]);
+    }
+}
+
+HoursColumn::~HoursColumn() {
+    delete[] blocks;
+    delete[] narrow;
+    delete[] wide;
+    delete[] open;
+}
+
+HoursColumn::HoursColumn(const HoursColumn& other) : HoursColumn() {
+    *this = other;
+}
+
+HoursColumn& HoursColumn::operator=(const HoursColumn& other) {
+    if (this == &other) {
+        return *this;
+    }
+    delete[] blocks;
+    delete[] narrow;
+    delete[] wide;
+    blocks = duplicate(other.blocks, other.block_count);
+    block_count = block_capacity = other.block_count;
+    narrow = duplicate(other.narrow, other.narrow_size);
+    narrow_size = narrow_capacity = other.narrow_size;
+    wide = duplicate(other.wide, other.wide_size);
+    wide_size = wide_capacity = other.wide_size;
+    memcpy(open, other.open, other.open_size * sizeof(int));
+    open_size = other.open_size;
+    _threads = other._threads;
+    return *this;
+}
+
+size_t HoursColumn::size() const {
+    return block_count * block_size + open_size;
+}
+
+bool HoursColumn::empty() const {
+    return size() == 0;
+}
+
+size_t HoursColumn::memory_usage() const {
+    return block_count * sizeof(Block) + narrow_size * sizeof(uint16_t) +
+           wide_size * sizeof(int) + block_size * sizeof(int);
+}
+
+void HoursColumn::set_threads(unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    _threads = threads == 0 ? 1 : threads;
+}
+
+unsigned HoursColumn::threads() const {
+    return _threads;
+}
+
+void HoursColumn::push_back(const Hours& time) {
+    push_back_seconds(time.to_seconds());
+}
+
+void HoursColumn::push_back_seconds(int seconds) {
+    open[open_size++] = seconds;
+    if (open_size == block_size) {
+        seal();
+    }
+}
+
+void HoursColumn::seal() {
+    Block block{INT_MAX, INT_MIN, 0, 0, false};
+    summarize(open, open_size, block.min, block.max, block.sum);
+
+    block.is_narrow =
+        static_cast<long long>(block.max) - block.min <= UINT16_MAX;
+    if (block.is_narrow) {
+        grow(narrow, narrow_size, narrow_capacity, narrow_size + block_size);
+        block.offset = narrow_size;
+        for (size_t i = 0; i < block_size; i++) {
+            narrow[narrow_size + i] =
+                static_cast<uint16_t>(open[i] - block.min);
+        }
+        narrow_size += block_size;
+    } else {
+        grow(wide, wide_size, wide_capacity, wide_size + block_size);
+        block.offset = wide_size;
+        memcpy(wide + wide_size, open, block_size * sizeof(int));
+        wide_size += block_size;
+    }
+
+    grow(blocks, block_count, block_capacity, block_count + 1);
+    blocks[block_count++] = block;
+    open_size = 0;
+}
+
+Hours HoursColumn::operator[](size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    auto block_index = index / block_size;
+    auto pos = index % block_size;
+    if (block_index == block_count) {
+        return Hours::from_seconds(open[pos]);
+    }
+    const auto& block = blocks[block_index];
+    return Hours::from_seconds(block.is_narrow
+                                   ? block.min + narrow[block.offset + pos]
+                                   : wide[block.offset + pos]);
+}
+
+void HoursColumn::clear() {
+    block_count = 0;
+    narrow_size = 0;
+    wide_size = 0;
+    open_size = 0;
+}
+
+long long HoursColumn::sum() const {
+    long long total = 0;
+    for (size_t i = 0; i < block_count; i++) {
+        total += blocks[i].sum;
+    }
+    int min = INT_MAX;
+    int max = INT_MIN;
+    summarize(open, open_size, min, max, total);
+    return total;
+}
+
+Hours HoursColumn::min() const {
+    if (empty()) {
+        throw std::out_of_range("A coluna esta vazia");
+    }
+    int min = INT_MAX;
+    for (size_t i = 0; i < block_count; i++) {
+        min = blocks[i].min < min ? blocks[i].min : min;
+    }
+    int max = INT_MIN;
+    long long sum = 0;
+    summarize(open, open_size, min, max, sum);
+    return Hours::from_seconds(min);
+}
+
+Hours HoursColumn::max() const {
+    if (empty()) {
+        throw std::out_of_range("A coluna esta vazia");
+    }
+    int max = INT_MIN;
+    for (size_t i = 0; i < block_count; i++) {
+        max = blocks[i].max > max ? blocks[i].max : max;
+    }
+    int min = INT_MAX;
+    long long sum = 0;
+    summarize(open, open_size, min, max, sum);
+    return Hours::from_seconds(max);
+}
+
+template <class F>
+unsigned HoursColumn::parallel_blocks(F f) const {
+    size_t total = block_count + (open_size > 0 ? 1 : 0);
+    unsigned parts = _threads;
+    if (parts > total) {
+        parts = total == 0 ? 1 : static_cast<unsigned>(total);
+    }
+    if (parts == 1) {
+        f(0, total, 0);
+        return 1;
+    }
+
+    std::vector<std::thread> workers;
+    for (unsigned part = 1; part < parts; part++) {
+        workers.emplace_back(f, total * part / parts,
+                             total * (part + 1) / parts, part);
+    }
+    f(0, total / parts, 0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return parts;
+}
+
+void HoursColumn::scan_block(size_t block_index, int lo, int hi,
+                             size_t& count, long long& sum) const {
+    if (block_index == block_count) {
+        return scan_wide(open, open_size, lo, hi, count, sum);
+    }
+    const auto& block = blocks[block_index];
+    if (block.max < lo || block.min > hi) {
+        return;
+    }
+    if (block.min >= lo && block.max <= hi) {
+        count += block_size;
+        sum += block.sum;
+        return;
+    }
+    if (!block.is_narrow) {
+        return scan_wide(wide + block.offset, block_size, lo, hi, count, sum);
+    }
+
+    // Os limites são traduzidos para a base do bloco e limitados a 16 bits.
+    auto narrow_lo = lo > block.min ? static_cast<long long>(lo) - block.min
+                                    : 0;
+    auto narrow_hi = static_cast<long long>(hi) - block.min;
+    if (narrow_hi > UINT16_MAX) {
+        narrow_hi = UINT16_MAX;
+    }
+    size_t block_matches = 0;
+    long long offsets = 0;
+    scan_narrow(narrow + block.offset, block_size,
+                static_cast<uint16_t>(narrow_lo),
+                static_cast<uint16_t>(narrow_hi), block_matches, offsets);
+    count += block_matches;
+    sum += offsets + static_cast<long long>(block_matches) * block.min;
+}
+
+size_t HoursColumn::count_between(const Hours& lo, const Hours& hi) const {
+    std::vector<size_t> counts(_threads, 0);
+    std::vector<long long> sums(_threads, 0);
+    auto parts = parallel_blocks([&](size_t first, size_t last, unsigned part) {
+        for (size_t i = first; i < last; i++) {
+            scan_block(i, lo.to_seconds(), hi.to_seconds(), counts[part],
+                       sums[part]);
+        }
+    });
+    size_t total = 0;
+    for (unsigned part = 0; part < parts; part++) {
+        total += counts[part];
+    }
+    return total;
+}
+
+long long HoursColumn::sum_between(const Hours& lo, const Hours& hi) const {
+    std::vector<size_t> counts(_threads, 0);
+    std::vector<long long> sums(_threads, 0);
+    auto parts = parallel_blocks([&](size_t first, size_t last, unsigned part) {
+        for (size_t i = first; i < last; i++) {
+            scan_block(i, lo.to_seconds(), hi.to_seconds(), counts[part],
+                       sums[part]);
+        }
+    });
+    long long total = 0;
+    for (unsigned part = 0; part < parts; part++) {
+        total += sums[part];
+    }
+    return total;
+}
+
+void HoursColumn::histogram_block(size_t block_index, int width,
+                                  size_t* counts, size_t buckets) const {
+    auto limit =
+        static_cast<long long>(width) * static_cast<long long>(buckets);
+    auto add = [&](int value) {
+        if (value >= 0 && value < limit) {
+            counts[value / width]++;
+        }
+    };
+
+    if (block_index == block_count) {
+        for (size_t i = 0; i < open_size; i++) {
+            add(open[i]);
+        }
+        return;
+    }
+
+    const auto& block = blocks[block_index];
+    if (block.max < 0 || block.min >= limit) {
+        return;
+    }
+    // Um bloco inteiro dentro de uma só faixa é contado pelos metadados.
+    if (block.min >= 0 && block.max < limit &&
+        block.min / width == block.max / width) {
+        counts[block.min / width] += block_size;
+        return;
+    }
+    if (block.is_narrow) {
+        auto values = narrow + block.offset;
+        for (size_t i = 0; i < block_size; i++) {
+            add(block.min + values[i]);
+        }
+    } else {
+        auto values = wide + block.offset;
+        for (size_t i = 0; i < block_size; i++) {
+            add(values[i]);
+        }
+    }
+}
+
+void HoursColumn::histogram(int width, size_t* counts, size_t buckets) const {
+    if (width <= 0) {
+        throw std::invalid_argument("A largura deve ser positiva");
+    }
+    for (size_t i = 0; i < buckets; i++) {
+        counts[i] = 0;
+    }
+
+    // Cada parte conta em um histograma próprio, somado no final.
+    std::vector<std::vector<size_t>> partial(
+        _threads > 1 ? _threads : 0, std::vector<size_t>(buckets, 0));
+    auto parts = parallel_blocks([&](size_t first, size_t last, unsigned part) {
+        auto target = _threads > 1 ? partial[part].data() : counts;
+        for (size_t i = first; i < last; i++) {
+            histogram_block(i, width, target, buckets);
+        }
+    });
+    if (_threads > 1) {
+        for (unsigned part = 0; part < parts; part++) {
+            for (size_t i = 0; i < buckets; i++) {
+                counts[i] += partial[part][i];
+            }
+        }
+    }
+}
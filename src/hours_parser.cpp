@@ -0,0 +1,183 @@
+#include "../include/hours_parser.hpp"
+
+#include <string.h>
+
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define HOURS_PARSER_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// Bytes ocupados por uma linha no formato fixo "HH:MM:SS\n".
+constexpr size_t record_bytes = 9;
+
+/// Linhas convertidas por iteração do caminho vetorizado.
+constexpr size_t batch_size = 8;
+
+#ifdef HOURS_PARSER_AVX2
+/**
+ * @brief Valida e converte 8 linhas consecutivas no formato fixo.
+ *
+ * Cada tempo ocupa exatamente 8 bytes, então cabe em uma palavra de 64 bits;
+ * duas leituras espalhadas (gather) trazem 4 tempos cada. Depois de
+ * subtrair '0' de todos os bytes, os dígitos devem estar entre 0 e o seu
+ * limite (5 para as dezenas de minutos e segundos) e os separadores devem
+ * valer exatamente ':' - '0'. A conversão multiplica os pares de bytes por
+ * pesos com `maddubs` e `madd`, e a soma das duas metades de cada palavra é
+ * o total de segundos.
+ *
+ * @param text Início da primeira linha (72 bytes devem estar disponíveis).
+ * @param seconds Recebe os 8 totais de segundos.
+ * @return Falso se alguma linha não estiver no formato fixo; nesse caso
+ * nada é gravado.
+ */
+__attribute__((target("avx2"))) bool parse_batch_avx2(const char* text,
+                                                      int* seconds) {
+    for (size_t i = 0; i < batch_size; i++) {
+        if (text[i * record_bytes + 8] != '\n') {
+            return false;
+        }
+    }
+
+    const __m256i offsets = _mm256_setr_epi64x(0, 9, 18, 27);
+    const __m256i zeros = _mm256_set1_epi8('0');
+    const __m256i upper = _mm256_setr_epi8(
+        9, 9, 10, 5, 9, 10, 5, 9, 9, 9, 10, 5, 9, 10, 5, 9,
+        9, 9, 10, 5, 9, 10, 5, 9, 9, 9, 10, 5, 9, 10, 5, 9);
+    const __m256i lower = _mm256_setr_epi8(
+        0, 0, 10, 0, 0, 10, 0, 0, 0, 0, 10, 0, 0, 10, 0, 0,
+        0, 0, 10, 0, 0, 10, 0, 0, 0, 0, 10, 0, 0, 10, 0, 0);
+    const __m256i digit_weights = _mm256_setr_epi8(
+        10, 1, 0, 10, 1, 0, 10, 1, 10, 1, 0, 10, 1, 0, 10, 1,
+        10, 1, 0, 10, 1, 0, 10, 1, 10, 1, 0, 10, 1, 0, 10, 1);
+    const __m256i field_weights = _mm256_setr_epi16(
+        3600, 60, 60, 1, 3600, 60, 60, 1, 3600, 60, 60, 1, 3600, 60, 60, 1);
+    const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    __m128i results[2];
+    for (int half = 0; half < 2; half++) {
+        auto base = reinterpret_cast<const long long*>(
+            text + half * 4 * record_bytes);
+        auto bytes = _mm256_sub_epi8(_mm256_i64gather_epi64(base, offsets, 1),
+                                     zeros);
+
+        auto below = _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, upper), upper);
+        auto above = _mm256_cmpeq_epi8(_mm256_min_epu8(bytes, lower), lower);
+        if (_mm256_movemask_epi8(_mm256_and_si256(below, above)) != -1) {
+            return false;
+        }
+
+        // [H, 10 * dezena dos minutos, unidade dos minutos, S] em 16 bits,
+        // depois [3600 * H + 600 * dezena, 60 * unidade + S] em 32 bits.
+        auto fields = _mm256_maddubs_epi16(bytes, digit_weights);
+        auto parts = _mm256_madd_epi16(fields, field_weights);
+        auto sums = _mm256_add_epi32(parts, _mm256_srli_epi64(parts, 32));
+        results[half] = _mm256_castsi256_si128(
+            _mm256_permutevar8x32_epi32(sums, pack));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(seconds), results[0]);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(seconds + 4), results[1]);
+    return true;
+}
+#endif
+
+/**
+ * @brief Percorre o texto linha a linha, entregando os tempos válidos a
+ * `sink` em blocos.
+ *
+ * @param sink Função chamada com um arranjo de segundos e o seu tamanho.
+ */
+template <class Sink>
+HoursParseResult parse_lines(const char* first, const char* last, Sink sink,
+                             const MalformedLineCallback& on_malformed,
+                             bool use_simd) {
+    HoursParseResult result{0, 0, 0};
+    int batch[batch_size];
+    auto pos = first;
+
+#ifdef HOURS_PARSER_AVX2
+    use_simd = use_simd && hours_parser_has_simd();
+#else
+    use_simd = false;
+#endif
+
+    while (pos < last) {
+#ifdef HOURS_PARSER_AVX2
+        if (use_simd) {
+            if (static_cast<size_t>(last - pos) >= batch_size * record_bytes &&
+                parse_batch_avx2(pos, batch)) {
+                sink(batch, batch_size);
+                result.lines += batch_size;
+                result.parsed += batch_size;
+                pos += batch_size * record_bytes;
+                continue;
+            }
+        }
+#endif
+        auto newline =
+            static_cast<const char*>(memchr(pos, '\n', last - pos));
+        auto end = newline != nullptr ? newline : last;
+        auto line_end = end;
+        if (line_end > pos && line_end[-1] == '\r') {
+            line_end--;
+        }
+
+        result.lines++;
+        Hours time;
+        auto parsed = Hours::from_chars(pos, line_end, time);
+        if (parsed.ec == std::errc() && parsed.ptr == line_end) {
+            auto seconds = time.to_seconds();
+            sink(&seconds, 1);
+            result.parsed++;
+        } else {
+            result.malformed++;
+            if (on_malformed) {
+                on_malformed(result.lines, pos, line_end);
+            }
+        }
+        pos = newline != nullptr ? newline + 1 : last;
+    }
+    return result;
+}
+
+}  // namespace
+
+bool hours_parser_has_simd() {
+#ifdef HOURS_PARSER_AVX2
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+#else
+    return false;
+#endif
+}
+
+HoursParseResult parse_hours(const char* first, const char* last,
+                             int* seconds, size_t capacity,
+                             const MalformedLineCallback& on_malformed,
+                             bool use_simd) {
+    size_t written = 0;
+    auto sink = [&](const int* values, size_t count) {
+        if (count > capacity - written) {
+            throw std::length_error("O arranjo esta cheio");
+        }
+        memcpy(seconds + written, values, count * sizeof(int));
+        written += count;
+    };
+    return parse_lines(first, last, sink, on_malformed, use_simd);
+}
+
+HoursParseResult parse_hours(const char* first, const char* last,
+                             VectorList<Hours>& list,
+                             const MalformedLineCallback& on_malformed,
+                             bool use_simd) {
+    auto sink = [&](const int* values, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            list.push_back(Hours::from_seconds(values[i]));
+        }
+    };
+    return parse_lines(first, last, sink, on_malformed, use_simd);
+}
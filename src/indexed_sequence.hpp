@@ -0,0 +1,448 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/indexed_sequence.hpp"
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>::Node::Node(uint32_t priority)
+    : left{nullptr}, right{nullptr}, priority{priority}, count{0}, total{0} {}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>::IndexedSequence()
+    : root{nullptr}, seed{2463534242u} {}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>::~IndexedSequence() {
+    destroy(root);
+}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>::IndexedSequence(const IndexedSequence& other)
+    : root{clone(other.root)}, seed{other.seed} {}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>::IndexedSequence(IndexedSequence&& other)
+    : root{other.root}, seed{other.seed} {
+    other.root = nullptr;
+}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>& IndexedSequence<T, Chunk>::operator=(
+    const IndexedSequence& other) {
+    if (this != &other) {
+        destroy(root);
+        root = clone(other.root);
+        seed = other.seed;
+    }
+    return *this;
+}
+
+template <class T, size_t Chunk>
+IndexedSequence<T, Chunk>& IndexedSequence<T, Chunk>::operator=(
+    IndexedSequence&& other) {
+    if (this != &other) {
+        destroy(root);
+        root = other.root;
+        seed = other.seed;
+        other.root = nullptr;
+    }
+    return *this;
+}
+
+template <class T, size_t Chunk>
+size_t IndexedSequence<T, Chunk>::size() const {
+    return total_of(root);
+}
+
+template <class T, size_t Chunk>
+bool IndexedSequence<T, Chunk>::empty() const {
+    return size() == 0;
+}
+
+template <class T, size_t Chunk>
+size_t IndexedSequence<T, Chunk>::total_of(const Node* node) {
+    return node == nullptr ? 0 : node->total;
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::update(Node* node) {
+    node->total = total_of(node->left) + node->count + total_of(node->right);
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::rotate_right(Node* node) -> Node* {
+    auto left = node->left;
+    node->left = left->right;
+    left->right = node;
+    update(node);
+    update(left);
+    return left;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::rotate_left(Node* node) -> Node* {
+    auto right = node->right;
+    node->right = right->left;
+    right->left = node;
+    update(node);
+    update(right);
+    return right;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::merge(Node* left, Node* right) -> Node* {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    if (left->priority > right->priority) {
+        left->right = merge(left->right, right);
+        update(left);
+        return left;
+    }
+    right->left = merge(left, right->left);
+    update(right);
+    return right;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::clone(const Node* node) -> Node* {
+    if (node == nullptr) {
+        return nullptr;
+    }
+    auto copy = new Node(node->priority);
+    for (size_t i = 0; i < node->count; i++) {
+        copy->values[i] = node->values[i];
+    }
+    copy->count = node->count;
+    copy->total = node->total;
+    copy->left = clone(node->left);
+    copy->right = clone(node->right);
+    return copy;
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::destroy(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    destroy(node->left);
+    destroy(node->right);
+    delete node;
+}
+
+template <class T, size_t Chunk>
+uint32_t IndexedSequence<T, Chunk>::next_priority() {
+    // xorshift32: rápido e suficiente para balancear a treap.
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::insert_first(Node* node, Node* first)
+    -> Node* {
+    if (node == nullptr) {
+        update(first);
+        return first;
+    }
+    node->left = insert_first(node->left, first);
+    if (node->left->priority > node->priority) {
+        return rotate_right(node);
+    }
+    update(node);
+    return node;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::insert_into(Node* node, size_t index,
+                                            const T& value) -> Node* {
+    if (node == nullptr) {
+        auto created = new Node(next_priority());
+        created->values[0] = value;
+        created->count = 1;
+        created->total = 1;
+        return created;
+    }
+
+    auto left_total = total_of(node->left);
+    if (index < left_total) {
+        node->left = insert_into(node->left, index, value);
+        if (node->left->priority > node->priority) {
+            return rotate_right(node);
+        }
+        update(node);
+        return node;
+    }
+
+    if (index > left_total + node->count) {
+        node->right =
+            insert_into(node->right, index - left_total - node->count, value);
+        if (node->right->priority > node->priority) {
+            return rotate_left(node);
+        }
+        update(node);
+        return node;
+    }
+
+    // A posição cai neste bloco. Um bloco cheio é dividido ao meio, e a
+    // metade superior vira o primeiro nó da subárvore direita.
+    auto block = node;
+    auto offset = index - left_total;
+    Node* upper = nullptr;
+    if (node->count == Chunk) {
+        upper = new Node(next_priority());
+        auto half = Chunk / 2;
+        for (size_t i = half; i < Chunk; i++) {
+            upper->values[i - half] = node->values[i];
+        }
+        upper->count = Chunk - half;
+        node->count = half;
+        if (offset > half) {
+            block = upper;
+            offset -= half;
+        }
+    }
+
+    for (size_t i = block->count; i > offset; i--) {
+        block->values[i] = block->values[i - 1];
+    }
+    block->values[offset] = value;
+    block->count++;
+
+    if (upper != nullptr) {
+        node->right = insert_first(node->right, upper);
+        if (node->right->priority > node->priority) {
+            return rotate_left(node);
+        }
+    }
+    update(node);
+    return node;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::remove_from(Node* node, size_t index)
+    -> Node* {
+    auto left_total = total_of(node->left);
+    if (index < left_total) {
+        node->left = remove_from(node->left, index);
+    } else if (index >= left_total + node->count) {
+        node->right =
+            remove_from(node->right, index - left_total - node->count);
+    } else {
+        for (size_t i = index - left_total; i + 1 < node->count; i++) {
+            node->values[i] = node->values[i + 1];
+        }
+        node->count--;
+        if (node->count == 0) {
+            auto rest = merge(node->left, node->right);
+            delete node;
+            return rest;
+        }
+    }
+    update(node);
+    return node;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::split_at(Node* node, size_t index)
+    -> std::pair<Node*, Node*> {
+    if (node == nullptr) {
+        return {nullptr, nullptr};
+    }
+
+    auto left_total = total_of(node->left);
+    if (index <= left_total) {
+        auto parts = split_at(node->left, index);
+        node->left = parts.second;
+        update(node);
+        return {parts.first, node};
+    }
+    if (index >= left_total + node->count) {
+        auto parts = split_at(node->right, index - left_total - node->count);
+        node->right = parts.first;
+        update(node);
+        return {node, parts.second};
+    }
+
+    // O corte cai no meio do bloco: a parte final vai para um novo nó, que
+    // herda a subárvore direita e a prioridade deste.
+    auto offset = index - left_total;
+    auto tail = new Node(node->priority);
+    for (size_t i = offset; i < node->count; i++) {
+        tail->values[i - offset] = node->values[i];
+    }
+    tail->count = node->count - offset;
+    node->count = offset;
+    tail->right = node->right;
+    node->right = nullptr;
+    update(tail);
+    update(node);
+    return {node, tail};
+}
+
+template <class T, size_t Chunk>
+T* IndexedSequence<T, Chunk>::element_at(size_t index) const {
+    auto node = root;
+    while (true) {
+        auto left_total = total_of(node->left);
+        if (index < left_total) {
+            node = node->left;
+        } else if (index < left_total + node->count) {
+            return &node->values[index - left_total];
+        } else {
+            index -= left_total + node->count;
+            node = node->right;
+        }
+    }
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::push_front(const T& value) {
+    insert(0, value);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::push_back(const T& value) {
+    insert(size(), value);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::insert(size_t index, const T& value) {
+    if (index > size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    // O valor pode estar no bloco que será deslocado ou dividido: é copiado
+    // antes.
+    T copy = value;
+    root = insert_into(root, index, copy);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    remove(0);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    remove(size() - 1);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::remove(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    root = remove_from(root, index);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::clear() {
+    destroy(root);
+    root = nullptr;
+}
+
+template <class T, size_t Chunk>
+auto IndexedSequence<T, Chunk>::split(size_t index) -> IndexedSequence {
+    if (index > size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    auto parts = split_at(root, index);
+    root = parts.first;
+
+    IndexedSequence rest;
+    rest.root = parts.second;
+    rest.seed = next_priority();
+    return rest;
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::concat(IndexedSequence& other) {
+    if (this == &other) {
+        return;
+    }
+    root = merge(root, other.root);
+    other.root = nullptr;
+}
+
+template <class T, size_t Chunk>
+T* IndexedSequence<T, Chunk>::find_in(Node* node, const T& item) {
+    if (node == nullptr) {
+        return nullptr;
+    }
+    if (auto found = find_in(node->left, item)) {
+        return found;
+    }
+    for (size_t i = 0; i < node->count; i++) {
+        if (node->values[i] == item) {
+            return &node->values[i];
+        }
+    }
+    return find_in(node->right, item);
+}
+
+template <class T, size_t Chunk>
+T& IndexedSequence<T, Chunk>::find(const T& item) {
+    auto found = find_in(root, item);
+    if (found == nullptr) {
+        throw std::out_of_range("Item nao encontrado");
+    }
+    return *found;
+}
+
+template <class T, size_t Chunk>
+const T& IndexedSequence<T, Chunk>::find(const T& item) const {
+    auto found = find_in(root, item);
+    if (found == nullptr) {
+        throw std::out_of_range("Item nao encontrado");
+    }
+    return *found;
+}
+
+template <class T, size_t Chunk>
+bool IndexedSequence<T, Chunk>::contains(const T& item) const {
+    return find_in(root, item) != nullptr;
+}
+
+template <class T, size_t Chunk>
+T& IndexedSequence<T, Chunk>::operator[](size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return *element_at(index);
+}
+
+template <class T, size_t Chunk>
+const T& IndexedSequence<T, Chunk>::operator[](size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return *element_at(index);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::print_from(const Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    print_from(node->left);
+    for (size_t i = 0; i < node->count; i++) {
+        std::cout << node->values[i] << ", ";
+    }
+    print_from(node->right);
+}
+
+template <class T, size_t Chunk>
+void IndexedSequence<T, Chunk>::print() const {
+    print_from(root);
+    std::cout << "\n";
+}
@@ -0,0 +1,385 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "../include/interval_tree.hpp"
+
+template <class T>
+IntervalTree<T>::IntervalTree()
+    : nodes{nullptr}, root{npos}, free_head{npos}, used{0}, _size{0},
+      _capacity{0}, seed{2463534242u} {}
+
+template <class T>
+IntervalTree<T>::IntervalTree(const VectorList<Pair<T, T>>& intervals)
+    : IntervalTree() {
+    auto count = intervals.size();
+    reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        const auto& interval = intervals[i];
+        if (interval.second() < interval.first()) {
+            throw std::invalid_argument("Intervalo invalido");
+        }
+        nodes[i].start = interval.first();
+        nodes[i].end = interval.second();
+    }
+    std::sort(nodes, nodes + count, [](const Node& a, const Node& b) {
+        return less(a.start, a.end, b);
+    });
+
+    // Com os intervalos já em ordem, a treap é montada da esquerda para a
+    // direita: a pilha guarda o caminho mais à direita, e cada novo nó
+    // adota como filho esquerdo os nós de prioridade menor que desempilha.
+    auto path = new uint32_t[count > 0 ? count : 1];
+    size_t depth = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        nodes[i].priority = next_priority();
+        nodes[i].right = npos;
+        auto last = npos;
+        while (depth > 0 &&
+               nodes[path[depth - 1]].priority < nodes[i].priority) {
+            last = path[--depth];
+        }
+        nodes[i].left = last;
+        if (depth > 0) {
+            nodes[path[depth - 1]].right = i;
+        }
+        path[depth++] = i;
+    }
+    root = depth > 0 ? path[0] : npos;
+    delete[] path;
+
+    used = static_cast<uint32_t>(count);
+    _size = count;
+    update_all(root);
+}
+
+template <class T>
+IntervalTree<T>::~IntervalTree() {
+    delete[] nodes;
+}
+
+template <class T>
+IntervalTree<T>::IntervalTree(const IntervalTree& other) : IntervalTree() {
+    *this = other;
+}
+
+template <class T>
+IntervalTree<T>::IntervalTree(IntervalTree&& other)
+    : nodes{other.nodes}, root{other.root}, free_head{other.free_head},
+      used{other.used}, _size{other._size}, _capacity{other._capacity},
+      seed{other.seed} {
+    other.nodes = nullptr;
+    other.root = npos;
+    other.free_head = npos;
+    other.used = 0;
+    other._size = 0;
+    other._capacity = 0;
+}
+
+template <class T>
+IntervalTree<T>& IntervalTree<T>::operator=(const IntervalTree& other) {
+    if (this != &other) {
+        auto new_nodes = other._capacity > 0 ? new Node[other._capacity]
+                                             : nullptr;
+        for (uint32_t i = 0; i < other.used; i++) {
+            new_nodes[i] = other.nodes[i];
+        }
+        delete[] nodes;
+        nodes = new_nodes;
+        root = other.root;
+        free_head = other.free_head;
+        used = other.used;
+        _size = other._size;
+        _capacity = other._capacity;
+        seed = other.seed;
+    }
+    return *this;
+}
+
+template <class T>
+IntervalTree<T>& IntervalTree<T>::operator=(IntervalTree&& other) {
+    if (this != &other) {
+        delete[] nodes;
+        nodes = other.nodes;
+        root = other.root;
+        free_head = other.free_head;
+        used = other.used;
+        _size = other._size;
+        _capacity = other._capacity;
+        seed = other.seed;
+        other.nodes = nullptr;
+        other.root = npos;
+        other.free_head = npos;
+        other.used = 0;
+        other._size = 0;
+        other._capacity = 0;
+    }
+    return *this;
+}
+
+template <class T>
+size_t IntervalTree<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool IntervalTree<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+void IntervalTree<T>::reserve(size_t capacity) {
+    if (capacity <= _capacity) {
+        return;
+    } else if (capacity >= npos) {
+        throw std::length_error("A arvore esta cheia");
+    }
+    auto new_nodes = new Node[capacity];
+    for (uint32_t i = 0; i < used; i++) {
+        new_nodes[i] = nodes[i];
+    }
+    delete[] nodes;
+    nodes = new_nodes;
+    _capacity = capacity;
+}
+
+template <class T>
+bool IntervalTree<T>::less(const T& start, const T& end, const Node& node) {
+    return start < node.start || (!(node.start < start) && end < node.end);
+}
+
+template <class T>
+uint32_t IntervalTree<T>::next_priority() {
+    // xorshift32, como na IndexedSequence.
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+template <class T>
+uint32_t IntervalTree<T>::allocate_node() {
+    if (free_head != npos) {
+        auto index = free_head;
+        free_head = nodes[index].left;
+        return index;
+    }
+    if (used == _capacity) {
+        reserve(_capacity == 0 ? 16 : 2 * _capacity);
+    }
+    return used++;
+}
+
+template <class T>
+void IntervalTree<T>::release_node(uint32_t index) {
+    nodes[index].left = free_head;
+    free_head = index;
+}
+
+template <class T>
+void IntervalTree<T>::update(uint32_t index) {
+    auto& node = nodes[index];
+    node.max_end = node.end;
+    if (node.left != npos && node.max_end < nodes[node.left].max_end) {
+        node.max_end = nodes[node.left].max_end;
+    }
+    if (node.right != npos && node.max_end < nodes[node.right].max_end) {
+        node.max_end = nodes[node.right].max_end;
+    }
+}
+
+template <class T>
+void IntervalTree<T>::update_all(uint32_t index) {
+    if (index == npos) {
+        return;
+    }
+    update_all(nodes[index].left);
+    update_all(nodes[index].right);
+    update(index);
+}
+
+template <class T>
+uint32_t IntervalTree<T>::rotate_right(uint32_t index) {
+    auto left = nodes[index].left;
+    nodes[index].left = nodes[left].right;
+    nodes[left].right = index;
+    update(index);
+    update(left);
+    return left;
+}
+
+template <class T>
+uint32_t IntervalTree<T>::rotate_left(uint32_t index) {
+    auto right = nodes[index].right;
+    nodes[index].right = nodes[right].left;
+    nodes[right].left = index;
+    update(index);
+    update(right);
+    return right;
+}
+
+template <class T>
+uint32_t IntervalTree<T>::merge(uint32_t left, uint32_t right) {
+    if (left == npos) {
+        return right;
+    }
+    if (right == npos) {
+        return left;
+    }
+    if (nodes[left].priority > nodes[right].priority) {
+        nodes[left].right = merge(nodes[left].right, right);
+        update(left);
+        return left;
+    }
+    nodes[right].left = merge(left, nodes[right].left);
+    update(right);
+    return right;
+}
+
+template <class T>
+uint32_t IntervalTree<T>::insert_into(uint32_t index, uint32_t node) {
+    if (index == npos) {
+        return node;
+    }
+    if (less(nodes[node].start, nodes[node].end, nodes[index])) {
+        nodes[index].left = insert_into(nodes[index].left, node);
+        if (nodes[nodes[index].left].priority > nodes[index].priority) {
+            return rotate_right(index);
+        }
+    } else {
+        nodes[index].right = insert_into(nodes[index].right, node);
+        if (nodes[nodes[index].right].priority > nodes[index].priority) {
+            return rotate_left(index);
+        }
+    }
+    update(index);
+    return index;
+}
+
+template <class T>
+void IntervalTree<T>::insert(const T& start, const T& end) {
+    if (end < start) {
+        throw std::invalid_argument("Intervalo invalido");
+    }
+    auto node = allocate_node();
+    nodes[node].start = start;
+    nodes[node].end = end;
+    nodes[node].max_end = end;
+    nodes[node].left = npos;
+    nodes[node].right = npos;
+    nodes[node].priority = next_priority();
+    root = insert_into(root, node);
+    _size++;
+}
+
+template <class T>
+void IntervalTree<T>::insert(const Pair<T, T>& interval) {
+    insert(interval.first(), interval.second());
+}
+
+template <class T>
+uint32_t IntervalTree<T>::erase_from(uint32_t index, const T& start,
+                                     const T& end, bool& found) {
+    if (index == npos) {
+        return npos;
+    }
+    if (less(start, end, nodes[index])) {
+        nodes[index].left = erase_from(nodes[index].left, start, end, found);
+    } else if (nodes[index].start < start || nodes[index].end < end) {
+        nodes[index].right = erase_from(nodes[index].right, start, end, found);
+    } else {
+        found = true;
+        auto merged = merge(nodes[index].left, nodes[index].right);
+        release_node(index);
+        return merged;
+    }
+    update(index);
+    return index;
+}
+
+template <class T>
+bool IntervalTree<T>::erase(const T& start, const T& end) {
+    auto found = false;
+    root = erase_from(root, start, end, found);
+    if (found) {
+        _size--;
+    }
+    return found;
+}
+
+template <class T>
+bool IntervalTree<T>::contains(const T& start, const T& end) const {
+    auto index = root;
+    while (index != npos) {
+        const auto& node = nodes[index];
+        if (less(start, end, node)) {
+            index = node.left;
+        } else if (node.start < start || node.end < end) {
+            index = node.right;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T>
+template <class F>
+size_t IntervalTree<T>::visit_overlapping(uint32_t index, const T& start,
+                                          const T& end, F& visit) const {
+    // Nada nesta subárvore termina depois do início da consulta.
+    if (index == npos || nodes[index].max_end < start) {
+        return 0;
+    }
+    const auto& node = nodes[index];
+    auto count = visit_overlapping(node.left, start, end, visit);
+    // Este nó e toda a subárvore direita começam depois da consulta.
+    if (end < node.start) {
+        return count;
+    }
+    if (!(node.end < start)) {
+        visit(node.start, node.end);
+        count++;
+    }
+    return count + visit_overlapping(node.right, start, end, visit);
+}
+
+template <class T>
+template <class F>
+size_t IntervalTree<T>::overlapping(const T& start, const T& end,
+                                    F visit) const {
+    if (end < start) {
+        throw std::invalid_argument("Intervalo invalido");
+    }
+    return visit_overlapping(root, start, end, visit);
+}
+
+template <class T>
+template <class F>
+size_t IntervalTree<T>::stabbing(const T& time, F visit) const {
+    return visit_overlapping(root, time, time, visit);
+}
+
+template <class T>
+template <class F>
+void IntervalTree<T>::visit_all(uint32_t index, F& visit) const {
+    if (index == npos) {
+        return;
+    }
+    visit_all(nodes[index].left, visit);
+    visit(nodes[index].start, nodes[index].end);
+    visit_all(nodes[index].right, visit);
+}
+
+template <class T>
+template <class F>
+void IntervalTree<T>::for_each(F visit) const {
+    visit_all(root, visit);
+}
+
+template <class T>
+void IntervalTree<T>::clear() {
+    root = npos;
+    free_head = npos;
+    used = 0;
+    _size = 0;
+}
@@ -0,0 +1,269 @@
+#include "../include/kd_tree.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// Menor trecho que vale a pena entregar a outra thread na construção.
+constexpr size_t parallel_threshold = 1 << 16;
+
+}  // namespace
+
+KdTree::KdTree(const Point* first, const Point* last, unsigned threads)
+    : entries{nullptr}, _size{static_cast<size_t>(last - first)} {
+    entries = new Entry[_size > 0 ? _size : 1];
+    for (size_t i = 0; i < _size; i++) {
+        entries[i] = Entry{first[i].get_x(), first[i].get_y(), i};
+    }
+    build(threads);
+}
+
+KdTree::KdTree(const VectorList<Point>& points, unsigned threads)
+    : entries{nullptr}, _size{points.size()} {
+    entries = new Entry[_size > 0 ? _size : 1];
+    for (size_t i = 0; i < _size; i++) {
+        entries[i] = Entry{points[i].get_x(), points[i].get_y(), i};
+    }
+    build(threads);
+}
+
+KdTree::~KdTree() {
+    delete[] entries;
+}
+
+KdTree::KdTree(const KdTree& other)
+    : entries{new Entry[other._size > 0 ? other._size : 1]},
+      _size{other._size} {
+    std::copy(other.entries, other.entries + _size, entries);
+}
+
+KdTree& KdTree::operator=(const KdTree& other) {
+    if (this != &other) {
+        auto new_entries = new Entry[other._size > 0 ? other._size : 1];
+        std::copy(other.entries, other.entries + other._size, new_entries);
+        delete[] entries;
+        entries = new_entries;
+        _size = other._size;
+    }
+    return *this;
+}
+
+size_t KdTree::size() const {
+    return _size;
+}
+
+bool KdTree::empty() const {
+    return size() == 0;
+}
+
+void KdTree::build(unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    build_range(0, _size, 0, threads == 0 ? 1 : threads);
+}
+
+void KdTree::build_range(size_t lo, size_t hi, size_t depth,
+                         unsigned threads) {
+    if (hi - lo <= leaf_size) {
+        return;
+    }
+    auto mid = lo + (hi - lo) / 2;
+    if (depth % 2 == 0) {
+        std::nth_element(
+            entries + lo, entries + mid, entries + hi,
+            [](const Entry& a, const Entry& b) { return a.x < b.x; });
+    } else {
+        std::nth_element(
+            entries + lo, entries + mid, entries + hi,
+            [](const Entry& a, const Entry& b) { return a.y < b.y; });
+    }
+
+    // As duas metades são independentes: com threads sobrando, a esquerda
+    // vai para uma nova thread e a direita continua nesta.
+    if (threads > 1 && hi - lo >= parallel_threshold) {
+        auto left_threads = threads / 2;
+        std::thread left(&KdTree::build_range, this, lo, mid, depth + 1,
+                         left_threads);
+        build_range(mid + 1, hi, depth + 1, threads - left_threads);
+        left.join();
+    } else {
+        build_range(lo, mid, depth + 1, 1);
+        build_range(mid + 1, hi, depth + 1, 1);
+    }
+}
+
+void KdTree::search_nearest(size_t lo, size_t hi, size_t depth, double x,
+                            double y, size_t& best,
+                            double& best_distance) const {
+    if (hi - lo <= leaf_size) {
+        for (auto i = lo; i < hi; i++) {
+            auto dx = entries[i].x - x;
+            auto dy = entries[i].y - y;
+            auto distance = dx * dx + dy * dy;
+            if (distance < best_distance) {
+                best_distance = distance;
+                best = entries[i].index;
+            }
+        }
+        return;
+    }
+
+    auto mid = lo + (hi - lo) / 2;
+    const auto& node = entries[mid];
+    auto dx = node.x - x;
+    auto dy = node.y - y;
+    auto distance = dx * dx + dy * dy;
+    if (distance < best_distance) {
+        best_distance = distance;
+        best = node.index;
+    }
+
+    auto diff = depth % 2 == 0 ? x - node.x : y - node.y;
+    if (diff < 0) {
+        search_nearest(lo, mid, depth + 1, x, y, best, best_distance);
+        if (diff * diff < best_distance) {
+            search_nearest(mid + 1, hi, depth + 1, x, y, best, best_distance);
+        }
+    } else {
+        search_nearest(mid + 1, hi, depth + 1, x, y, best, best_distance);
+        if (diff * diff < best_distance) {
+            search_nearest(lo, mid, depth + 1, x, y, best, best_distance);
+        }
+    }
+}
+
+size_t KdTree::nearest(const Point& query) const {
+    if (empty()) {
+        throw std::out_of_range("A arvore esta vazia");
+    }
+    size_t best = 0;
+    auto best_distance = std::numeric_limits<double>::infinity();
+    search_nearest(0, _size, 0, query.get_x(), query.get_y(), best,
+                   best_distance);
+    return best;
+}
+
+void KdTree::search_k_nearest(size_t lo, size_t hi, size_t depth, double x,
+                              double y, size_t k, Candidate* heap,
+                              size_t& heap_size) const {
+    auto closer = [](const Candidate& a, const Candidate& b) {
+        return a.distance < b.distance;
+    };
+    auto offer = [&](const Entry& entry) {
+        auto dx = entry.x - x;
+        auto dy = entry.y - y;
+        Candidate candidate{dx * dx + dy * dy, entry.index};
+        if (heap_size < k) {
+            heap[heap_size++] = candidate;
+            std::push_heap(heap, heap + heap_size, closer);
+        } else if (candidate.distance < heap[0].distance) {
+            std::pop_heap(heap, heap + heap_size, closer);
+            heap[heap_size - 1] = candidate;
+            std::push_heap(heap, heap + heap_size, closer);
+        }
+    };
+
+    if (hi - lo <= leaf_size) {
+        for (auto i = lo; i < hi; i++) {
+            offer(entries[i]);
+        }
+        return;
+    }
+
+    auto mid = lo + (hi - lo) / 2;
+    const auto& node = entries[mid];
+    offer(node);
+
+    // Enquanto o heap não está cheio, o outro lado sempre precisa ser visto.
+    auto diff = depth % 2 == 0 ? x - node.x : y - node.y;
+    auto near_lo = diff < 0 ? lo : mid + 1;
+    auto near_hi = diff < 0 ? mid : hi;
+    auto far_lo = diff < 0 ? mid + 1 : lo;
+    auto far_hi = diff < 0 ? hi : mid;
+    search_k_nearest(near_lo, near_hi, depth + 1, x, y, k, heap, heap_size);
+    if (heap_size < k || diff * diff < heap[0].distance) {
+        search_k_nearest(far_lo, far_hi, depth + 1, x, y, k, heap, heap_size);
+    }
+}
+
+size_t KdTree::k_nearest(const Point& query, size_t k,
+                         size_t* indices) const {
+    if (k > _size) {
+        k = _size;
+    }
+    if (k == 0) {
+        return 0;
+    }
+    auto heap = new Candidate[k];
+    size_t heap_size = 0;
+    search_k_nearest(0, _size, 0, query.get_x(), query.get_y(), k, heap,
+                     heap_size);
+    std::sort_heap(heap, heap + heap_size,
+                   [](const Candidate& a, const Candidate& b) {
+                       return a.distance < b.distance;
+                   });
+    for (size_t i = 0; i < heap_size; i++) {
+        indices[i] = heap[i].index;
+    }
+    delete[] heap;
+    return heap_size;
+}
+
+template <class F>
+void KdTree::search_radius(size_t lo, size_t hi, size_t depth, double x,
+                           double y, double radius_squared, F& visit) const {
+    if (hi - lo <= leaf_size) {
+        for (auto i = lo; i < hi; i++) {
+            auto dx = entries[i].x - x;
+            auto dy = entries[i].y - y;
+            if (dx * dx + dy * dy <= radius_squared) {
+                visit(entries[i].index);
+            }
+        }
+        return;
+    }
+
+    auto mid = lo + (hi - lo) / 2;
+    const auto& node = entries[mid];
+    auto dx = node.x - x;
+    auto dy = node.y - y;
+    if (dx * dx + dy * dy <= radius_squared) {
+        visit(node.index);
+    }
+
+    auto diff = depth % 2 == 0 ? x - node.x : y - node.y;
+    if (diff <= 0 || diff * diff <= radius_squared) {
+        search_radius(lo, mid, depth + 1, x, y, radius_squared, visit);
+    }
+    if (diff >= 0 || diff * diff <= radius_squared) {
+        search_radius(mid + 1, hi, depth + 1, x, y, radius_squared, visit);
+    }
+}
+
+size_t KdTree::within_radius(const Point& query, double radius,
+                             VectorList<size_t>& indices) const {
+    size_t count = 0;
+    auto visit = [&](size_t index) {
+        indices.push_back(index);
+        count++;
+    };
+    if (radius >= 0) {
+        search_radius(0, _size, 0, query.get_x(), query.get_y(),
+                      radius * radius, visit);
+    }
+    return count;
+}
+
+size_t KdTree::count_within_radius(const Point& query, double radius) const {
+    size_t count = 0;
+    auto visit = [&](size_t) { count++; };
+    if (radius >= 0) {
+        search_radius(0, _size, 0, query.get_x(), query.get_y(),
+                      radius * radius, visit);
+    }
+    return count;
+}
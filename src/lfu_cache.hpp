@@ -0,0 +1,178 @@
+#include <stdexcept>
+#include <utility>
+
+#include "../include/lfu_cache.hpp"
+
+template <class K, class V, class Hash>
+LfuCache<K, V, Hash>::LfuCache(size_t capacity, Weigher weigher)
+    : _capacity(capacity), _weight(0), weigher(std::move(weigher)),
+      _hits(0), _misses(0), _evictions(0) {}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::size() const {
+    return entries.size();
+}
+
+template <class K, class V, class Hash>
+bool LfuCache<K, V, Hash>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::capacity() const {
+    return _capacity;
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::weight() const {
+    return _weight;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::leave_group(iterator it) {
+    auto frequency = (*it).frequency;
+    auto last = group_last.find(frequency);
+    if (*last != it) {
+        return;
+    }
+    if (it != entries.begin() && (*(it - 1)).frequency == frequency) {
+        *last = it - 1;
+    } else {
+        group_last.erase(frequency);
+    }
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::touch(iterator it) {
+    auto frequency = (*it).frequency;
+
+    // O nó vai para depois do último nó com frequência + 1; se esse grupo
+    // não existir, o próximo grupo já tem frequência maior, e basta ficar
+    // depois do último nó do grupo atual.
+    auto next_group = group_last.find(frequency + 1);
+    auto pos = next_group != nullptr ? *next_group + 1
+                                     : *group_last.find(frequency) + 1;
+
+    leave_group(it);
+    entries.splice(pos, entries, it, it + 1, 1);
+    (*it).frequency = frequency + 1;
+    group_last.insert(frequency + 1, it);
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::remove(iterator it) {
+    leave_group(it);
+    _weight -= (*it).weight;
+    index.erase((*it).key);
+    entries.erase(it, it + 1);
+}
+
+template <class K, class V, class Hash>
+V* LfuCache<K, V, Hash>::get(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        _misses++;
+        return nullptr;
+    }
+    _hits++;
+    auto it = *pos;
+    touch(it);
+    return &(*it).value;
+}
+
+template <class K, class V, class Hash>
+bool LfuCache<K, V, Hash>::contains(const K& key) const {
+    return index.contains(key);
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::frequency(const K& key) const {
+    auto pos = index.find(key);
+    return pos == nullptr ? 0 : (**pos).frequency;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::put(const K& key, const V& value) {
+    size_t entry_weight = weigher ? weigher(key, value) : 1;
+    if (entry_weight > capacity()) {
+        return;
+    }
+
+    auto pos = index.find(key);
+    if (pos != nullptr) {
+        auto it = *pos;
+        _weight = _weight - (*it).weight + entry_weight;
+        (*it).value = value;
+        (*it).weight = entry_weight;
+        touch(it);
+    } else {
+        // `key` e `value` podem estar em uma entrada que será descartada: a
+        // entrada nova é copiada antes.
+        Entry entry{key, value, entry_weight, 1};
+        while (weight() + entry_weight > capacity()) {
+            evict();
+        }
+        auto first_group = group_last.find(1);
+        auto ins = first_group != nullptr ? *first_group + 1 : entries.begin();
+        entries.insert(ins, entry);
+        auto it = ins - 1;
+        index.insert(entry.key, it);
+        group_last.insert(1, it);
+        _weight += entry_weight;
+    }
+
+    while (weight() > capacity()) {
+        evict();
+    }
+}
+
+template <class K, class V, class Hash>
+bool LfuCache<K, V, Hash>::erase(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        return false;
+    }
+    remove(*pos);
+    return true;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::evict() {
+    if (empty()) {
+        throw std::out_of_range("A cache esta vazia");
+    }
+    auto it = entries.begin();
+    if (on_evict) {
+        on_evict((*it).key, (*it).value);
+    }
+    _evictions++;
+    remove(it);
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::clear() {
+    entries.clear();
+    index.clear();
+    group_last.clear();
+    _weight = 0;
+}
+
+template <class K, class V, class Hash>
+void LfuCache<K, V, Hash>::set_eviction_callback(EvictionCallback callback) {
+    on_evict = std::move(callback);
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::hits() const {
+    return _hits;
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::misses() const {
+    return _misses;
+}
+
+template <class K, class V, class Hash>
+size_t LfuCache<K, V, Hash>::evictions() const {
+    return _evictions;
+}
@@ -0,0 +1,133 @@
+#include <stdexcept>
+
+#include "../include/linked_hash_map.hpp"
+
+template <class K, class V, class Hash>
+LinkedHashMap<K, V, Hash>::LinkedHashMap(size_t capacity, const Hash& hash)
+    : index(capacity, hash) {}
+
+template <class K, class V, class Hash>
+LinkedHashMap<K, V, Hash>::LinkedHashMap(const LinkedHashMap& other)
+    : index(other.size(), other.index.hash_function()) {
+    for (const auto& entry : other) {
+        insert(entry.key, entry.value);
+    }
+}
+
+template <class K, class V, class Hash>
+LinkedHashMap<K, V, Hash>& LinkedHashMap<K, V, Hash>::operator=(
+    const LinkedHashMap& other) {
+    if (this == &other) {
+        return *this;
+    }
+    entries.clear();
+    index = HashIndex<K, iterator, Hash>(other.size(),
+                                         other.index.hash_function());
+    for (const auto& entry : other) {
+        insert(entry.key, entry.value);
+    }
+    return *this;
+}
+
+template <class K, class V, class Hash>
+size_t LinkedHashMap<K, V, Hash>::size() const {
+    return entries.size();
+}
+
+template <class K, class V, class Hash>
+bool LinkedHashMap<K, V, Hash>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V, class Hash>
+void LinkedHashMap<K, V, Hash>::reserve(size_t capacity) {
+    index.reserve(capacity);
+}
+
+template <class K, class V, class Hash>
+V* LinkedHashMap<K, V, Hash>::find(const K& key) {
+    auto pos = index.find(key);
+    return pos == nullptr ? nullptr : &(*pos)->value;
+}
+
+template <class K, class V, class Hash>
+const V* LinkedHashMap<K, V, Hash>::find(const K& key) const {
+    auto pos = index.find(key);
+    return pos == nullptr ? nullptr : &(*pos)->value;
+}
+
+template <class K, class V, class Hash>
+bool LinkedHashMap<K, V, Hash>::contains(const K& key) const {
+    return index.contains(key);
+}
+
+template <class K, class V, class Hash>
+bool LinkedHashMap<K, V, Hash>::insert(const K& key, const V& value) {
+    auto pos = index.find(key);
+    if (pos != nullptr) {
+        (*pos)->value = value;
+        return false;
+    }
+    entries.push_back(Entry{key, value});
+    index.insert(key, --entries.end());
+    return true;
+}
+
+template <class K, class V, class Hash>
+bool LinkedHashMap<K, V, Hash>::erase(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        return false;
+    }
+    auto it = *pos;
+    index.erase(key);
+    entries.erase(it, it + 1);
+    return true;
+}
+
+template <class K, class V, class Hash>
+bool LinkedHashMap<K, V, Hash>::move_to_back(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        return false;
+    }
+    auto it = *pos;
+    entries.splice(entries.end(), entries, it, it + 1, 1);
+    return true;
+}
+
+template <class K, class V, class Hash>
+void LinkedHashMap<K, V, Hash>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("O mapa esta vazio");
+    }
+    auto first = entries.begin();
+    index.erase(first->key);
+    entries.erase(first, first + 1);
+}
+
+template <class K, class V, class Hash>
+void LinkedHashMap<K, V, Hash>::clear() {
+    entries.clear();
+    index.clear();
+}
+
+template <class K, class V, class Hash>
+auto LinkedHashMap<K, V, Hash>::begin() -> iterator {
+    return entries.begin();
+}
+
+template <class K, class V, class Hash>
+auto LinkedHashMap<K, V, Hash>::end() -> iterator {
+    return entries.end();
+}
+
+template <class K, class V, class Hash>
+auto LinkedHashMap<K, V, Hash>::begin() const -> const_iterator {
+    return entries.begin();
+}
+
+template <class K, class V, class Hash>
+auto LinkedHashMap<K, V, Hash>::end() const -> const_iterator {
+    return entries.end();
+}
@@ -0,0 +1,117 @@
+#include <stdexcept>
+
+#include "../include/linked_hash_set.hpp"
+
+template <class T, class Hash>
+LinkedHashSet<T, Hash>::LinkedHashSet(size_t capacity, const Hash& hash)
+    : index(capacity, hash) {}
+
+template <class T, class Hash>
+LinkedHashSet<T, Hash>::LinkedHashSet(const LinkedHashSet& other)
+    : index(other.size(), other.index.hash_function()) {
+    for (const auto& item : other) {
+        insert(item);
+    }
+}
+
+template <class T, class Hash>
+LinkedHashSet<T, Hash>& LinkedHashSet<T, Hash>::operator=(
+    const LinkedHashSet& other) {
+    if (this == &other) {
+        return *this;
+    }
+    items.clear();
+    index = HashIndex<T, iterator, Hash>(other.size(),
+                                         other.index.hash_function());
+    for (const auto& item : other) {
+        insert(item);
+    }
+    return *this;
+}
+
+template <class T, class Hash>
+size_t LinkedHashSet<T, Hash>::size() const {
+    return items.size();
+}
+
+template <class T, class Hash>
+bool LinkedHashSet<T, Hash>::empty() const {
+    return size() == 0;
+}
+
+template <class T, class Hash>
+void LinkedHashSet<T, Hash>::reserve(size_t capacity) {
+    index.reserve(capacity);
+}
+
+template <class T, class Hash>
+bool LinkedHashSet<T, Hash>::contains(const T& item) const {
+    return index.contains(item);
+}
+
+template <class T, class Hash>
+bool LinkedHashSet<T, Hash>::insert(const T& item) {
+    if (index.contains(item)) {
+        return false;
+    }
+    items.push_back(item);
+    index.insert(item, --items.end());
+    return true;
+}
+
+template <class T, class Hash>
+bool LinkedHashSet<T, Hash>::erase(const T& item) {
+    auto pos = index.find(item);
+    if (pos == nullptr) {
+        return false;
+    }
+    auto it = *pos;
+    index.erase(item);
+    items.erase(it, it + 1);
+    return true;
+}
+
+template <class T, class Hash>
+bool LinkedHashSet<T, Hash>::move_to_back(const T& item) {
+    auto pos = index.find(item);
+    if (pos == nullptr) {
+        return false;
+    }
+    auto it = *pos;
+    items.splice(items.end(), items, it, it + 1, 1);
+    return true;
+}
+
+template <class T, class Hash>
+const T& LinkedHashSet<T, Hash>::front() const {
+    if (empty()) {
+        throw std::out_of_range("O conjunto esta vazio");
+    }
+    return *items.begin();
+}
+
+template <class T, class Hash>
+void LinkedHashSet<T, Hash>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("O conjunto esta vazio");
+    }
+    auto first = items.begin();
+    index.erase(*first);
+    items.erase(first, first + 1);
+}
+
+template <class T, class Hash>
+void LinkedHashSet<T, Hash>::clear() {
+    items.clear();
+    index.clear();
+}
+
+template <class T, class Hash>
+auto LinkedHashSet<T, Hash>::begin() const -> const_iterator {
+    return items.begin();
+}
+
+template <class T, class Hash>
+auto LinkedHashSet<T, Hash>::end() const -> const_iterator {
+    return items.end();
+}
@@ -5,7 +5,8 @@
 #include "../include/linked_list.hpp"
 
 template <class T>
-LinkedList<T>::LinkedList() : head{nullptr}, _size(0) {}
+LinkedList<T>::LinkedList()
+    : head{nullptr}, _size(0), finger{nullptr}, finger_index(0) {}
 
 template <class T>
 LinkedList<T>::~LinkedList() {
@@ -39,9 +40,32 @@ void LinkedList<T>::push_front(const T& value) {
     auto new_node = new Node(value);
     new_node->next = head;
     head = new_node;
+    finger = nullptr;
     _size++;
 }
 
+template <class T>
+auto LinkedList<T>::node_at(size_t index) const -> Node* {
+    auto pos = head;
+    size_t i = 0;
+    if (finger != nullptr && finger_index <= index) {
+        pos = finger;
+        i = finger_index;
+    }
+    for (; i < index; i++) {
+        pos = pos->next;
+    }
+    return pos;
+}
+
+template <class T>
+auto LinkedList<T>::node_at(size_t index) -> Node* {
+    auto pos = static_cast<const LinkedList&>(*this).node_at(index);
+    finger = pos;
+    finger_index = index;
+    return pos;
+}
+
 template <class T>
 void LinkedList<T>::insert(size_t index, const T& value) {
     if (index > size()) {
@@ -51,15 +75,10 @@ void LinkedList<T>::insert(size_t index, const T& value) {
         return push_front(value);
     }
 
-    auto pos = head;
-    Node* prev = nullptr;
-    for (size_t i = 0; i < index; i++) {
-        prev = pos;
-        pos = pos->next;
-    }
+    auto prev = node_at(index - 1);
 
     auto new_node = new Node(value);
-    new_node->next = pos;
+    new_node->next = prev->next;
     prev->next = new_node;
 
     _size++;
@@ -86,6 +105,7 @@ void LinkedList<T>::pop_front() {
  
     old_head->next = nullptr;
     delete old_head;
+    finger = nullptr;
 
     _size--;
 }
@@ -100,13 +120,8 @@ void LinkedList<T>::remove(size_t index) {
         return pop_front();
     }
 
-    auto pos = head;
-    Node* prev = nullptr;
-
-    for (size_t i = 0; i < index; i++) {
-        prev = pos;
-        pos = pos->next;
-    }
+    auto prev = node_at(index - 1);
+    auto pos = prev->next;
 
     prev->next = pos->next;
 
@@ -122,12 +137,7 @@ T& LinkedList<T>::operator[](size_t index) {
         throw std::out_of_range("Indice invalido");
     }
 
-    auto pos = head;
-    for (size_t i = 0; i < index; i++) {
-        pos = pos->next;
-    }
-
-    return pos->value;
+    return node_at(index)->value;
 }
 
 template <class T>
@@ -136,12 +146,7 @@ const T& LinkedList<T>::operator[](size_t index) const {
         throw std::out_of_range("Indice invalido");
     }
 
-    auto pos = head;
-    for (size_t i = 0; i < index; i++) {
-        pos = pos->next;
-    }
-
-    return pos->value;
+    return node_at(index)->value;
 }
 
 template <class T>
@@ -189,12 +194,13 @@ void LinkedList<T>::clear() {
         delete head;
         _size = 0;
         head = nullptr;
+        finger = nullptr;
     }
 }
 
 template <class T>
 LinkedList<T>::LinkedList(const LinkedList& other) 
-    : head{nullptr}, _size(other.size()) {
+    : head{nullptr}, _size(other.size()), finger{nullptr}, finger_index(0) {
     if (!other.empty()) {
         head = new Node(other.head->value);
         auto other_pos = other.head->next;
@@ -0,0 +1,134 @@
+#include <stdexcept>
+#include <utility>
+
+#include "../include/lru_cache.hpp"
+
+template <class K, class V, class Hash>
+LruCache<K, V, Hash>::LruCache(size_t capacity, Weigher weigher)
+    : _capacity(capacity), _weight(0), weigher(std::move(weigher)),
+      _hits(0), _misses(0), _evictions(0) {}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::size() const {
+    return entries.size();
+}
+
+template <class K, class V, class Hash>
+bool LruCache<K, V, Hash>::empty() const {
+    return size() == 0;
+}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::capacity() const {
+    return _capacity;
+}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::weight() const {
+    return _weight;
+}
+
+template <class K, class V, class Hash>
+V* LruCache<K, V, Hash>::get(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        _misses++;
+        return nullptr;
+    }
+    _hits++;
+    auto it = *pos;
+    entries.splice(entries.begin(), entries, it, it + 1, 1);
+    return &(*it).value;
+}
+
+template <class K, class V, class Hash>
+bool LruCache<K, V, Hash>::contains(const K& key) const {
+    return index.contains(key);
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::put(const K& key, const V& value) {
+    size_t entry_weight = weigher ? weigher(key, value) : 1;
+    if (entry_weight > capacity()) {
+        return;
+    }
+
+    auto pos = index.find(key);
+    if (pos != nullptr) {
+        auto it = *pos;
+        _weight = _weight - (*it).weight + entry_weight;
+        (*it).value = value;
+        (*it).weight = entry_weight;
+        entries.splice(entries.begin(), entries, it, it + 1, 1);
+    } else {
+        // `key` e `value` podem estar em uma entrada que será descartada: a
+        // entrada nova é copiada antes.
+        Entry entry{key, value, entry_weight};
+        while (weight() + entry_weight > capacity()) {
+            evict();
+        }
+        entries.push_front(entry);
+        index.insert(entry.key, entries.begin());
+        _weight += entry_weight;
+    }
+
+    while (weight() > capacity()) {
+        evict();
+    }
+}
+
+template <class K, class V, class Hash>
+bool LruCache<K, V, Hash>::erase(const K& key) {
+    auto pos = index.find(key);
+    if (pos == nullptr) {
+        return false;
+    }
+    auto it = *pos;
+    _weight -= (*it).weight;
+    index.erase(key);
+    entries.erase(it, it + 1);
+    return true;
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::evict() {
+    if (empty()) {
+        throw std::out_of_range("A cache esta vazia");
+    }
+    auto it = entries.end() - 1;
+    auto& entry = *it;
+    if (on_evict) {
+        on_evict(entry.key, entry.value);
+    }
+    _weight -= entry.weight;
+    _evictions++;
+    index.erase(entry.key);
+    entries.pop_back();
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::clear() {
+    entries.clear();
+    index.clear();
+    _weight = 0;
+}
+
+template <class K, class V, class Hash>
+void LruCache<K, V, Hash>::set_eviction_callback(EvictionCallback callback) {
+    on_evict = std::move(callback);
+}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::hits() const {
+    return _hits;
+}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::misses() const {
+    return _misses;
+}
+
+template <class K, class V, class Hash>
+size_t LruCache<K, V, Hash>::evictions() const {
+    return _evictions;
+}
@@ -1,51 +1,132 @@
 #include "../include/pair.hpp"
 
 template <class T, class U>
-Pair<T, U>::Pair(const T& first, const U& second) : _first{first}, _second{second} {}
+constexpr Pair<T, U>::Pair() : First(), Second() {}
 
 template <class T, class U>
-const T& Pair<T, U>::first() const {
-    return _first;
-}
+template <class A, class B,
+          std::enable_if_t<std::is_constructible<T, A&&>::value &&
+                               std::is_constructible<U, B&&>::value,
+                           int>>
+constexpr Pair<T, U>::Pair(A&& first, B&& second)
+    : First(std::in_place, std::forward<A>(first)),
+      Second(std::in_place, std::forward<B>(second)) {}
+
+template <class T, class U>
+template <class... A, class... B>
+constexpr Pair<T, U>::Pair(std::piecewise_construct_t,
+                           std::tuple<A...> first, std::tuple<B...> second)
+    : Pair(first, second, std::index_sequence_for<A...>(),
+           std::index_sequence_for<B...>()) {}
+
+template <class T, class U>
+template <class TupleA, class TupleB, size_t... I, size_t... J>
+constexpr Pair<T, U>::Pair(TupleA& first, TupleB& second,
+                           std::index_sequence<I...>,
+                           std::index_sequence<J...>)
+    : First(std::in_place, std::get<I>(std::move(first))...),
+      Second(std::in_place, std::get<J>(std::move(second))...) {}
 
 template <class T, class U>
-T& Pair<T, U>::first() {
-    return _first;
+constexpr const T& Pair<T, U>::first() const {
+    return First::get();
 }
 
 template <class T, class U>
-const U& Pair<T, U>::second() const {
-    return _second;
+constexpr T& Pair<T, U>::first() {
+    return First::get();
 }
 
 template <class T, class U>
-U& Pair<T, U>::second() {
-    return _second;
+constexpr const U& Pair<T, U>::second() const {
+    return Second::get();
 }
 
 template <class T, class U>
-bool Pair<T, U>::operator==(const Pair<T, U>& other) const {
-    return first() == other.first() and second() == other.second();
+constexpr U& Pair<T, U>::second() {
+    return Second::get();
 }
 
 template <class T, class U>
-bool Pair<T, U>::operator!=(const Pair<T, U>& other) const {
-    return first() != other.first() and second() != other.second();
+constexpr int Pair<T, U>::compare(const Pair<T, U>& other) const {
+    auto order = pair_detail::compare_values(first(), other.first());
+    return order != 0 ? order
+                      : pair_detail::compare_values(second(), other.second());
 }
 
+#ifdef PAIR_THREE_WAY
 template <class T, class U>
-bool Pair<T, U>::operator>(const Pair<T, U>& other) const {
-    if (first() > other.first() or first() > other.second()){
-        return true;
-    } else if (second() > other.first or second() > other.second()) {
-        return true;
-    } else { 
-        return false;
+constexpr auto Pair<T, U>::operator<=>(const Pair<T, U>& other) const {
+    using Order =
+        std::common_comparison_category_t<decltype(first() <=> first()),
+                                          decltype(second() <=> second())>;
+    if (Order order = first() <=> other.first(); order != 0) {
+        return order;
     }
+    return Order(second() <=> other.second());
+}
+#endif
+
+template <class T, class U>
+constexpr bool Pair<T, U>::operator==(const Pair<T, U>& other) const {
+    return first() == other.first() && second() == other.second();
+}
+
+template <class T, class U>
+constexpr bool Pair<T, U>::operator!=(const Pair<T, U>& other) const {
+    return !(*this == other);
+}
+
+template <class T, class U>
+constexpr bool Pair<T, U>::operator>(const Pair<T, U>& other) const {
+    return compare(other) > 0;
+}
+
+template <class T, class U>
+constexpr bool Pair<T, U>::operator<(const Pair<T, U>& other) const {
+    return compare(other) < 0;
+}
+
+template <class T, class U>
+constexpr bool Pair<T, U>::operator>=(const Pair<T, U>& other) const {
+    return compare(other) >= 0;
 }
- 
 
+template <class T, class U>
+constexpr bool Pair<T, U>::operator<=(const Pair<T, U>& other) const {
+    return compare(other) <= 0;
+}
 
+template <class T, class U>
+template <size_t I>
+constexpr std::tuple_element_t<I, Pair<T, U>>& Pair<T, U>::get() & {
+    if constexpr (I == 0) {
+        return first();
+    } else {
+        return second();
+    }
+}
 
+template <class T, class U>
+template <size_t I>
+constexpr const std::tuple_element_t<I, Pair<T, U>>& Pair<T, U>::get()
+    const& {
+    if constexpr (I == 0) {
+        return first();
+    } else {
+        return second();
+    }
+}
 
+template <class T, class U>
+template <size_t I>
+constexpr std::tuple_element_t<I, Pair<T, U>>&& Pair<T, U>::get() && {
+    return std::move(get<I>());
+}
 
+template <class T, class U>
+template <size_t I>
+constexpr const std::tuple_element_t<I, Pair<T, U>>&& Pair<T, U>::get()
+    const&& {
+    return std::move(get<I>());
+}
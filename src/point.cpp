@@ -1,4 +1,7 @@
 #include "../include/point.hpp"
 
-#include <cmath>
 #include <iostream>
+
+void Point::print() const {
+    std::cout << "(" << x << ", " << y << ")\n";
+}
@@ -0,0 +1,41 @@
+#include <math.h>
+
+#include "../include/point.hpp"
+
+constexpr Point::Point(double x, double y) : x{x}, y{y} {}
+
+constexpr double Point::get_x() const {
+    return x;
+}
+
+constexpr double Point::get_y() const {
+    return y;
+}
+
+inline double Point::distance(const Point& other) const {
+    return sqrt(distance_squared(other));
+}
+
+constexpr double Point::distance_squared(const Point& other) const {
+    auto dx = other.x - x;
+    auto dy = other.y - y;
+    return dx * dx + dy * dy;
+}
+
+constexpr bool Point::within(const Point& other, double radius) const {
+    return radius >= 0 && distance_squared(other) <= radius * radius;
+}
+
+constexpr void Point::move(double dx, double dy) {
+    x += dx;
+    y += dy;
+}
+
+constexpr bool Point::is_equal(const Point& other, double epsilon) const {
+    if (epsilon <= 0) {
+        return x == other.x && y == other.y;
+    }
+    auto dx = other.x - x;
+    auto dy = other.y - y;
+    return dx <= epsilon && -dx <= epsilon && dy <= epsilon && -dy <= epsilon;
+}
@@ -0,0 +1,282 @@
+#include "../include/point_cloud.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define POINT_CLOUD_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+void distances_scalar(const double* xs, const double* ys, size_t n, double x,
+                      double y, bool root, double* out) {
+    for (size_t i = 0; i < n; i++) {
+        auto dx = xs[i] - x;
+        auto dy = ys[i] - y;
+        out[i] = root ? sqrt(dx * dx + dy * dy) : dx * dx + dy * dy;
+    }
+}
+
+void move_scalar(double* values, size_t n, double delta) {
+    for (size_t i = 0; i < n; i++) {
+        values[i] += delta;
+    }
+}
+
+#ifdef POINT_CLOUD_AVX2
+/**
+ * @brief Distâncias de `n` pontos até (x, y), quatro por iteração.
+ * @param root Falso para gravar as distâncias ao quadrado.
+ */
+__attribute__((target("avx2"))) void distances_avx2(const double* xs,
+                                                    const double* ys,
+                                                    size_t n, double x,
+                                                    double y, bool root,
+                                                    double* out) {
+    auto vx = _mm256_set1_pd(x);
+    auto vy = _mm256_set1_pd(y);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto dx = _mm256_sub_pd(_mm256_loadu_pd(xs + i), vx);
+        auto dy = _mm256_sub_pd(_mm256_loadu_pd(ys + i), vy);
+        auto squared =
+            _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        _mm256_storeu_pd(out + i, root ? _mm256_sqrt_pd(squared) : squared);
+    }
+    distances_scalar(xs + i, ys + i, n - i, x, y, root, out + i);
+}
+
+__attribute__((target("avx2"))) void move_avx2(double* values, size_t n,
+                                               double delta) {
+    auto vdelta = _mm256_set1_pd(delta);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(values + i,
+                         _mm256_add_pd(_mm256_loadu_pd(values + i), vdelta));
+    }
+    move_scalar(values + i, n - i, delta);
+}
+
+/**
+ * @brief Máscara dos pontos `[i, i + 4)` iguais a (x, y), um bit por ponto.
+ */
+__attribute__((target("avx2"))) int equal_mask_avx2(const double* xs,
+                                                    const double* ys,
+                                                    size_t i, double x,
+                                                    double y) {
+    auto same_x =
+        _mm256_cmp_pd(_mm256_loadu_pd(xs + i), _mm256_set1_pd(x), _CMP_EQ_OQ);
+    auto same_y =
+        _mm256_cmp_pd(_mm256_loadu_pd(ys + i), _mm256_set1_pd(y), _CMP_EQ_OQ);
+    return _mm256_movemask_pd(_mm256_and_pd(same_x, same_y));
+}
+#endif
+
+bool use_avx2() {
+#ifdef POINT_CLOUD_AVX2
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+#else
+    return false;
+#endif
+}
+
+void distances_kernel(const double* xs, const double* ys, size_t n, double x,
+                      double y, bool root, double* out) {
+#ifdef POINT_CLOUD_AVX2
+    if (use_avx2()) {
+        return distances_avx2(xs, ys, n, x, y, root, out);
+    }
+#endif
+    distances_scalar(xs, ys, n, x, y, root, out);
+}
+
+/**
+ * @brief Chama `f(i)` para cada ponto igual a (x, y), em ordem.
+ */
+template <class F>
+void for_each_equal(const double* xs, const double* ys, size_t n, double x,
+                    double y, F f) {
+    size_t i = 0;
+#ifdef POINT_CLOUD_AVX2
+    if (use_avx2()) {
+        for (; i + 4 <= n; i += 4) {
+            auto mask = equal_mask_avx2(xs, ys, i, x, y);
+            while (mask != 0) {
+                f(i + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (xs[i] == x && ys[i] == y) {
+            f(i);
+        }
+    }
+}
+
+}  // namespace
+
+PointCloud::PointCloud()
+    : xs{nullptr}, ys{nullptr}, _size{0}, _capacity{0} {}
+
+PointCloud::PointCloud(const VectorList<Point>& points) : PointCloud() {
+    reserve(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        push_back(points[i]);
+    }
+}
+
+PointCloud::~PointCloud() {
+    delete[] xs;
+    delete[] ys;
+}
+
+PointCloud::PointCloud(const PointCloud& other) : PointCloud() {
+    *this = other;
+}
+
+PointCloud& PointCloud::operator=(const PointCloud& other) {
+    if (this != &other) {
+        clear();
+        reserve(other.size());
+        if (other.size() > 0) {
+            memcpy(xs, other.xs, other.size() * sizeof(double));
+            memcpy(ys, other.ys, other.size() * sizeof(double));
+        }
+        _size = other.size();
+    }
+    return *this;
+}
+
+bool PointCloud::has_simd() {
+    return use_avx2();
+}
+
+size_t PointCloud::size() const {
+    return _size;
+}
+
+bool PointCloud::empty() const {
+    return size() == 0;
+}
+
+size_t PointCloud::capacity() const {
+    return _capacity;
+}
+
+void PointCloud::reserve(size_t capacity) {
+    if (capacity <= _capacity) {
+        return;
+    }
+    auto new_xs = new double[capacity];
+    auto new_ys = new double[capacity];
+    if (_size > 0) {
+        memcpy(new_xs, xs, _size * sizeof(double));
+        memcpy(new_ys, ys, _size * sizeof(double));
+    }
+    delete[] xs;
+    delete[] ys;
+    xs = new_xs;
+    ys = new_ys;
+    _capacity = capacity;
+}
+
+void PointCloud::push_back(const Point& point) {
+    if (_size == _capacity) {
+        reserve(_capacity == 0 ? 16 : 2 * _capacity);
+    }
+    xs[_size] = point.get_x();
+    ys[_size] = point.get_y();
+    _size++;
+}
+
+Point PointCloud::operator[](size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Indice invalido");
+    }
+    return Point(xs[index], ys[index]);
+}
+
+void PointCloud::clear() {
+    _size = 0;
+}
+
+const double* PointCloud::x_data() const {
+    return xs;
+}
+
+const double* PointCloud::y_data() const {
+    return ys;
+}
+
+VectorList<Point> PointCloud::to_vector_list() const {
+    VectorList<Point> points(size());
+    for (size_t i = 0; i < size(); i++) {
+        points.push_back(Point(xs[i], ys[i]));
+    }
+    return points;
+}
+
+void PointCloud::distances(const Point& query, double* distances) const {
+    distances_kernel(xs, ys, _size, query.get_x(), query.get_y(), true,
+                     distances);
+}
+
+void PointCloud::distances_squared(const Point& query,
+                                   double* distances) const {
+    distances_kernel(xs, ys, _size, query.get_x(), query.get_y(), false,
+                     distances);
+}
+
+void PointCloud::distance_tile(const PointCloud& other, size_t row_first,
+                               size_t rows, size_t col_first, size_t cols,
+                               double* tile) const {
+    if (row_first > size() || rows > size() - row_first ||
+        col_first > other.size() || cols > other.size() - col_first) {
+        throw std::out_of_range("Indice invalido");
+    }
+    // Cada linha é a distância de um ponto desta nuvem até um trecho
+    // contíguo da outra, que fica na cache entre as linhas.
+    for (size_t i = 0; i < rows; i++) {
+        distances_kernel(other.xs + col_first, other.ys + col_first, cols,
+                         xs[row_first + i], ys[row_first + i], true,
+                         tile + i * cols);
+    }
+}
+
+void PointCloud::move_all(double dx, double dy) {
+#ifdef POINT_CLOUD_AVX2
+    if (use_avx2()) {
+        move_avx2(xs, _size, dx);
+        move_avx2(ys, _size, dy);
+        return;
+    }
+#endif
+    move_scalar(xs, _size, dx);
+    move_scalar(ys, _size, dy);
+}
+
+size_t PointCloud::count_equal(const Point& point) const {
+    size_t count = 0;
+    for_each_equal(xs, ys, _size, point.get_x(), point.get_y(),
+                   [&](size_t) { count++; });
+    return count;
+}
+
+size_t PointCloud::filter_equal(const Point& point,
+                                VectorList<size_t>& indices) const {
+    size_t count = 0;
+    for_each_equal(xs, ys, _size, point.get_x(), point.get_y(),
+                   [&](size_t index) {
+                       indices.push_back(index);
+                       count++;
+                   });
+    return count;
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/radix_sort.hpp"
+
+namespace radix_detail {
+
+/// Abaixo deste tamanho, a ordenação por comparação é mais rápida.
+constexpr size_t comparison_threshold = 512;
+
+/// Menor faixa que vale a pena entregar a outra thread.
+constexpr size_t parallel_threshold = 1 << 16;
+
+/**
+ * @brief Converte a chave de um elemento para um inteiro sem sinal com a
+ * mesma ordem (invertendo o bit de sinal das chaves com sinal).
+ */
+template <class Key, class T>
+auto unsigned_key(const Key& key, const T& value) {
+    using K = std::decay_t<decltype(key(value))>;
+    static_assert(std::is_integral<K>::value, "A chave deve ser um inteiro");
+    using U = std::make_unsigned_t<K>;
+    auto bits = static_cast<U>(key(value));
+    if constexpr (std::is_signed<K>::value) {
+        bits ^= U{1} << (sizeof(U) * 8 - 1);
+    }
+    return bits;
+}
+
+/**
+ * @brief Executa `f(part, first, last)` sobre `parts` faixas contíguas de
+ * `[0, n)`, cada uma em uma thread.
+ */
+template <class F>
+void for_each_part(size_t n, size_t parts, F f) {
+    std::vector<std::thread> workers;
+    for (size_t part = 1; part < parts; part++) {
+        workers.emplace_back(f, part, n * part / parts,
+                             n * (part + 1) / parts);
+    }
+    f(0, 0, n / parts);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+}  // namespace radix_detail
+
+template <class T, class Key>
+void radix_sort_by(VectorList<T>& list, Key key, unsigned digit_bits,
+                   unsigned threads) {
+    using radix_detail::unsigned_key;
+    if (digit_bits != 8 && digit_bits != 11) {
+        throw std::invalid_argument("Tamanho de digito invalido");
+    }
+    auto n = list.size();
+    if (n < 2) {
+        return;
+    }
+    auto data = &list[0];
+    if (n < radix_detail::comparison_threshold) {
+        std::stable_sort(data, data + n, [&](const T& a, const T& b) {
+            return unsigned_key(key, a) < unsigned_key(key, b);
+        });
+        return;
+    }
+
+    using U = decltype(unsigned_key(key, *data));
+    size_t passes = (sizeof(U) * 8 + digit_bits - 1) / digit_bits;
+    size_t buckets = size_t{1} << digit_bits;
+    U mask = static_cast<U>(buckets - 1);
+    auto digit_of = [&](const T& value, size_t pass) {
+        return static_cast<size_t>(
+            (unsigned_key(key, value) >> (pass * digit_bits)) & mask);
+    };
+
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t parts = threads == 0 ? 1 : threads;
+    parts = std::max<size_t>(
+        1, std::min(parts, n / radix_detail::parallel_threshold));
+
+    // Histogramas de todas as passadas, um por faixa.
+    std::vector<size_t> counts(parts * passes * buckets);
+    radix_detail::for_each_part(
+        n, parts, [&](size_t part, size_t first, size_t last) {
+            auto count = &counts[part * passes * buckets];
+            for (auto i = first; i < last; i++) {
+                auto bits = unsigned_key(key, data[i]);
+                for (size_t pass = 0; pass < passes; pass++) {
+                    count[pass * buckets +
+                          ((bits >> (pass * digit_bits)) & mask)]++;
+                }
+            }
+        });
+
+    auto buffer = new T[n];
+    auto from = data;
+    auto to = buffer;
+    std::vector<size_t> offsets(parts * buckets);
+    bool moved = false;
+    for (size_t pass = 0; pass < passes; pass++) {
+        // Uma passada em que todos têm o mesmo dígito não muda nada.
+        auto digit = digit_of(from[0], pass);
+        size_t same = 0;
+        for (size_t part = 0; part < parts; part++) {
+            same += counts[(part * passes + pass) * buckets + digit];
+        }
+        if (same == n) {
+            continue;
+        }
+
+        // Depois da primeira distribuição, as faixas têm outros elementos e
+        // os seus histogramas desta passada precisam ser recontados.
+        if (moved && parts > 1) {
+            radix_detail::for_each_part(
+                n, parts, [&](size_t part, size_t first, size_t last) {
+                    auto count = &counts[(part * passes + pass) * buckets];
+                    std::fill(count, count + buckets, 0);
+                    for (auto i = first; i < last; i++) {
+                        count[digit_of(from[i], pass)]++;
+                    }
+                });
+        }
+
+        // Cada faixa escreve, em cada dígito, depois das faixas anteriores.
+        size_t offset = 0;
+        for (size_t bucket = 0; bucket < buckets; bucket++) {
+            for (size_t part = 0; part < parts; part++) {
+                offsets[part * buckets + bucket] = offset;
+                offset += counts[(part * passes + pass) * buckets + bucket];
+            }
+        }
+        radix_detail::for_each_part(
+            n, parts, [&](size_t part, size_t first, size_t last) {
+                auto offset = &offsets[part * buckets];
+                for (auto i = first; i < last; i++) {
+                    to[offset[digit_of(from[i], pass)]++] =
+                        std::move(from[i]);
+                }
+            });
+        std::swap(from, to);
+        moved = true;
+    }
+
+    if (from != data) {
+        std::move(from, from + n, data);
+    }
+    delete[] buffer;
+}
+
+inline void radix_sort(VectorList<int>& list, unsigned digit_bits,
+                       unsigned threads) {
+    radix_sort_by(list, IdentityKey(), digit_bits, threads);
+}
+
+inline void radix_sort(VectorList<Hours>& list, unsigned digit_bits,
+                       unsigned threads) {
+    radix_sort_by(list, SecondsKey(), digit_bits, threads);
+}
+
+template <class V>
+void radix_sort(VectorList<Pair<uint32_t, V>>& list, unsigned digit_bits,
+                unsigned threads) {
+    radix_sort_by(list, FirstKey(), digit_bits, threads);
+}
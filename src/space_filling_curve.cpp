@@ -0,0 +1,146 @@
+#include "../include/space_filling_curve.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "../include/pair.hpp"
+#include "../include/radix_sort.hpp"
+
+namespace {
+
+/**
+ * @brief Quantiza uma coordenada em `[low, high]` para 32 bits.
+ */
+uint32_t quantize(double value, double low, double high) {
+    if (!(high > low)) {
+        return 0;
+    }
+    auto t = (value - low) / (high - low);
+    if (!(t > 0)) {
+        return 0;
+    } else if (t >= 1) {
+        return UINT32_MAX;
+    }
+    return static_cast<uint32_t>(t * UINT32_MAX);
+}
+
+/**
+ * @brief Espalha os 32 bits de `v` nas posições pares de 64 bits.
+ */
+uint64_t spread(uint32_t v) {
+    uint64_t x = v;
+    x = (x | x << 16) & 0x0000FFFF0000FFFFull;
+    x = (x | x << 8) & 0x00FF00FF00FF00FFull;
+    x = (x | x << 4) & 0x0F0F0F0F0F0F0F0Full;
+    x = (x | x << 2) & 0x3333333333333333ull;
+    x = (x | x << 1) & 0x5555555555555555ull;
+    return x;
+}
+
+uint64_t hilbert_of(uint32_t x, uint32_t y) {
+    uint64_t d = 0;
+    for (uint32_t s = 1u << 31; s > 0; s >>= 1) {
+        uint32_t rx = (x & s) != 0;
+        uint32_t ry = (y & s) != 0;
+        d += uint64_t{s} * s * ((3 * rx) ^ ry);
+        // Gira o quadrante para que a curva dentro dele comece e termine
+        // nos cantos certos.
+        if (ry == 0) {
+            if (rx == 1) {
+                x = ~x;
+                y = ~y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/**
+ * @brief Calcula as chaves de `n` pontos e devolve a ordem da curva.
+ */
+VectorList<size_t> curve_order(const double* xs, const double* ys, size_t n,
+                               const BoundingBox& box, Curve curve) {
+    VectorList<Pair<uint64_t, size_t>> keyed(n);
+    for (size_t i = 0; i < n; i++) {
+        auto x = quantize(xs[i], box.min_x, box.max_x);
+        auto y = quantize(ys[i], box.min_y, box.max_y);
+        auto key = curve == Curve::morton ? spread(x) | spread(y) << 1
+                                          : hilbert_of(x, y);
+        keyed.push_back(Pair<uint64_t, size_t>(key, i));
+    }
+    // Estável: pontos com a mesma chave ficam na ordem original.
+    radix_sort_by(keyed, FirstKey());
+    VectorList<size_t> order(n);
+    for (size_t i = 0; i < n; i++) {
+        order.push_back(keyed[i].second());
+    }
+    return order;
+}
+
+}  // namespace
+
+uint64_t morton_key(const Point& point, const BoundingBox& box) {
+    return spread(quantize(point.get_x(), box.min_x, box.max_x)) |
+           spread(quantize(point.get_y(), box.min_y, box.max_y)) << 1;
+}
+
+uint64_t hilbert_key(const Point& point, const BoundingBox& box) {
+    return hilbert_of(quantize(point.get_x(), box.min_x, box.max_x),
+                      quantize(point.get_y(), box.min_y, box.max_y));
+}
+
+VectorList<size_t> sort_by_curve(VectorList<Point>& points, Curve curve) {
+    auto n = points.size();
+    if (n == 0) {
+        return VectorList<size_t>(0);
+    }
+    auto xs = new double[n];
+    auto ys = new double[n];
+    for (size_t i = 0; i < n; i++) {
+        xs[i] = points[i].get_x();
+        ys[i] = points[i].get_y();
+    }
+    auto order = curve_order(xs, ys, n, bounding_box(points), curve);
+    for (size_t i = 0; i < n; i++) {
+        points[i] = Point(xs[order[i]], ys[order[i]]);
+    }
+    delete[] xs;
+    delete[] ys;
+    return order;
+}
+
+VectorList<size_t> sort_by_curve(PointCloud& points, Curve curve) {
+    auto n = points.size();
+    if (n == 0) {
+        return VectorList<size_t>(0);
+    }
+    auto order = curve_order(points.x_data(), points.y_data(), n,
+                             bounding_box(points), curve);
+    PointCloud sorted;
+    sorted.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        sorted.push_back(points[order[i]]);
+    }
+    points = sorted;
+    return order;
+}
+
+VectorList<size_t> invert_permutation(const VectorList<size_t>& order) {
+    auto n = order.size();
+    auto seen = new bool[n > 0 ? n : 1]();
+    VectorList<size_t> inverse(n);
+    for (size_t i = 0; i < n; i++) {
+        inverse.push_back(0);
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (order[i] >= n || seen[order[i]]) {
+            delete[] seen;
+            throw std::invalid_argument("A ordem nao e uma permutacao");
+        }
+        seen[order[i]] = true;
+        inverse[order[i]] = i;
+    }
+    delete[] seen;
+    return inverse;
+}
@@ -0,0 +1,329 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/spatial_grid.hpp"
+
+template <class T>
+SpatialGrid<T>::SpatialGrid(double cell_size, size_t buckets)
+    : buckets{nullptr}, bucket_mask{0}, slots{nullptr}, slots_used{0},
+      slot_capacity{0}, free_head{npos}, _size{0}, _cell_size{cell_size},
+      inverse_size{1 / cell_size} {
+    if (!(cell_size > 0)) {
+        throw std::invalid_argument("O tamanho da celula deve ser positivo");
+    }
+    size_t count = 1;
+    while (count < buckets && count < (size_t{1} << 31)) {
+        count *= 2;
+    }
+    this->buckets = new Bucket[count]();
+    bucket_mask = static_cast<uint32_t>(count - 1);
+}
+
+template <class T>
+SpatialGrid<T>::~SpatialGrid() {
+    for (size_t i = 0; i <= bucket_mask; i++) {
+        delete[] buckets[i].entries;
+    }
+    delete[] buckets;
+    delete[] slots;
+}
+
+template <class T>
+size_t SpatialGrid<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool SpatialGrid<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+double SpatialGrid<T>::cell_size() const {
+    return _cell_size;
+}
+
+template <class T>
+int32_t SpatialGrid<T>::cell_of(double coordinate) const {
+    auto cell = floor(coordinate * inverse_size);
+    if (!(cell >= INT32_MIN)) {
+        return INT32_MIN;
+    } else if (cell > INT32_MAX) {
+        return INT32_MAX;
+    }
+    return static_cast<int32_t>(cell);
+}
+
+template <class T>
+uint32_t SpatialGrid<T>::bucket_of(int32_t cx, int32_t cy) const {
+    auto key = static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32 |
+               static_cast<uint32_t>(cy);
+    key ^= key >> 29;
+    key *= 0x9E3779B97F4A7C15ull;
+    return static_cast<uint32_t>(key >> 32) & bucket_mask;
+}
+
+template <class T>
+auto SpatialGrid<T>::entry_of(Handle handle) const -> Entry& {
+    if (!contains(handle)) {
+        throw std::out_of_range("Identificador invalido");
+    }
+    const auto& slot = slots[handle.index];
+    return buckets[slot.bucket].entries[slot.position];
+}
+
+template <class T>
+void SpatialGrid<T>::append(uint32_t bucket, const Entry& entry) {
+    auto& target = buckets[bucket];
+    if (target.size == target.capacity) {
+        auto capacity = target.capacity == 0 ? 4 : 2 * target.capacity;
+        auto entries = new Entry[capacity];
+        for (uint32_t i = 0; i < target.size; i++) {
+            entries[i] = std::move(target.entries[i]);
+        }
+        delete[] target.entries;
+        target.entries = entries;
+        target.capacity = capacity;
+    }
+    target.entries[target.size] = entry;
+    slots[entry.slot].bucket = bucket;
+    slots[entry.slot].position = target.size;
+    target.size++;
+}
+
+template <class T>
+void SpatialGrid<T>::detach(uint32_t bucket, uint32_t position) {
+    auto& source = buckets[bucket];
+    auto last = source.size - 1;
+    if (position != last) {
+        source.entries[position] = std::move(source.entries[last]);
+        slots[source.entries[position].slot].position = position;
+    }
+    source.size--;
+}
+
+template <class T>
+void SpatialGrid<T>::rehome(uint32_t slot) {
+    auto bucket = slots[slot].bucket;
+    auto position = slots[slot].position;
+    auto& entry = buckets[bucket].entries[position];
+    auto target = bucket_of(entry.cx, entry.cy);
+    if (target == bucket) {
+        return;
+    }
+    auto moved = std::move(entry);
+    detach(bucket, position);
+    append(target, moved);
+}
+
+template <class T>
+auto SpatialGrid<T>::insert(const Point& point, const T& value) -> Handle {
+    uint32_t slot;
+    if (free_head != npos) {
+        slot = free_head;
+        free_head = slots[slot].position;
+    } else {
+        if (slots_used == slot_capacity) {
+            if (slot_capacity == npos) {
+                throw std::length_error("A grade esta cheia");
+            }
+            auto capacity = slot_capacity == 0 ? 16u
+                            : slot_capacity > npos / 2 ? npos
+                                                       : 2 * slot_capacity;
+            auto new_slots = new Slot[capacity];
+            for (uint32_t i = 0; i < slots_used; i++) {
+                new_slots[i] = slots[i];
+            }
+            delete[] slots;
+            slots = new_slots;
+            slot_capacity = capacity;
+        }
+        slot = slots_used++;
+        slots[slot].generation = 0;
+    }
+
+    auto cx = cell_of(point.get_x());
+    auto cy = cell_of(point.get_y());
+    append(bucket_of(cx, cy),
+           Entry{point.get_x(), point.get_y(), value, cx, cy, slot});
+    _size++;
+    return Handle{slot, slots[slot].generation};
+}
+
+template <class T>
+bool SpatialGrid<T>::contains(Handle handle) const {
+    return handle.index < slots_used && slots[handle.index].bucket != npos &&
+           slots[handle.index].generation == handle.generation;
+}
+
+template <class T>
+bool SpatialGrid<T>::remove(Handle handle) {
+    if (!contains(handle)) {
+        return false;
+    }
+    auto& slot = slots[handle.index];
+    detach(slot.bucket, slot.position);
+    slot.bucket = npos;
+    slot.position = free_head;
+    slot.generation++;
+    free_head = handle.index;
+    _size--;
+    return true;
+}
+
+template <class T>
+Point SpatialGrid<T>::position(Handle handle) const {
+    const auto& entry = entry_of(handle);
+    return Point(entry.x, entry.y);
+}
+
+template <class T>
+T& SpatialGrid<T>::value(Handle handle) {
+    return entry_of(handle).value;
+}
+
+template <class T>
+const T& SpatialGrid<T>::value(Handle handle) const {
+    return entry_of(handle).value;
+}
+
+template <class T>
+void SpatialGrid<T>::relocate(Handle handle, const Point& point) {
+    auto& entry = entry_of(handle);
+    entry.x = point.get_x();
+    entry.y = point.get_y();
+    entry.cx = cell_of(entry.x);
+    entry.cy = cell_of(entry.y);
+    rehome(handle.index);
+}
+
+template <class T>
+void SpatialGrid<T>::move(Handle handle, double dx, double dy) {
+    auto point = position(handle);
+    point.move(dx, dy);
+    relocate(handle, point);
+}
+
+template <class T>
+template <class F>
+size_t SpatialGrid<T>::for_each_within(const Point& center, double radius,
+                                       F visit) const {
+    if (!(radius >= 0)) {
+        return 0;
+    }
+    auto x = center.get_x();
+    auto y = center.get_y();
+    size_t count = 0;
+    auto scan = [&](const Bucket& bucket, bool check_cell, int64_t cx,
+                    int64_t cy) {
+        for (uint32_t i = 0; i < bucket.size; i++) {
+            const auto& entry = bucket.entries[i];
+            if (check_cell && (entry.cx != cx || entry.cy != cy)) {
+                continue;
+            }
+            Point point(entry.x, entry.y);
+            if (point.within(center, radius)) {
+                visit(point, entry.value);
+                count++;
+            }
+        }
+    };
+
+    int64_t first_x = cell_of(x - radius);
+    int64_t last_x = cell_of(x + radius);
+    int64_t first_y = cell_of(y - radius);
+    int64_t last_y = cell_of(y + radius);
+    auto cells = static_cast<double>(last_x - first_x + 1) *
+                 static_cast<double>(last_y - first_y + 1);
+
+    // Um raio que cobre mais células que baldes é mais barato percorrendo
+    // cada balde uma única vez.
+    if (cells > bucket_mask) {
+        for (size_t i = 0; i <= bucket_mask; i++) {
+            scan(buckets[i], false, 0, 0);
+        }
+        return count;
+    }
+    for (auto cx = first_x; cx <= last_x; cx++) {
+        for (auto cy = first_y; cy <= last_y; cy++) {
+            auto bucket = bucket_of(static_cast<int32_t>(cx),
+                                    static_cast<int32_t>(cy));
+            scan(buckets[bucket], true, cx, cy);
+        }
+    }
+    return count;
+}
+
+template <class T>
+template <class F>
+void SpatialGrid<T>::update(F f, unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t bucket_count = size_t{bucket_mask} + 1;
+    size_t parts = threads == 0 ? 1 : threads;
+    if (parts > bucket_count) {
+        parts = bucket_count;
+    }
+
+    // Primeira fase: cada parte atualiza os pontos de uma faixa de baldes no
+    // próprio lugar e anota os que precisam mudar de balde.
+    std::vector<std::vector<uint32_t>> leaving(parts);
+    auto work = [&](size_t part) {
+        auto first = bucket_count * part / parts;
+        auto last = bucket_count * (part + 1) / parts;
+        for (auto b = first; b < last; b++) {
+            auto& bucket = buckets[b];
+            for (uint32_t i = 0; i < bucket.size; i++) {
+                auto& entry = bucket.entries[i];
+                Point point(entry.x, entry.y);
+                f(point, entry.value);
+                entry.x = point.get_x();
+                entry.y = point.get_y();
+                entry.cx = cell_of(entry.x);
+                entry.cy = cell_of(entry.y);
+                if (bucket_of(entry.cx, entry.cy) != b) {
+                    leaving[part].push_back(entry.slot);
+                }
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t part = 1; part < parts; part++) {
+        workers.emplace_back(work, part);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Segunda fase: as realocações mexem em dois baldes e são feitas em
+    // série.
+    for (const auto& slots_leaving : leaving) {
+        for (auto slot : slots_leaving) {
+            rehome(slot);
+        }
+    }
+}
+
+template <class T>
+void SpatialGrid<T>::clear() {
+    for (size_t i = 0; i <= bucket_mask; i++) {
+        buckets[i].size = 0;
+    }
+    free_head = npos;
+    for (uint32_t i = slots_used; i > 0; i--) {
+        auto& slot = slots[i - 1];
+        if (slot.bucket != npos) {
+            slot.bucket = npos;
+            slot.generation++;
+        }
+        slot.position = free_head;
+        free_head = i - 1;
+    }
+    _size = 0;
+}
@@ -0,0 +1,235 @@
+#include <stdexcept>
+#include <utility>
+
+#include "../include/timer_wheel.hpp"
+
+template <class T>
+TimerWheel<T>::TimerWheel(uint64_t now)
+    : nodes{nullptr}, free_head{npos}, used{0}, _size(0), _capacity(0),
+      current(now) {
+    reserve(0);
+    for (uint32_t i = 0; i < bucket_count; i++) {
+        nodes[i].next = i;
+        nodes[i].prev = i;
+    }
+    used = bucket_count;
+}
+
+template <class T>
+TimerWheel<T>::TimerWheel(const Hours& now)
+    : TimerWheel(static_cast<uint64_t>(now.to_seconds())) {}
+
+template <class T>
+TimerWheel<T>::~TimerWheel() {
+    delete[] nodes;
+}
+
+template <class T>
+size_t TimerWheel<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool TimerWheel<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+uint64_t TimerWheel<T>::now() const {
+    return current;
+}
+
+template <class T>
+void TimerWheel<T>::reserve(size_t capacity) {
+    // As primeiras posições do arranjo são os sentinelas dos baldes.
+    auto slots = capacity + bucket_count;
+    if (slots <= _capacity) {
+        return;
+    } else if (slots > npos) {
+        throw std::length_error("A roda esta cheia");
+    }
+    auto new_nodes = new Node[slots];
+    for (uint32_t i = 0; i < used; i++) {
+        new_nodes[i].value = std::move(nodes[i].value);
+        new_nodes[i].deadline = nodes[i].deadline;
+        new_nodes[i].next = nodes[i].next;
+        new_nodes[i].prev = nodes[i].prev;
+        new_nodes[i].generation = nodes[i].generation;
+    }
+    delete[] nodes;
+    nodes = new_nodes;
+    _capacity = slots;
+}
+
+template <class T>
+uint32_t TimerWheel<T>::allocate_node() {
+    if (free_head != npos) {
+        auto index = free_head;
+        free_head = nodes[index].next;
+        return index;
+    }
+    if (used == _capacity) {
+        reserve(2 * _capacity);
+    }
+    nodes[used].generation = 0;
+    return used++;
+}
+
+template <class T>
+void TimerWheel<T>::release_node(uint32_t index) {
+    // O valor é descartado agora, e não quando o nó for reaproveitado.
+    nodes[index].value = T();
+    nodes[index].generation++;
+    nodes[index].next = free_head;
+    free_head = index;
+}
+
+template <class T>
+void TimerWheel<T>::link_back(uint32_t bucket, uint32_t index) {
+    auto last = nodes[bucket].prev;
+    nodes[index].next = bucket;
+    nodes[index].prev = last;
+    nodes[last].next = index;
+    nodes[bucket].prev = index;
+}
+
+template <class T>
+void TimerWheel<T>::unlink(uint32_t index) {
+    auto next = nodes[index].next;
+    auto prev = nodes[index].prev;
+    nodes[prev].next = next;
+    nodes[next].prev = prev;
+}
+
+template <class T>
+void TimerWheel<T>::place(uint32_t index) {
+    auto deadline = nodes[index].deadline;
+    if (deadline / 60 == current / 60) {
+        link_back(deadline % second_slots, index);
+    } else if (deadline / 3600 == current / 3600) {
+        link_back(minute_base + deadline / 60 % minute_slots, index);
+    } else if (deadline / 86400 == current / 86400) {
+        link_back(hour_base + deadline / 3600 % hour_slots, index);
+    } else {
+        link_back(overflow, index);
+    }
+}
+
+template <class T>
+void TimerWheel<T>::cascade(uint32_t bucket) {
+    if (nodes[bucket].next == bucket) {
+        return;
+    }
+    // O balde é esvaziado antes da redistribuição, pois um nó do transbordo
+    // pode voltar para ele.
+    auto pos = nodes[bucket].next;
+    auto last = nodes[bucket].prev;
+    nodes[bucket].next = bucket;
+    nodes[bucket].prev = bucket;
+    while (true) {
+        auto next = nodes[pos].next;
+        place(pos);
+        if (pos == last) {
+            break;
+        }
+        pos = next;
+    }
+}
+
+template <class T>
+auto TimerWheel<T>::schedule(uint64_t deadline, const T& value) -> Handle {
+    if (deadline <= current) {
+        deadline = current + 1;
+    }
+    auto index = allocate_node();
+    nodes[index].value = value;
+    nodes[index].deadline = deadline;
+    place(index);
+    _size++;
+    return Handle{index, nodes[index].generation};
+}
+
+template <class T>
+auto TimerWheel<T>::schedule(const Hours& deadline, const T& value)
+    -> Handle {
+    return schedule(static_cast<uint64_t>(deadline.to_seconds()), value);
+}
+
+template <class T>
+bool TimerWheel<T>::pending(Handle handle) const {
+    return handle.index >= bucket_count && handle.index < used &&
+           nodes[handle.index].generation == handle.generation;
+}
+
+template <class T>
+bool TimerWheel<T>::cancel(Handle handle) {
+    if (!pending(handle)) {
+        return false;
+    }
+    unlink(handle.index);
+    release_node(handle.index);
+    _size--;
+    return true;
+}
+
+template <class T>
+template <class F>
+size_t TimerWheel<T>::tick(F on_expire) {
+    current++;
+    if (current % 60 == 0) {
+        if (current % 3600 == 0) {
+            if (current % 86400 == 0) {
+                cascade(overflow);
+            }
+            cascade(hour_base + current / 3600 % hour_slots);
+        }
+        cascade(minute_base + current / 60 % minute_slots);
+    }
+
+    // O nó é liberado antes da chamada, que pode agendar novos
+    // temporizadores e realocar o arranjo.
+    size_t expired = 0;
+    uint32_t bucket = current % second_slots;
+    while (nodes[bucket].next != bucket) {
+        auto index = nodes[bucket].next;
+        unlink(index);
+        T value = std::move(nodes[index].value);
+        release_node(index);
+        _size--;
+        expired++;
+        on_expire(value);
+    }
+    return expired;
+}
+
+template <class T>
+template <class F>
+size_t TimerWheel<T>::advance(uint64_t now, F on_expire) {
+    size_t expired = 0;
+    while (current < now) {
+        if (empty()) {
+            current = now;
+            break;
+        }
+        expired += tick(on_expire);
+    }
+    return expired;
+}
+
+template <class T>
+template <class F>
+size_t TimerWheel<T>::advance(const Hours& now, F on_expire) {
+    return advance(static_cast<uint64_t>(now.to_seconds()), on_expire);
+}
+
+template <class T>
+void TimerWheel<T>::clear() {
+    for (uint32_t bucket = 0; bucket < bucket_count; bucket++) {
+        while (nodes[bucket].next != bucket) {
+            auto index = nodes[bucket].next;
+            unlink(index);
+            release_node(index);
+        }
+    }
+    _size = 0;
+}
@@ -1,5 +1,8 @@
+#include <string.h>
+
 #include <iostream>
 #include <stdexcept>
+#include <type_traits>
 
 #include "../include/vector_list.hpp"
 
@@ -10,9 +13,7 @@ VectorList<T>::VectorList(size_t capacity)
 template <class T>
 VectorList<T>::VectorList(const VectorList& list) 
     : data{new T[list.capacity()]}, _size{0}, _capacity{list.capacity()} {
-    for (size_t i = 0; i < list.size(); i++) {
-        push_back(list[i]);
-    }
+    copy_from(list);
 }
 
 template <class T>
@@ -23,12 +24,25 @@ VectorList<T>& VectorList<T>::operator=(const VectorList& list) {
         _capacity = list.capacity();
     }
     clear();
-    for (size_t i = 0; i < list.size(); i++) {
-        push_back(list[i]);
-    }
+    copy_from(list);
     return *this;
 }
 
+template <class T>
+void VectorList<T>::copy_from(const VectorList& list) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (list.size() > 0) {
+            memcpy(static_cast<void*>(data), list.data,
+                   list.size() * sizeof(T));
+        }
+        _size = list.size();
+    } else {
+        for (size_t i = 0; i < list.size(); i++) {
+            push_back(list[i]);
+        }
+    }
+}
+
 template <class T>
 VectorList<T>::~VectorList() {
     delete[] data;
@@ -85,8 +99,13 @@ void VectorList<T>::insert(size_t index, const T& value) {
         return push_back(value);
     }
 
-    for (size_t i = size(); i > index; i--) {
-        data[i] = data[i - 1];
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        memmove(static_cast<void*>(data + index + 1), data + index,
+                (size() - index) * sizeof(T));
+    } else {
+        for (size_t i = size(); i > index; i--) {
+            data[i] = data[i - 1];
+        }
     }
 
     data[index] = value;
@@ -104,8 +123,13 @@ void VectorList<T>::remove(size_t index) {
         return pop_back();
     }
 
-    for (size_t i = index; i < size() - 1; i++) {
-        data[i] = data[i + 1];
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        memmove(static_cast<void*>(data + index), data + index + 1,
+                (size() - index - 1) * sizeof(T));
+    } else {
+        for (size_t i = index; i < size() - 1; i++) {
+            data[i] = data[i + 1];
+        }
     }
 
     _size--;
@@ -0,0 +1,239 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/xor_linked_list.hpp"
+
+template <class T>
+XorLinkedList<T>::Node::Node(const T& value) : value{value}, link{0} {}
+
+template <class T>
+template <class N>
+N* XorLinkedList<T>::neighbor(N* node, N* other) {
+    return reinterpret_cast<N*>(node->link ^ reinterpret_cast<uintptr_t>(other));
+}
+
+template <class T>
+XorLinkedList<T>::XorLinkedList() : head{nullptr}, tail{nullptr}, _size(0) {}
+
+template <class T>
+XorLinkedList<T>::XorLinkedList(const XorLinkedList<T>& list)
+    : head{nullptr}, tail{nullptr}, _size(0) {
+    for (auto& i : list) {
+        push_back(i);
+    }
+}
+
+template <class T>
+XorLinkedList<T>& XorLinkedList<T>::operator=(const XorLinkedList<T>& list) {
+    if (this == &list) {
+        return *this;
+    }
+    clear();
+    for (auto& i : list) {
+        push_back(i);
+    }
+    return *this;
+}
+
+template <class T>
+XorLinkedList<T>::~XorLinkedList() {
+    clear();
+}
+
+template <class T>
+size_t XorLinkedList<T>::size() const {
+    return _size;
+}
+
+template <class T>
+bool XorLinkedList<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+template <class U>
+XorLinkedList<T>::Iterator<U>::Iterator(U* prev, U* node)
+    : prev{prev}, node{node} {}
+
+template <class T>
+template <class U>
+auto& XorLinkedList<T>::Iterator<U>::operator*() const {
+    return node->value;
+}
+
+template <class T>
+template <class U>
+auto XorLinkedList<T>::Iterator<U>::operator++() -> Iterator<U>& {
+    auto next = neighbor(node, prev);
+    prev = node;
+    node = next;
+    return *this;
+}
+
+template <class T>
+template <class U>
+auto XorLinkedList<T>::Iterator<U>::operator--() -> Iterator<U>& {
+    auto before = neighbor(prev, node);
+    node = prev;
+    prev = before;
+    return *this;
+}
+
+template <class T>
+template <class U>
+bool XorLinkedList<T>::Iterator<U>::operator==(
+    const Iterator<U>& other) const {
+    return node == other.node;
+}
+
+template <class T>
+template <class U>
+bool XorLinkedList<T>::Iterator<U>::operator!=(
+    const Iterator<U>& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+auto XorLinkedList<T>::begin() const -> const_iterator {
+    return const_iterator(nullptr, head);
+}
+
+template <class T>
+auto XorLinkedList<T>::end() const -> const_iterator {
+    return const_iterator(tail, nullptr);
+}
+
+template <class T>
+auto XorLinkedList<T>::begin() -> iterator {
+    return iterator(nullptr, head);
+}
+
+template <class T>
+auto XorLinkedList<T>::end() -> iterator {
+    return iterator(tail, nullptr);
+}
+
+template <class T>
+T& XorLinkedList<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    return head->value;
+}
+
+template <class T>
+const T& XorLinkedList<T>::front() const {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    return head->value;
+}
+
+template <class T>
+T& XorLinkedList<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    return tail->value;
+}
+
+template <class T>
+const T& XorLinkedList<T>::back() const {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    return tail->value;
+}
+
+template <class T>
+void XorLinkedList<T>::push_front(const T& value) {
+    auto new_node = new Node(value);
+    new_node->link = reinterpret_cast<uintptr_t>(head);
+    if (empty()) {
+        tail = new_node;
+    } else {
+        head->link ^= reinterpret_cast<uintptr_t>(new_node);
+    }
+    head = new_node;
+    _size++;
+}
+
+template <class T>
+void XorLinkedList<T>::push_back(const T& value) {
+    auto new_node = new Node(value);
+    new_node->link = reinterpret_cast<uintptr_t>(tail);
+    if (empty()) {
+        head = new_node;
+    } else {
+        tail->link ^= reinterpret_cast<uintptr_t>(new_node);
+    }
+    tail = new_node;
+    _size++;
+}
+
+template <class T>
+void XorLinkedList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("A lista esta vazia");
+    }
+    auto old_head = head;
+    head = neighbor(old_head, static_cast<Node*>(nullptr));
+    if (head != nullptr) {
+        head->link ^= reinterpret_cast<uintptr_t>(old_head);
+    } else {
+        tail = nullptr;
+    }
+    delete old_head;
+    _size--;
+}
+
+template <class T>
+void XorLinkedList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("Lista esta vazia");
+    }
+    auto old_tail = tail;
+    tail = neighbor(old_tail, static_cast<Node*>(nullptr));
+    if (tail != nullptr) {
+        tail->link ^= reinterpret_cast<uintptr_t>(old_tail);
+    } else {
+        head = nullptr;
+    }
+    delete old_tail;
+    _size--;
+}
+
+template <class T>
+void XorLinkedList<T>::clear() {
+    // O endereço do nó anterior é guardado como inteiro, pois o nó já foi
+    // liberado quando é usado no cálculo do próximo.
+    uintptr_t prev = 0;
+    auto node = head;
+    while (node != nullptr) {
+        auto next = reinterpret_cast<Node*>(node->link ^ prev);
+        prev = reinterpret_cast<uintptr_t>(node);
+        delete node;
+        node = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    _size = 0;
+}
+
+template <class T>
+bool XorLinkedList<T>::contains(const T& item) const {
+    for (auto& value : *this) {
+        if (value == item) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T>
+void XorLinkedList<T>::print() const {
+    for (auto& v : *this) {
+        std::cout << v << " <-> ";
+    }
+    std::cout << "NULL (" << size() << ")\n";
+}
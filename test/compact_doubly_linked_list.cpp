@@ -0,0 +1,168 @@
+#include "../include/compact_doubly_linked_list.hpp"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+class CompactDoublyLinkedListTest : public ::testing::Test {
+  protected:
+    CompactDoublyLinkedList<int> list;
+};
+
+TEST_F(CompactDoublyLinkedListTest, InitiallyEmpty) {
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST_F(CompactDoublyLinkedListTest, PushAndPop) {
+    list.push_back(20);
+    list.push_front(10);
+    list.push_back(30);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list[0], 10);
+    EXPECT_EQ(list[2], 30);
+
+    list.pop_back();
+    list.pop_front();
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list[0], 20);
+
+    list.pop_back();
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_back(), std::out_of_range);
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(CompactDoublyLinkedListTest, Insert) {
+    list.insert(list.begin(), 10);
+    list.insert(list.end(), 30);
+    list.insert(list.begin() + 1, 20);
+    list.insert(list.begin(), 5);
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(list[0], 5);
+    EXPECT_EQ(list[1], 10);
+    EXPECT_EQ(list[2], 20);
+    EXPECT_EQ(list[3], 30);
+}
+
+TEST_F(CompactDoublyLinkedListTest, EraseRanges) {
+    for (int i = 0; i < 6; i++) {
+        list.push_back(i);
+    }
+    list.erase(list.begin() + 1, list.begin() + 3);
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(list[1], 3);
+
+    list.erase(list.begin(), list.begin() + 1);
+    EXPECT_EQ(list[0], 3);
+
+    list.erase(list.begin() + 1, list.end());
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(*(--list.end()), 3);
+
+    list.erase(list.begin(), list.end());
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST_F(CompactDoublyLinkedListTest, FindAndContains) {
+    list.push_back(10);
+    list.push_back(20);
+    auto it = list.find(20);
+    EXPECT_NE(it, list.end());
+    EXPECT_EQ(*it, 20);
+    EXPECT_EQ(list.find(30), list.end());
+    EXPECT_TRUE(list.contains(10));
+    EXPECT_FALSE(list.contains(30));
+}
+
+TEST_F(CompactDoublyLinkedListTest, IteratorBothDirections) {
+    for (int i = 0; i < 5; i++) {
+        list.push_back(i);
+    }
+    auto it = list.end();
+    for (int i = 4; i >= 0; i--) {
+        --it;
+        EXPECT_EQ(*it, i);
+    }
+    EXPECT_EQ(it, list.begin());
+    EXPECT_EQ(list.end() - list.begin(), 5);
+}
+
+TEST_F(CompactDoublyLinkedListTest, IndexAccessFromBothEnds) {
+    for (int i = 0; i < 1000; i++) {
+        list.push_back(i);
+    }
+    EXPECT_EQ(list[0], 0);
+    EXPECT_EQ(list[998], 998);
+    EXPECT_EQ(list[500], 500);
+    EXPECT_THROW(list[1000], std::out_of_range);
+}
+
+TEST_F(CompactDoublyLinkedListTest, RemovedNodesAreReused) {
+    for (int i = 0; i < 100; i++) {
+        list.push_back(i);
+    }
+    auto capacity = list.capacity();
+    for (int i = 0; i < 1000; i++) {
+        list.pop_front();
+        list.push_back(i);
+    }
+    EXPECT_EQ(list.capacity(), capacity);
+    EXPECT_EQ(list.memory_usage(), capacity * list.node_bytes());
+    EXPECT_EQ(list.node_bytes(), 3 * sizeof(int));
+}
+
+TEST_F(CompactDoublyLinkedListTest, CopyAndAssign) {
+    list.push_back(10);
+    list.push_back(20);
+
+    CompactDoublyLinkedList<int> copy(list);
+    CompactDoublyLinkedList<int> assigned;
+    assigned.push_back(99);
+    assigned = list;
+    list.push_back(30);
+
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[1], 20);
+    EXPECT_EQ(assigned.size(), 2);
+    EXPECT_EQ(assigned[0], 10);
+}
+
+TEST_F(CompactDoublyLinkedListTest, InsertOwnElementWhileGrowing) {
+    for (int i = 0; i < 8; i++) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(list.size(), list.capacity());
+    list.push_back(list[0]);
+    EXPECT_EQ(list[8], 0);
+
+    CompactDoublyLinkedList<std::string> words;
+    for (int i = 0; i < 8; i++) {
+        words.push_back("palavra " + std::to_string(i));
+    }
+    ASSERT_EQ(words.size(), words.capacity());
+    words.push_front(words[7]);
+    EXPECT_EQ(words[0], "palavra 7");
+    EXPECT_EQ(words[8], "palavra 7");
+}
+
+TEST_F(CompactDoublyLinkedListTest, RemovedValuesAreReleased) {
+    auto shared = std::make_shared<int>(1);
+    CompactDoublyLinkedList<std::shared_ptr<int>> owners;
+    for (int i = 0; i < 5; i++) {
+        owners.push_back(shared);
+    }
+    EXPECT_EQ(shared.use_count(), 6);
+    owners.pop_front();
+    owners.pop_back();
+    EXPECT_EQ(shared.use_count(), 4);
+    auto first = owners.begin();
+    auto last = first;
+    ++last;
+    owners.erase(first, last);
+    EXPECT_EQ(shared.use_count(), 3);
+    owners.clear();
+    EXPECT_EQ(shared.use_count(), 1);
+}
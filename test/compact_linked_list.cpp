@@ -0,0 +1,126 @@
+#include "../include/compact_linked_list.hpp"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+class CompactLinkedListTest : public ::testing::Test {
+  protected:
+    CompactLinkedList<int> list;
+};
+
+TEST_F(CompactLinkedListTest, InitiallyEmpty) {
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST_F(CompactLinkedListTest, PushFrontAndInsert) {
+    list.push_front(10);
+    list.insert(0, 20);
+    list.insert(2, 30);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list[0], 20);
+    EXPECT_EQ(list[1], 10);
+    EXPECT_EQ(list[2], 30);
+    EXPECT_THROW(list.insert(5, 1), std::out_of_range);
+}
+
+TEST_F(CompactLinkedListTest, PopFrontAndRemove) {
+    list.push_front(30);
+    list.push_front(20);
+    list.push_front(10);
+    list.remove(1);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list[1], 30);
+    list.pop_front();
+    EXPECT_EQ(list[0], 30);
+    list.pop_front();
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+    EXPECT_THROW(list.remove(0), std::out_of_range);
+}
+
+TEST_F(CompactLinkedListTest, FindAndContains) {
+    list.push_front(10);
+    list.push_front(20);
+    EXPECT_EQ(list.find(10), 10);
+    EXPECT_TRUE(list.contains(20));
+    EXPECT_FALSE(list.contains(30));
+    EXPECT_THROW(list.find(30), std::out_of_range);
+}
+
+TEST_F(CompactLinkedListTest, IteratorTraversal) {
+    for (int i = 4; i >= 0; i--) {
+        list.push_front(i);
+    }
+    int expected = 0;
+    for (auto& v : list) {
+        EXPECT_EQ(v, expected++);
+    }
+    EXPECT_EQ(expected, 5);
+}
+
+TEST_F(CompactLinkedListTest, RemovedNodesAreReused) {
+    for (int i = 0; i < 100; i++) {
+        list.push_front(i);
+    }
+    auto capacity = list.capacity();
+    for (int i = 0; i < 1000; i++) {
+        list.pop_front();
+        list.push_front(i);
+    }
+    EXPECT_EQ(list.capacity(), capacity);
+    EXPECT_EQ(list.memory_usage(), capacity * list.node_bytes());
+    EXPECT_EQ(list.node_bytes(), 2 * sizeof(int));
+}
+
+TEST_F(CompactLinkedListTest, CopyAndAssign) {
+    list.push_front(10);
+    list.push_front(20);
+
+    CompactLinkedList<int> copy(list);
+    CompactLinkedList<int> assigned;
+    assigned = list;
+    list.push_front(30);
+
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[0], 20);
+    EXPECT_EQ(copy[1], 10);
+    EXPECT_EQ(assigned.size(), 2);
+    EXPECT_EQ(assigned[1], 10);
+}
+
+TEST_F(CompactLinkedListTest, InsertOwnElementWhileGrowing) {
+    for (int i = 0; i < 8; i++) {
+        list.push_front(i);
+    }
+    ASSERT_EQ(list.size(), list.capacity());
+    list.push_front(list[0]);
+    EXPECT_EQ(list[0], 7);
+    EXPECT_EQ(list[1], 7);
+
+    CompactLinkedList<std::string> words;
+    for (int i = 0; i < 8; i++) {
+        words.push_front("palavra " + std::to_string(i));
+    }
+    ASSERT_EQ(words.size(), words.capacity());
+    words.insert(3, words[5]);
+    EXPECT_EQ(words[3], "palavra 2");
+    EXPECT_EQ(words.size(), 9);
+}
+
+TEST_F(CompactLinkedListTest, RemovedValuesAreReleased) {
+    auto shared = std::make_shared<int>(1);
+    CompactLinkedList<std::shared_ptr<int>> owners;
+    for (int i = 0; i < 4; i++) {
+        owners.push_front(shared);
+    }
+    EXPECT_EQ(shared.use_count(), 5);
+    owners.pop_front();
+    EXPECT_EQ(shared.use_count(), 4);
+    owners.remove(1);
+    EXPECT_EQ(shared.use_count(), 3);
+    owners.clear();
+    EXPECT_EQ(shared.use_count(), 1);
+}
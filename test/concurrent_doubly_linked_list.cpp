@@ -0,0 +1,133 @@
+#include "../include/concurrent_doubly_linked_list.hpp"
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+class ConcurrentDoublyLinkedListTest : public ::testing::Test {
+  protected:
+    std::vector<int> values() {
+        std::vector<int> result;
+        list.for_each([&](int& v) { result.push_back(v); });
+        return result;
+    }
+
+    ConcurrentDoublyLinkedList<int> list;
+};
+
+TEST_F(ConcurrentDoublyLinkedListTest, InitiallyEmpty) {
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_FALSE(list.begin().valid());
+    EXPECT_FALSE(list.contains(1));
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, PushFrontAndBack) {
+    list.push_back(2);
+    list.push_front(1);
+    list.push_back(3);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, InsertThroughCursor) {
+    list.push_back(1);
+    list.push_back(3);
+    {
+        auto pos = list.find(3);
+        ASSERT_TRUE(pos.valid());
+        list.insert(pos, 2);
+        EXPECT_EQ(*pos, 3);
+        ++pos;
+        list.insert(pos, 4);
+    }
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3, 4}));
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, EraseThroughCursor) {
+    for (int i = 0; i < 6; i++) {
+        list.push_back(i);
+    }
+    {
+        auto pos = list.begin();
+        while (pos.valid()) {
+            if (*pos % 2 == 0) {
+                list.erase(pos);
+            } else {
+                ++pos;
+            }
+        }
+        EXPECT_THROW(list.erase(pos), std::out_of_range);
+    }
+    EXPECT_EQ(values(), (std::vector<int>{1, 3, 5}));
+    EXPECT_EQ(list.size(), 3);
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, EraseByValue) {
+    list.push_back(1);
+    list.push_back(2);
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_FALSE(list.erase(1));
+    EXPECT_EQ(values(), (std::vector<int>{2}));
+    list.push_front(0);
+    EXPECT_TRUE(list.erase(2));
+    list.push_back(5);
+    EXPECT_EQ(values(), (std::vector<int>{0, 5}));
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, ConcurrentPushes) {
+    const int threads = 4;
+    const int per_thread = 2000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; i++) {
+                if (i % 2 == 0) {
+                    list.push_back(t * per_thread + i);
+                } else {
+                    list.push_front(t * per_thread + i);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    EXPECT_EQ(list.size(), threads * per_thread);
+    EXPECT_EQ(values().size(), static_cast<size_t>(threads * per_thread));
+}
+
+TEST_F(ConcurrentDoublyLinkedListTest, ConcurrentMixedOperations) {
+    for (int i = 0; i < 200; i++) {
+        list.push_back(i);
+    }
+    const int threads = 4;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < 500; i++) {
+                int value = 1000 + t * 1000 + i;
+                list.push_back(value);
+                list.contains(i % 200);
+                auto pos = list.find(i % 200);
+                if (pos.valid()) {
+                    list.insert(pos, -1);
+                }
+                ++pos;
+            }
+            for (int i = 0; i < 500; i++) {
+                EXPECT_TRUE(list.erase(1000 + t * 1000 + i));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    EXPECT_EQ(list.size(), 200 + threads * 500);
+    size_t count = 0;
+    list.for_each([&](int& v) {
+        count++;
+        EXPECT_LT(v, 1000);
+    });
+    EXPECT_EQ(count, list.size());
+}
@@ -1,6 +1,13 @@
 #include "../include/doubly_linked_list.hpp"
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 // Test fixture for setting up and tearing down the DoublyLinkedList instance
 class DoublyLinkedListTest : public ::testing::Test {
   protected:
@@ -448,3 +455,280 @@ TEST_F(DoublyLinkedListTest, TestEraseSingleElement3) {
     EXPECT_EQ(list->size(), 0); // The list should be empty
     EXPECT_TRUE(list->empty()); // The list should be empty
 }
+
+// Test sequential and reverse indexed access over a large list
+TEST_F(DoublyLinkedListTest, TestSequentialIndexAccess) {
+    for (int i = 0; i < 1000; ++i) {
+        list->push_back(i);
+    }
+    for (size_t i = 0; i < list->size(); ++i) {
+        EXPECT_EQ((*list)[i], static_cast<int>(i));
+    }
+    for (size_t i = list->size(); i > 0; --i) {
+        EXPECT_EQ((*list)[i - 1], static_cast<int>(i - 1));
+    }
+}
+
+// Test const indexed access from several threads at once
+TEST_F(DoublyLinkedListTest, TestConstIndexAccessFromThreads) {
+    for (int i = 0; i < 200; ++i) {
+        list->push_back(i);
+    }
+    EXPECT_EQ((*list)[100], 100);
+    const auto& shared = *list;
+    std::vector<long> sums(4);
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < sums.size(); ++t) {
+        readers.emplace_back([&, t] {
+            for (size_t i = 0; i < shared.size(); ++i) {
+                sums[t] += shared[i];
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    for (auto sum : sums) {
+        EXPECT_EQ(sum, 199 * 200 / 2);
+    }
+    EXPECT_EQ((*list)[101], 101);
+}
+
+// Test indexed access after changes that shift the indices
+TEST_F(DoublyLinkedListTest, TestIndexAccessAfterStructuralChanges) {
+    list->push_back(10);
+    list->push_back(20);
+    list->push_back(30);
+    EXPECT_EQ((*list)[1], 20);
+
+    list->push_front(0);
+    EXPECT_EQ((*list)[1], 10);
+
+    list->insert(list->begin() + 1, 5);
+    EXPECT_EQ((*list)[1], 5);
+
+    list->pop_back();
+    EXPECT_EQ((*list)[3], 20);
+
+    list->erase(list->begin(), list->begin() + 2);
+    EXPECT_EQ((*list)[0], 10);
+
+    list->pop_front();
+    EXPECT_EQ((*list)[0], 20);
+    EXPECT_THROW((*list)[1], std::out_of_range);
+}
+
+// Test that end() stays valid across insertions and removals
+TEST_F(DoublyLinkedListTest, TestEndIsStable) {
+    auto end = list->end();
+    list->push_back(10);
+    list->push_front(5);
+    EXPECT_EQ(end, list->end());
+    --end;
+    EXPECT_EQ(*end, 10);
+    list->clear();
+    EXPECT_EQ(list->begin(), list->end());
+}
+
+// Test moving a range between two lists with splice
+TEST_F(DoublyLinkedListTest, TestSpliceBetweenLists) {
+    DoublyLinkedList<int> other;
+    for (int i = 0; i < 5; ++i) {
+        list->push_back(i);
+        other.push_back(10 + i);
+    }
+
+    // Move 11, 12, 13 to before the element 2
+    list->splice(list->begin() + 2, other, other.begin() + 1,
+                 other.begin() + 4, 3);
+
+    EXPECT_EQ(list->size(), 8);
+    EXPECT_EQ(other.size(), 2);
+    int expected[] = {0, 1, 11, 12, 13, 2, 3, 4};
+    for (size_t i = 0; i < list->size(); ++i) {
+        EXPECT_EQ((*list)[i], expected[i]);
+    }
+    EXPECT_EQ(other[0], 10);
+    EXPECT_EQ(other[1], 14);
+    EXPECT_EQ(*(--list->end()), 4);
+}
+
+// Test moving a whole list to the end of another with splice
+TEST_F(DoublyLinkedListTest, TestSpliceWholeListToEnd) {
+    DoublyLinkedList<int> other;
+    list->push_back(1);
+    other.push_back(2);
+    other.push_back(3);
+
+    list->splice(list->end(), other, other.begin(), other.end(),
+                 other.size());
+
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other.begin(), other.end());
+    EXPECT_EQ(list->size(), 3);
+    EXPECT_EQ((*list)[2], 3);
+    EXPECT_EQ(*(--list->end()), 3);
+}
+
+// Test moving a range inside the same list with splice
+TEST_F(DoublyLinkedListTest, TestSpliceWithinList) {
+    for (int i = 0; i < 5; ++i) {
+        list->push_back(i);
+    }
+    list->splice(list->begin(), *list, list->begin() + 3, list->end(), 2);
+
+    EXPECT_EQ(list->size(), 5);
+    int expected[] = {3, 4, 0, 1, 2};
+    for (size_t i = 0; i < list->size(); ++i) {
+        EXPECT_EQ((*list)[i], expected[i]);
+    }
+}
+
+// Test at, insert_at and erase_at near both ends and in the middle
+TEST_F(DoublyLinkedListTest, TestIndexedInsertAndErase) {
+    for (int i = 0; i < 10; ++i) {
+        list->insert_at(list->size(), i);
+    }
+    list->insert_at(0, -1);
+    list->insert_at(10, 100);
+    list->insert_at(5, 50);
+
+    EXPECT_EQ(list->size(), 13);
+    EXPECT_EQ(list->at(0), -1);
+    EXPECT_EQ(list->at(5), 50);
+    EXPECT_EQ(list->at(11), 100);
+    EXPECT_EQ(list->at(12), 9);
+
+    list->erase_at(11);
+    list->erase_at(5);
+    list->erase_at(0);
+    EXPECT_EQ(list->size(), 10);
+    for (size_t i = 0; i < list->size(); ++i) {
+        EXPECT_EQ(list->at(i), static_cast<int>(i));
+    }
+
+    list->erase_at(9);
+    EXPECT_EQ(*(--list->end()), 8);
+
+    EXPECT_THROW(list->at(9), std::out_of_range);
+    EXPECT_THROW(list->insert_at(10, 0), std::out_of_range);
+    EXPECT_THROW(list->erase_at(9), std::out_of_range);
+}
+
+// Test consecutive insert_at and erase_at on the same region
+TEST_F(DoublyLinkedListTest, TestSequentialIndexedInsertAndErase) {
+    list->push_back(0);
+    list->push_back(1000);
+    for (int i = 1; i < 500; ++i) {
+        list->insert_at(i, i);
+    }
+    for (size_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(list->at(i), static_cast<int>(i));
+    }
+    EXPECT_EQ(list->at(500), 1000);
+    for (int i = 0; i < 250; ++i) {
+        list->erase_at(100);
+    }
+    EXPECT_EQ(list->size(), 251);
+    EXPECT_EQ(list->at(99), 99);
+    EXPECT_EQ(list->at(100), 350);
+}
+
+// Test that splicing a range to its own position changes nothing
+TEST_F(DoublyLinkedListTest, TestSpliceToSamePosition) {
+    for (int i = 0; i < 3; ++i) {
+        list->push_back(i);
+    }
+    list->splice(list->begin(), *list, list->begin(), list->begin() + 1, 1);
+    list->splice(list->begin() + 2, *list, list->begin() + 1,
+                 list->begin() + 2, 1);
+
+    EXPECT_EQ(list->size(), 3);
+    for (size_t i = 0; i < list->size(); ++i) {
+        EXPECT_EQ((*list)[i], static_cast<int>(i));
+    }
+}
+
+// Test that the iterators expose the standard bidirectional traits
+TEST_F(DoublyLinkedListTest, TestIteratorTraits) {
+    using iterator = DoublyLinkedList<int>::iterator;
+    using const_iterator = DoublyLinkedList<int>::const_iterator;
+    using traits = std::iterator_traits<iterator>;
+
+    EXPECT_TRUE((std::is_same_v<traits::iterator_category,
+                                std::bidirectional_iterator_tag>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, int>));
+    EXPECT_TRUE((std::is_same_v<traits::reference, int &>));
+    EXPECT_TRUE((std::is_same_v<
+                 std::iterator_traits<const_iterator>::reference,
+                 const int &>));
+    EXPECT_TRUE((std::is_convertible_v<iterator, const_iterator>));
+    EXPECT_FALSE((std::is_convertible_v<const_iterator, iterator>));
+}
+
+// Test postfix increment and decrement
+TEST_F(DoublyLinkedListTest, TestIteratorPostfix) {
+    for (int i = 0; i < 3; ++i) {
+        list->push_back(i);
+    }
+    auto it = list->begin();
+    EXPECT_EQ(*it++, 0);
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(*it--, 1);
+    EXPECT_EQ(*it, 0);
+}
+
+// Test the standard algorithms over the list
+TEST_F(DoublyLinkedListTest, TestStandardAlgorithms) {
+    for (int i = 0; i < 5; ++i) {
+        list->push_back(i);
+    }
+    auto found = std::find(list->begin(), list->end(), 3);
+    ASSERT_NE(found, list->end());
+    EXPECT_EQ(*found, 3);
+    EXPECT_EQ(std::find(list->cbegin(), list->cend(), 7), list->cend());
+    EXPECT_EQ(std::distance(list->begin(), list->end()), 5);
+
+    std::for_each(list->begin(), list->end(), [](int &value) { value *= 2; });
+    int sum = 0;
+    std::for_each(list->cbegin(), list->cend(),
+                  [&sum](const int &value) { sum += value; });
+    EXPECT_EQ(sum, 20);
+}
+
+// Test reverse traversal
+TEST_F(DoublyLinkedListTest, TestReverseIterators) {
+    for (int i = 0; i < 4; ++i) {
+        list->push_back(i);
+    }
+    int expected = 3;
+    for (auto it = list->rbegin(); it != list->rend(); ++it) {
+        EXPECT_EQ(*it, expected--);
+    }
+    EXPECT_EQ(expected, -1);
+
+    const auto &view = *list;
+    EXPECT_EQ(*view.rbegin(), 3);
+    EXPECT_EQ(*std::prev(view.rend()), 0);
+    EXPECT_EQ(std::distance(list->crbegin(), list->crend()), 4);
+}
+
+// Test converting and comparing iterators with const iterators
+TEST_F(DoublyLinkedListTest, TestIteratorToConstIterator) {
+    list->push_back(1);
+    list->push_back(2);
+    DoublyLinkedList<int>::const_iterator it = list->begin();
+    EXPECT_EQ(*it, 1);
+    EXPECT_TRUE(list->begin() == it);
+    EXPECT_TRUE(it == list->begin());
+    EXPECT_TRUE(list->end() != it);
+}
+
+// Test member access through the iterator
+TEST(DoublyLinkedListIteratorTest, TestArrowOperator) {
+    DoublyLinkedList<std::pair<int, int>> pairs;
+    pairs.push_back({1, 2});
+    EXPECT_EQ(pairs.begin()->second, 2);
+    pairs.begin()->first = 5;
+    EXPECT_EQ(pairs.cbegin()->first, 5);
+}
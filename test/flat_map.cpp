@@ -0,0 +1,173 @@
+#include "../include/flat_map.hpp"
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../include/hours.hpp"
+
+TEST(FlatMapTest, InsertFindErase) {
+    FlatMap<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.insert_or_assign(5, "cinco"));
+    EXPECT_TRUE(map.insert_or_assign(1, "um"));
+    EXPECT_TRUE(map.insert_or_assign(3, "tres"));
+    EXPECT_FALSE(map.insert_or_assign(3, "TRES"));
+    EXPECT_EQ(map.size(), 3u);
+    ASSERT_NE(map.find(3), nullptr);
+    EXPECT_EQ(*map.find(3), "TRES");
+    EXPECT_EQ(map.find(2), nullptr);
+    EXPECT_FALSE(map.contains(6));
+    EXPECT_EQ(map[0].first(), 1);
+    EXPECT_EQ(map[2].second(), "cinco");
+    EXPECT_THROW(map[3], std::out_of_range);
+
+    EXPECT_EQ(map.lower_bound(0), 0u);
+    EXPECT_EQ(map.lower_bound(3), 1u);
+    EXPECT_EQ(map.lower_bound(4), 2u);
+    EXPECT_EQ(map.lower_bound(9), 3u);
+
+    *map.find(1) = "UM";
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map[0].second(), "TRES");
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(3), nullptr);
+}
+
+TEST(FlatMapTest, RangeScan) {
+    FlatMap<Hours, int> map;
+    for (int hour = 0; hour < 24; hour++) {
+        map.insert_or_assign(Hours(hour, 0, 0), hour);
+    }
+    int total = 0;
+    auto count = map.range(Hours(8, 30, 0), Hours(12, 0, 0),
+                           [&](const Hours& time, int value) {
+                               EXPECT_EQ(time.get_hours(), value);
+                               total += value;
+                           });
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(total, 9 + 10 + 11);
+    EXPECT_EQ(map.range(Hours(23, 0, 1), Hours(23, 59, 59),
+                        [](const Hours&, int) {}),
+              0u);
+}
+
+TEST(FlatMapTest, BatchKeepsLastValue) {
+    FlatMap<int, int> map;
+    map.insert_or_assign(10, 0);
+    map.insert_or_assign(20, 0);
+    VectorList<Pair<int, int>> updates(6);
+    updates.push_back(Pair<int, int>(30, 1));
+    updates.push_back(Pair<int, int>(10, 2));
+    updates.push_back(Pair<int, int>(5, 3));
+    updates.push_back(Pair<int, int>(30, 4));
+    updates.push_back(Pair<int, int>(10, 5));
+    updates.push_back(Pair<int, int>(15, 6));
+    EXPECT_EQ(map.insert_or_assign_batch(updates), 3u);
+    ASSERT_EQ(map.size(), 5u);
+    int expected[][2] = {{5, 3}, {10, 5}, {15, 6}, {20, 0}, {30, 4}};
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(map[i].first(), expected[i][0]);
+        EXPECT_EQ(map[i].second(), expected[i][1]);
+    }
+
+    FlatMap<int, int> built(updates);
+    EXPECT_EQ(built.size(), 4u);
+    EXPECT_EQ(*built.find(30), 4);
+}
+
+TEST(FlatMapTest, MatchesStdMap) {
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> key(0, 5000);
+    FlatMap<int, int> map;
+    std::map<int, int> reference;
+    for (int round = 0; round < 50; round++) {
+        VectorList<Pair<int, int>> updates(200);
+        for (int i = 0; i < 200; i++) {
+            auto k = key(rng);
+            updates.push_back(Pair<int, int>(k, round * 1000 + i));
+        }
+        size_t added = 0;
+        for (size_t i = 0; i < updates.size(); i++) {
+            added += reference.count(updates[i].first()) == 0;
+            reference[updates[i].first()] = updates[i].second();
+        }
+        if (round % 2 == 0) {
+            EXPECT_EQ(map.insert_or_assign_batch(updates), added);
+        } else {
+            for (size_t i = 0; i < updates.size(); i++) {
+                map.insert_or_assign(updates[i].first(), updates[i].second());
+            }
+        }
+        for (int i = 0; i < 20; i++) {
+            auto k = key(rng);
+            EXPECT_EQ(map.erase(k), reference.erase(k) == 1);
+        }
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    size_t i = 0;
+    for (const auto& [k, v] : reference) {
+        ASSERT_EQ(map[i].first(), k);
+        ASSERT_EQ(map[i].second(), v);
+        i++;
+    }
+    for (int k = -1; k <= 5001; k++) {
+        auto it = reference.lower_bound(k);
+        ASSERT_EQ(map.lower_bound(k),
+                  static_cast<size_t>(std::distance(reference.begin(), it)));
+        ASSERT_EQ(map.contains(k), reference.count(k) == 1);
+    }
+}
+
+TEST(FlatMapTest, CopyAndMove) {
+    FlatMap<int, int> map;
+    for (int i = 0; i < 100; i++) {
+        map.insert_or_assign(i * 7 % 100, i);
+    }
+    FlatMap<int, int> copy = map;
+    copy.erase(0);
+    EXPECT_EQ(map.size(), 100u);
+    EXPECT_EQ(copy.size(), 99u);
+    FlatMap<int, int> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), 99u);
+    EXPECT_TRUE(copy.empty());
+    map = moved;
+    EXPECT_FALSE(map.contains(0));
+    FlatMap<int, int> assigned;
+    assigned.insert_or_assign(-1, -1);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 99u);
+    EXPECT_FALSE(assigned.contains(-1));
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.find(1), nullptr);
+    int last = -1;
+    map.for_each([&](int k, int) {
+        EXPECT_LT(last, k);
+        last = k;
+    });
+}
+
+TEST(FlatMapTest, InsertOwnValue) {
+    // O valor vem do próprio mapa, tanto quando o mapa cresce quanto quando
+    // o deslocamento passa por cima da posição de onde ele veio.
+    FlatMap<int, std::string> map;
+    map.reserve(8);
+    for (int i = 0; i < 8; i++) {
+        map.insert_or_assign(2 * i + 2, "valor " + std::to_string(i));
+    }
+    ASSERT_EQ(map.size(), map.capacity());
+    map.insert_or_assign(1, map[7].second());
+    EXPECT_EQ(*map.find(1), "valor 7");
+    EXPECT_EQ(*map.find(16), "valor 7");
+
+    map.reserve(100);
+    map.insert_or_assign(0, map[0].second());
+    EXPECT_EQ(*map.find(0), "valor 7");
+    EXPECT_EQ(*map.find(1), "valor 7");
+}
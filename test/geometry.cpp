@@ -0,0 +1,144 @@
+#include "../include/geometry.hpp"
+#include <gtest/gtest.h>
+
+#include <math.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class GeometryTest : public ::testing::TestWithParam<unsigned> {
+  protected:
+    void SetUp() override {
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<double> coordinate(-1000, 1000);
+        for (int i = 0; i < 100000; i++) {
+            Point point(coordinate(rng), coordinate(rng));
+            list.push_back(point);
+            cloud.push_back(point);
+        }
+    }
+
+    VectorList<Point> list{100000};
+    PointCloud cloud;
+};
+
+double cross(const Point &o, const Point &a, const Point &b) {
+    return (a.get_x() - o.get_x()) * (b.get_y() - o.get_y()) -
+           (a.get_y() - o.get_y()) * (b.get_x() - o.get_x());
+}
+
+// Um fecho válido é estritamente convexo, anti-horário, e deixa todos os
+// pontos à esquerda (ou sobre) cada aresta.
+void expect_hull(const VectorList<Point> &hull,
+                 const VectorList<Point> &points) {
+    ASSERT_GE(hull.size(), 3u);
+    auto n = hull.size();
+    for (size_t i = 0; i < n; i++) {
+        const auto &a = hull[i];
+        const auto &b = hull[(i + 1) % n];
+        EXPECT_GT(cross(a, b, hull[(i + 2) % n]), 0);
+        for (size_t j = 0; j < points.size(); j += 37) {
+            ASSERT_GE(cross(a, b, points[j]), 0);
+        }
+    }
+    for (size_t i = 1; i < n; i++) {
+        EXPECT_TRUE(hull[0].get_x() < hull[i].get_x() ||
+                    (hull[0].get_x() == hull[i].get_x() &&
+                     hull[0].get_y() < hull[i].get_y()));
+    }
+}
+
+TEST_P(GeometryTest, BoundingBox) {
+    double min_x = INFINITY, min_y = INFINITY;
+    double max_x = -INFINITY, max_y = -INFINITY;
+    for (size_t i = 0; i < list.size(); i++) {
+        min_x = fmin(min_x, list[i].get_x());
+        min_y = fmin(min_y, list[i].get_y());
+        max_x = fmax(max_x, list[i].get_x());
+        max_y = fmax(max_y, list[i].get_y());
+    }
+    for (auto box : {bounding_box(list, GetParam()),
+                     bounding_box(cloud, GetParam())}) {
+        EXPECT_EQ(box.min_x, min_x);
+        EXPECT_EQ(box.min_y, min_y);
+        EXPECT_EQ(box.max_x, max_x);
+        EXPECT_EQ(box.max_y, max_y);
+    }
+}
+
+TEST_P(GeometryTest, ConvexHull) {
+    auto hull = convex_hull(list, GetParam());
+    expect_hull(hull, list);
+    auto from_cloud = convex_hull(cloud, GetParam());
+    ASSERT_EQ(from_cloud.size(), hull.size());
+    for (size_t i = 0; i < hull.size(); i++) {
+        EXPECT_TRUE(from_cloud[i].is_equal(hull[i]));
+    }
+}
+
+TEST_P(GeometryTest, ClosestPair) {
+    // Compara com a força bruta em um subconjunto.
+    VectorList<Point> small(3000);
+    for (size_t i = 0; i < 3000; i++) {
+        small.push_back(list[i]);
+    }
+    double best = INFINITY;
+    for (size_t i = 0; i < small.size(); i++) {
+        for (size_t j = i + 1; j < small.size(); j++) {
+            best = fmin(best, small[i].distance(small[j]));
+        }
+    }
+    auto pair = closest_pair(small, GetParam());
+    EXPECT_LT(pair.first, pair.second);
+    EXPECT_DOUBLE_EQ(pair.distance, best);
+    EXPECT_DOUBLE_EQ(small[pair.first].distance(small[pair.second]), best);
+
+    auto all = closest_pair(list, GetParam());
+    auto all_cloud = closest_pair(cloud, GetParam());
+    EXPECT_EQ(all.distance, all_cloud.distance);
+    EXPECT_DOUBLE_EQ(list[all.first].distance(list[all.second]),
+                     all.distance);
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, GeometryTest, ::testing::Values(1u, 4u));
+
+TEST(Geometry, SmallAndDegenerateInputs) {
+    VectorList<Point> empty(1);
+    EXPECT_THROW(bounding_box(empty), std::out_of_range);
+    EXPECT_THROW(bounding_box(PointCloud()), std::out_of_range);
+    EXPECT_EQ(convex_hull(empty).size(), 0u);
+    EXPECT_THROW(closest_pair(empty), std::invalid_argument);
+
+    VectorList<Point> line(10);
+    for (int i = 0; i < 5; i++) {
+        line.push_back(Point(i, 2 * i));
+        line.push_back(Point(i, 2 * i));
+    }
+    auto hull = convex_hull(line);
+    ASSERT_EQ(hull.size(), 2u);
+    EXPECT_TRUE(hull[0].is_equal(Point(0, 0)));
+    EXPECT_TRUE(hull[1].is_equal(Point(4, 8)));
+    auto pair = closest_pair(line);
+    EXPECT_EQ(pair.distance, 0);
+    EXPECT_TRUE(line[pair.first].is_equal(line[pair.second]));
+
+    VectorList<Point> square(6);
+    square.push_back(Point(1, 1));
+    square.push_back(Point(0, 0));
+    square.push_back(Point(2, 0));
+    square.push_back(Point(2, 2));
+    square.push_back(Point(0, 2));
+    square.push_back(Point(1, 0));
+    hull = convex_hull(square);
+    ASSERT_EQ(hull.size(), 4u);
+    EXPECT_TRUE(hull[0].is_equal(Point(0, 0)));
+    EXPECT_TRUE(hull[1].is_equal(Point(2, 0)));
+    EXPECT_TRUE(hull[2].is_equal(Point(2, 2)));
+    EXPECT_TRUE(hull[3].is_equal(Point(0, 2)));
+    auto box = bounding_box(square);
+    EXPECT_EQ(box.min_x, 0);
+    EXPECT_EQ(box.max_y, 2);
+    pair = closest_pair(square);
+    EXPECT_EQ(pair.distance, 1);
+}
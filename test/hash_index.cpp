@@ -0,0 +1,82 @@
+#include "../include/hash_index.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+
+class HashIndexTest : public ::testing::Test {
+  protected:
+    HashIndex<int, int> index;
+};
+
+TEST_F(HashIndexTest, InitiallyEmpty) {
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_EQ(index.find(1), nullptr);
+    EXPECT_FALSE(index.erase(1));
+}
+
+TEST_F(HashIndexTest, InsertAndFind) {
+    index.insert(1, 10);
+    index.insert(2, 20);
+    EXPECT_EQ(index.size(), 2);
+    ASSERT_NE(index.find(1), nullptr);
+    EXPECT_EQ(*index.find(1), 10);
+    EXPECT_EQ(*index.find(2), 20);
+    EXPECT_FALSE(index.contains(3));
+}
+
+TEST_F(HashIndexTest, InsertReplacesValue) {
+    index.insert(1, 10);
+    index.insert(1, 11);
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_EQ(*index.find(1), 11);
+}
+
+TEST_F(HashIndexTest, GrowsAndErases) {
+    for (int i = 0; i < 10000; i++) {
+        index.insert(i * 7, i);
+    }
+    EXPECT_EQ(index.size(), 10000);
+    for (int i = 0; i < 10000; i += 2) {
+        EXPECT_TRUE(index.erase(i * 7));
+    }
+    EXPECT_EQ(index.size(), 5000);
+    for (int i = 0; i < 10000; i++) {
+        if (i % 2 == 0) {
+            EXPECT_FALSE(index.contains(i * 7));
+        } else {
+            ASSERT_NE(index.find(i * 7), nullptr);
+            EXPECT_EQ(*index.find(i * 7), i);
+        }
+    }
+}
+
+TEST_F(HashIndexTest, CopyAndClear) {
+    index.insert(1, 10);
+    HashIndex<int, int> copy(index);
+    index.clear();
+    EXPECT_TRUE(index.empty());
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_EQ(*copy.find(1), 10);
+}
+
+TEST(HashIndexStringTest, StringKeys) {
+    HashIndex<std::string, int> names;
+    names.insert("ana", 1);
+    names.insert("bia", 2);
+    EXPECT_EQ(*names.find("bia"), 2);
+    EXPECT_TRUE(names.erase("ana"));
+    EXPECT_FALSE(names.contains("ana"));
+}
+
+TEST(HashIndexStringTest, InsertOwnValueWhileGrowing) {
+    HashIndex<std::string, std::string> index;
+    index.insert("0", std::string(40, 'v'));
+    for (int i = 1; i < 200; i++) {
+        auto previous = index.find(std::to_string(i - 1));
+        ASSERT_NE(previous, nullptr);
+        index.insert(std::to_string(i), *previous);
+    }
+    EXPECT_EQ(index.size(), 200u);
+    EXPECT_EQ(*index.find("199"), std::string(40, 'v'));
+}
@@ -0,0 +1,208 @@
+#include "../include/hash_map.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class HashMapTest : public ::testing::Test {
+  protected:
+    HashMap<int, int> map;
+};
+
+TEST_F(HashMapTest, InitiallyEmpty) {
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0u);
+    EXPECT_EQ(map.bucket_count(), 0u);
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_EQ(map.load_factor(), 0);
+}
+
+TEST_F(HashMapTest, InsertFindReplace) {
+    EXPECT_TRUE(map.insert(1, 10));
+    EXPECT_TRUE(map.insert(2, 20));
+    EXPECT_FALSE(map.insert(1, 11));
+    EXPECT_EQ(map.size(), 2u);
+    ASSERT_NE(map.find(1), nullptr);
+    EXPECT_EQ(*map.find(1), 11);
+    *map.find(2) += 1;
+    EXPECT_EQ(*map.find(2), 21);
+    EXPECT_FALSE(map.contains(3));
+}
+
+TEST_F(HashMapTest, MatchesUnorderedMap) {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> key(0, 20000);
+    std::unordered_map<int, int> reference;
+    for (int i = 0; i < 200000; i++) {
+        auto k = key(rng);
+        if (i % 3 == 0) {
+            EXPECT_EQ(map.erase(k), reference.erase(k) == 1);
+        } else {
+            EXPECT_EQ(map.insert(k, i), reference.count(k) == 0);
+            reference[k] = i;
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    EXPECT_LE(map.load_factor(), map.max_load_factor());
+    for (int k = 0; k <= 20000; k++) {
+        auto found = reference.find(k);
+        if (found == reference.end()) {
+            ASSERT_EQ(map.find(k), nullptr);
+        } else {
+            ASSERT_NE(map.find(k), nullptr);
+            ASSERT_EQ(*map.find(k), found->second);
+        }
+    }
+    size_t visited = 0;
+    map.for_each([&](int k, int v) {
+        EXPECT_EQ(reference.at(k), v);
+        visited++;
+    });
+    EXPECT_EQ(visited, reference.size());
+}
+
+TEST_F(HashMapTest, ReserveAndLoadFactor) {
+    map.reserve(1000);
+    auto buckets = map.bucket_count();
+    EXPECT_GE(buckets * map.max_load_factor(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        map.insert(i, i);
+    }
+    EXPECT_EQ(map.bucket_count(), buckets);
+
+    map.max_load_factor(0.25);
+    EXPECT_LE(map.load_factor(), 0.25);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(*map.find(i), i);
+    }
+    EXPECT_THROW(map.max_load_factor(1), std::invalid_argument);
+    EXPECT_THROW(map.max_load_factor(0), std::invalid_argument);
+    EXPECT_THROW((HashMap<int, int>(0, 1.5)), std::invalid_argument);
+
+    HashMap<int, int> dense(0, 0.99);
+    for (int i = 0; i < 5000; i++) {
+        dense.insert(i * 64, i);
+    }
+    for (int i = 0; i < 5000; i++) {
+        ASSERT_EQ(*dense.find(i * 64), i);
+    }
+}
+
+// Todas as chaves no mesmo lugar: as distâncias passam de um byte e a
+// tabela precisa crescer.
+struct Collide {
+    size_t operator()(int) const { return 0; }
+};
+
+TEST(HashMapCollisionTest, LongProbeSequences) {
+    HashMap<int, int, Collide> map;
+    for (int i = 0; i < 600; i++) {
+        map.insert(i, -i);
+    }
+    for (int i = 0; i < 600; i += 2) {
+        EXPECT_TRUE(map.erase(i));
+    }
+    for (int i = 0; i < 600; i++) {
+        if (i % 2 == 0) {
+            EXPECT_FALSE(map.contains(i));
+        } else {
+            ASSERT_EQ(*map.find(i), -i);
+        }
+    }
+}
+
+// Grupos de 300 chaves no mesmo lugar: sequências saturadas se misturam
+// com inserções e remoções.
+struct Clustered {
+    size_t operator()(int key) const { return key / 300; }
+};
+
+TEST(HashMapCollisionTest, SaturatedSequencesSurviveErase) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> key(0, 6000);
+    HashMap<int, int, Clustered> map;
+    std::unordered_map<int, int> reference;
+    for (int i = 0; i < 30000; i++) {
+        auto k = key(rng);
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(map.erase(k), reference.erase(k) == 1);
+        } else {
+            ASSERT_EQ(map.insert(k, i), reference.count(k) == 0);
+            reference[k] = i;
+        }
+    }
+    for (const auto& [k, v] : reference) {
+        ASSERT_NE(map.find(k), nullptr);
+        ASSERT_EQ(*map.find(k), v);
+    }
+}
+
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view text) const {
+        return std::hash<std::string_view>()(text);
+    }
+};
+
+TEST(HashMapStringTest, HeterogeneousLookup) {
+    HashMap<std::string, int, StringHash, std::equal_to<>> map;
+    map.insert("um", 1);
+    map.insert("dois", 2);
+    std::string_view key = "dois";
+    ASSERT_NE(map.find(key), nullptr);
+    EXPECT_EQ(*map.find(key), 2);
+    EXPECT_TRUE(map.contains("um"));
+    EXPECT_FALSE(map.contains(std::string_view("tres")));
+    EXPECT_TRUE(map.erase(std::string_view("um")));
+    EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(HashMapStringTest, CopyMoveClear) {
+    HashMap<std::string, std::string> map;
+    for (int i = 0; i < 100; i++) {
+        map.insert(std::to_string(i), std::string(i, 'x'));
+    }
+    HashMap<std::string, std::string> copy = map;
+    copy.erase("5");
+    EXPECT_EQ(map.size(), 100u);
+    EXPECT_EQ(copy.size(), 99u);
+    HashMap<std::string, std::string> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), 99u);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.find("1"), nullptr);
+    map = moved;
+    EXPECT_FALSE(map.contains("5"));
+    HashMap<std::string, std::string> assigned;
+    assigned.insert("antigo", "z");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 99u);
+    EXPECT_FALSE(assigned.contains("antigo"));
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.find("1"), nullptr);
+    moved.insert("1", "w");
+    EXPECT_EQ(*moved.find("1"), "w");
+    EXPECT_EQ(*map.find("7"), "xxxxxxx");
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains("7"));
+    map.insert("7", "y");
+    EXPECT_EQ(*map.find("7"), "y");
+}
+
+TEST(HashMapStringTest, InsertOwnValueWhileGrowing) {
+    // Cada inserção copia um valor da própria tabela, inclusive nas que
+    // fazem a tabela crescer.
+    HashMap<std::string, std::string> map;
+    map.insert("0", std::string(40, 'v'));
+    for (int i = 1; i < 300; i++) {
+        auto previous = map.find(std::to_string(i - 1));
+        ASSERT_NE(previous, nullptr);
+        EXPECT_TRUE(map.insert(std::to_string(i), *previous));
+    }
+    EXPECT_EQ(map.size(), 300u);
+    EXPECT_EQ(*map.find("299"), std::string(40, 'v'));
+}
@@ -0,0 +1,119 @@
+#include "../include/hours.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+
+// As operações básicas podem ser avaliadas em tempo de compilação.
+static_assert(Hours(1, 30, 0).to_seconds() == 5400);
+static_assert(Hours(0, 90, 75).get_minutes() == 31);
+static_assert(Hours(1, 0, 0) + Hours(0, 30, 0) == Hours(1, 30, 0));
+static_assert(Hours(2, 0, 0) > Hours(1, 59, 59));
+
+constexpr Hours parse(const char *text, size_t length) {
+    Hours time;
+    Hours::from_chars(text, text + length, time);
+    return time;
+}
+static_assert(parse("01:02:03", 8) == Hours(1, 2, 3));
+
+TEST(HoursTest, DefaultIsZero) {
+    Hours time;
+    EXPECT_EQ(time.to_seconds(), 0);
+    EXPECT_EQ(time.to_string(), "00:00:00");
+}
+
+TEST(HoursTest, Normalizes) {
+    Hours time(1, 75, 130);
+    EXPECT_EQ(time.get_hours(), 2);
+    EXPECT_EQ(time.get_minutes(), 17);
+    EXPECT_EQ(time.get_seconds(), 10);
+
+    time.set_time(0, 0, 3661);
+    EXPECT_EQ(time, Hours(1, 1, 1));
+}
+
+TEST(HoursTest, Conversions) {
+    Hours time(1, 30, 0);
+    EXPECT_EQ(time.to_seconds(), 5400);
+    EXPECT_DOUBLE_EQ(time.to_minutes(), 90.0);
+    EXPECT_DOUBLE_EQ(time.to_hours(), 1.5);
+    EXPECT_EQ(Hours::from_seconds(5400), time);
+}
+
+TEST(HoursTest, Comparisons) {
+    Hours a(8, 30, 0);
+    Hours b(17, 15, 30);
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(a <= b);
+    EXPECT_TRUE(b > a);
+    EXPECT_TRUE(b >= a);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a == Hours(8, 30, 0));
+}
+
+TEST(HoursTest, Arithmetic) {
+    Hours start(8, 30, 0);
+    Hours end(17, 15, 30);
+    EXPECT_EQ((end - start).to_string(), "08:45:30");
+    EXPECT_EQ((start + end).to_string(), "25:45:30");
+    EXPECT_EQ((start - end).to_string(), "-08:45:30");
+}
+
+TEST(HoursTest, ToChars) {
+    char buffer[Hours::max_chars];
+    auto result = Hours(123, 4, 5).to_chars(buffer, buffer + sizeof buffer);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), "123:04:05");
+
+    auto small = Hours(1, 0, 0).to_chars(buffer, buffer + 7);
+    EXPECT_EQ(small.ec, std::errc::value_too_large);
+
+    auto largest = Hours::from_seconds(-2147483647 - 1)
+                       .to_chars(buffer, buffer + sizeof buffer);
+    EXPECT_EQ(largest.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, largest.ptr), "-596523:14:08");
+}
+
+TEST(HoursTest, FromChars) {
+    Hours time;
+    std::string text = "08:45:30 resto";
+    auto result = Hours::from_chars(text.data(), text.data() + text.size(),
+                                    time);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(result.ptr, text.data() + 8);
+    EXPECT_EQ(time, Hours(8, 45, 30));
+
+    text = "-1:00:01";
+    result = Hours::from_chars(text.data(), text.data() + text.size(), time);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(time.to_seconds(), -3601);
+}
+
+TEST(HoursTest, FromCharsRejectsMalformed) {
+    Hours time(1, 2, 3);
+    for (std::string text :
+         {"", ":00:00", "12:60:00", "12:00:6", "12-00-00", "12:00", "ab"}) {
+        auto result =
+            Hours::from_chars(text.data(), text.data() + text.size(), time);
+        EXPECT_EQ(result.ec, std::errc::invalid_argument) << text;
+        EXPECT_EQ(result.ptr, text.data()) << text;
+    }
+    std::string huge = "99999999999:00:00";
+    auto result =
+        Hours::from_chars(huge.data(), huge.data() + huge.size(), time);
+    EXPECT_EQ(result.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(time, Hours(1, 2, 3));
+}
+
+TEST(HoursTest, RoundTrip) {
+    for (int seconds = -100000; seconds <= 400000; seconds += 997) {
+        auto time = Hours::from_seconds(seconds);
+        char buffer[Hours::max_chars];
+        auto written = time.to_chars(buffer, buffer + sizeof buffer);
+        Hours parsed;
+        auto read = Hours::from_chars(buffer, written.ptr, parsed);
+        EXPECT_EQ(read.ec, std::errc());
+        EXPECT_EQ(read.ptr, written.ptr);
+        EXPECT_EQ(parsed, time);
+    }
+}
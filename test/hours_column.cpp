@@ -0,0 +1,146 @@
+#include "../include/hours_column.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class HoursColumnTest : public ::testing::TestWithParam<unsigned> {
+  protected:
+    // Blocos próximos no tempo (16 bits), blocos espalhados (32 bits) e um
+    // bloco aberto no final.
+    void SetUp() override {
+        std::mt19937 rng(7);
+        for (size_t i = 0; i < 3 * HoursColumn::block_size; i++) {
+            values.push_back(36000 + static_cast<int>(rng() % 7200));
+        }
+        for (size_t i = 0; i < 2 * HoursColumn::block_size; i++) {
+            values.push_back(static_cast<int>(rng() % (200 * 3600)) - 3600);
+        }
+        for (size_t i = 0; i < HoursColumn::block_size; i++) {
+            values.push_back(7200 + static_cast<int>(i / 4));
+        }
+        for (int i = 0; i < 300; i++) {
+            values.push_back(static_cast<int>(rng() % (24 * 3600)));
+        }
+        column = HoursColumn(values.data(), values.size());
+        column.set_threads(GetParam());
+    }
+
+    void expect_range(int lo, int hi) {
+        size_t count = 0;
+        long long sum = 0;
+        for (auto value : values) {
+            if (value >= lo && value <= hi) {
+                count++;
+                sum += value;
+            }
+        }
+        auto from = Hours::from_seconds(lo);
+        auto to = Hours::from_seconds(hi);
+        EXPECT_EQ(column.count_between(from, to), count) << lo << " " << hi;
+        EXPECT_EQ(column.sum_between(from, to), sum) << lo << " " << hi;
+    }
+
+    std::vector<int> values;
+    HoursColumn column;
+};
+
+TEST_P(HoursColumnTest, StoresValues) {
+    ASSERT_EQ(column.size(), values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(column[i].to_seconds(), values[i]) << i;
+    }
+    EXPECT_THROW(column[values.size()], std::out_of_range);
+}
+
+TEST_P(HoursColumnTest, CompressesCloseValues) {
+    EXPECT_LT(column.memory_usage(), values.size() * sizeof(int));
+}
+
+TEST_P(HoursColumnTest, SumMinMax) {
+    long long sum = 0;
+    int min = values[0];
+    int max = values[0];
+    for (auto value : values) {
+        sum += value;
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+    }
+    EXPECT_EQ(column.sum(), sum);
+    EXPECT_EQ(column.min().to_seconds(), min);
+    EXPECT_EQ(column.max().to_seconds(), max);
+}
+
+TEST_P(HoursColumnTest, RangeFilters) {
+    expect_range(0, 24 * 3600);
+    expect_range(36000, 43199);
+    expect_range(37000, 38000);
+    expect_range(7200, 7300);
+    expect_range(-3600, -1);
+    expect_range(-100000, 1000000);
+    expect_range(500, 400);
+    std::mt19937 rng(11);
+    for (int i = 0; i < 50; i++) {
+        int lo = static_cast<int>(rng() % (100 * 3600)) - 3600;
+        expect_range(lo, lo + static_cast<int>(rng() % (20 * 3600)));
+    }
+}
+
+TEST_P(HoursColumnTest, Histogram) {
+    for (int width : {60, 3600}) {
+        size_t buckets = 24 * 3600 / width;
+        std::vector<size_t> expected(buckets, 0);
+        for (auto value : values) {
+            if (value >= 0 && value / width < static_cast<int>(buckets)) {
+                expected[value / width]++;
+            }
+        }
+        std::vector<size_t> counts(buckets, 99);
+        column.histogram(width, counts.data(), buckets);
+        EXPECT_EQ(counts, expected) << width;
+    }
+    size_t counts[1];
+    EXPECT_THROW(column.histogram(0, counts, 1), std::invalid_argument);
+}
+
+TEST_P(HoursColumnTest, AppendAndCopy) {
+    HoursColumn copy(column);
+    copy.push_back(Hours(1, 0, 0));
+    EXPECT_EQ(copy.size(), column.size() + 1);
+    EXPECT_EQ(copy[column.size()], Hours(1, 0, 0));
+    EXPECT_EQ(copy.sum(), column.sum() + 3600);
+    EXPECT_EQ(copy.threads(), column.threads());
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, HoursColumnTest, ::testing::Values(1u, 4u));
+
+TEST(HoursColumn, EmptyColumn) {
+    HoursColumn column;
+    EXPECT_TRUE(column.empty());
+    EXPECT_EQ(column.sum(), 0);
+    EXPECT_EQ(column.count_between(Hours(), Hours(10, 0, 0)), 0u);
+    EXPECT_THROW(column.min(), std::out_of_range);
+    EXPECT_THROW(column.max(), std::out_of_range);
+    size_t counts[24];
+    column.histogram(3600, counts, 24);
+    for (auto count : counts) {
+        EXPECT_EQ(count, 0u);
+    }
+}
+
+TEST(HoursColumn, FromVectorList) {
+    VectorList<Hours> list(2000);
+    for (int i = 0; i < 2000; i++) {
+        list.push_back(Hours(i % 24, i % 60, 0));
+    }
+    HoursColumn column(list);
+    ASSERT_EQ(column.size(), list.size());
+    for (size_t i = 0; i < list.size(); i++) {
+        EXPECT_EQ(column[i], list[i]);
+    }
+    column.clear();
+    EXPECT_TRUE(column.empty());
+    column.push_back(Hours(2, 0, 0));
+    EXPECT_EQ(column.max(), Hours(2, 0, 0));
+}
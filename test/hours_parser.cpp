@@ -0,0 +1,119 @@
+#include "../include/hours_parser.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class HoursParserTest : public ::testing::TestWithParam<bool> {
+  protected:
+    HoursParseResult parse(const std::string &text, std::vector<int> &out) {
+        out.assign(text.size() / 2 + 8, -1);
+        auto result = parse_hours(
+            text.data(), text.data() + text.size(), out.data(), out.size(),
+            [this](size_t line, const char *first, const char *last) {
+                bad_lines.push_back(line);
+                bad_text.push_back(std::string(first, last));
+            },
+            GetParam());
+        out.resize(result.parsed);
+        return result;
+    }
+
+    std::vector<size_t> bad_lines;
+    std::vector<std::string> bad_text;
+};
+
+TEST_P(HoursParserTest, ParsesFixedWidthLines) {
+    std::string text;
+    std::vector<int> expected;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 1000; i++) {
+        auto time = Hours::from_seconds(rng() % (100 * 3600));
+        char buffer[Hours::max_chars];
+        auto written = time.to_chars(buffer, buffer + sizeof buffer);
+        text.append(buffer, written.ptr);
+        text += '\n';
+        expected.push_back(time.to_seconds());
+    }
+
+    std::vector<int> out;
+    auto result = parse(text, out);
+    EXPECT_EQ(result.lines, 1000);
+    EXPECT_EQ(result.parsed, 1000);
+    EXPECT_EQ(result.malformed, 0);
+    EXPECT_EQ(out, expected);
+}
+
+TEST_P(HoursParserTest, ReportsMalformedLines) {
+    std::string text;
+    for (int i = 0; i < 20; i++) {
+        text += "12:34:56\n";
+    }
+    text += "12:60:00\n";
+    for (int i = 0; i < 20; i++) {
+        text += "00:00:01\n";
+    }
+    text += "1a:00:00\n\n12:00:00 \n";
+
+    std::vector<int> out;
+    auto result = parse(text, out);
+    EXPECT_EQ(result.lines, 44);
+    EXPECT_EQ(result.parsed, 40);
+    EXPECT_EQ(result.malformed, 4);
+    EXPECT_EQ(bad_lines, (std::vector<size_t>{21, 42, 43, 44}));
+    EXPECT_EQ(bad_text[0], "12:60:00");
+    EXPECT_EQ(bad_text[2], "");
+    EXPECT_EQ(out.front(), Hours(12, 34, 56).to_seconds());
+    EXPECT_EQ(out.back(), 1);
+}
+
+TEST_P(HoursParserTest, AcceptsVariableWidthAndCrLf) {
+    std::string text = "8:00:00\r\n123:45:06\n-01:00:00\n07:08:09";
+    std::vector<int> out;
+    auto result = parse(text, out);
+    EXPECT_EQ(result.malformed, 0);
+    EXPECT_EQ(out, (std::vector<int>{Hours(8, 0, 0).to_seconds(),
+                                     Hours(123, 45, 6).to_seconds(), -3600,
+                                     Hours(7, 8, 9).to_seconds()}));
+}
+
+TEST_P(HoursParserTest, FillsVectorList) {
+    std::string text;
+    for (int i = 0; i < 30; i++) {
+        text += "00:01:0" + std::to_string(i % 10) + "\n";
+    }
+    VectorList<Hours> list(30);
+    auto result = parse_hours(text.data(), text.data() + text.size(), list,
+                              nullptr, GetParam());
+    EXPECT_EQ(result.parsed, 30);
+    ASSERT_EQ(list.size(), 30);
+    EXPECT_EQ(list[13], Hours(0, 1, 3));
+
+    VectorList<Hours> small(10);
+    EXPECT_THROW(parse_hours(text.data(), text.data() + text.size(), small,
+                             nullptr, GetParam()),
+                 std::length_error);
+}
+
+TEST_P(HoursParserTest, ThrowsWhenArrayIsFull) {
+    std::string text;
+    for (int i = 0; i < 16; i++) {
+        text += "10:00:00\n";
+    }
+    int out[12];
+    EXPECT_THROW(parse_hours(text.data(), text.data() + text.size(), out, 12,
+                             nullptr, GetParam()),
+                 std::length_error);
+}
+
+TEST_P(HoursParserTest, EmptyInput) {
+    std::vector<int> out;
+    auto result = parse("", out);
+    EXPECT_EQ(result.lines, 0);
+    EXPECT_EQ(result.parsed, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdAndScalar, HoursParserTest,
+                         ::testing::Values(true, false));
@@ -0,0 +1,185 @@
+#include "../include/indexed_sequence.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class IndexedSequenceTest : public ::testing::Test {
+  protected:
+    void SetUp() override { seq = new IndexedSequence<int, 4>(); }
+
+    void TearDown() override { delete seq; }
+
+    void expect_equal(const IndexedSequence<int, 4> &actual,
+                      const std::vector<int> &expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(actual[i], expected[i]);
+        }
+    }
+
+    IndexedSequence<int, 4> *seq;
+};
+
+// Test the initial state
+TEST_F(IndexedSequenceTest, InitialState) {
+    EXPECT_EQ(seq->size(), 0);
+    EXPECT_TRUE(seq->empty());
+}
+
+// Test pushing at both ends across several blocks
+TEST_F(IndexedSequenceTest, PushFrontAndBack) {
+    std::vector<int> expected;
+    for (int i = 0; i < 20; i++) {
+        seq->push_back(i);
+        expected.push_back(i);
+        seq->push_front(-i);
+        expected.insert(expected.begin(), -i);
+    }
+    expect_equal(*seq, expected);
+}
+
+// Test inserting in the middle, splitting full blocks
+TEST_F(IndexedSequenceTest, InsertInMiddle) {
+    for (int i = 0; i < 8; i++) {
+        seq->push_back(i * 10);
+    }
+    seq->insert(4, 35);
+    seq->insert(1, 5);
+    expect_equal(*seq, {0, 5, 10, 20, 30, 35, 40, 50, 60, 70});
+}
+
+// Test removing elements, including emptying whole blocks
+TEST_F(IndexedSequenceTest, Remove) {
+    for (int i = 0; i < 10; i++) {
+        seq->push_back(i);
+    }
+    seq->remove(0);
+    seq->remove(4);
+    seq->pop_back();
+    seq->pop_front();
+    expect_equal(*seq, {2, 3, 4, 6, 7, 8});
+
+    while (!seq->empty()) {
+        seq->remove(seq->size() / 2);
+    }
+    EXPECT_EQ(seq->size(), 0);
+}
+
+// Test invalid indices
+TEST_F(IndexedSequenceTest, InvalidAccess) {
+    EXPECT_THROW((*seq)[0], std::out_of_range);
+    EXPECT_THROW(seq->insert(1, 0), std::out_of_range);
+    EXPECT_THROW(seq->remove(0), std::out_of_range);
+    EXPECT_THROW(seq->pop_back(), std::out_of_range);
+    EXPECT_THROW(seq->split(1), std::out_of_range);
+}
+
+// Test find and contains
+TEST_F(IndexedSequenceTest, FindAndContains) {
+    for (int i = 0; i < 10; i++) {
+        seq->push_back(i);
+    }
+    EXPECT_TRUE(seq->contains(7));
+    EXPECT_FALSE(seq->contains(10));
+    seq->find(7) = 70;
+    EXPECT_EQ((*seq)[7], 70);
+    EXPECT_THROW(seq->find(100), std::out_of_range);
+}
+
+// Test splitting inside a block and concatenating back
+TEST_F(IndexedSequenceTest, SplitAndConcat) {
+    std::vector<int> expected;
+    for (int i = 0; i < 15; i++) {
+        seq->push_back(i);
+        expected.push_back(i);
+    }
+    auto tail = seq->split(6);
+    expect_equal(*seq, {0, 1, 2, 3, 4, 5});
+    expect_equal(tail, {6, 7, 8, 9, 10, 11, 12, 13, 14});
+
+    tail.push_front(100);
+    seq->concat(tail);
+    EXPECT_TRUE(tail.empty());
+    expected.insert(expected.begin() + 6, 100);
+    expect_equal(*seq, expected);
+
+    auto all = seq->split(0);
+    EXPECT_TRUE(seq->empty());
+    EXPECT_EQ(all.size(), expected.size());
+    auto none = all.split(all.size());
+    EXPECT_TRUE(none.empty());
+}
+
+// Test copying and assignment
+TEST_F(IndexedSequenceTest, CopyAndAssign) {
+    for (int i = 0; i < 10; i++) {
+        seq->push_back(i);
+    }
+    IndexedSequence<int, 4> copy(*seq);
+    copy[0] = 100;
+    EXPECT_EQ((*seq)[0], 0);
+
+    IndexedSequence<int, 4> assigned;
+    assigned.push_back(1);
+    assigned = copy;
+    EXPECT_EQ(assigned.size(), 10);
+    EXPECT_EQ(assigned[0], 100);
+
+    IndexedSequence<int, 4> moved;
+    moved.push_back(7);
+    moved = std::move(assigned);
+    EXPECT_EQ(moved.size(), 10);
+    EXPECT_EQ(moved[0], 100);
+    EXPECT_TRUE(assigned.empty());
+}
+
+// Test inserting elements of the sequence into itself
+TEST_F(IndexedSequenceTest, InsertOwnElement) {
+    for (int i = 1; i <= 3; i++) {
+        seq->push_back(i);
+    }
+    seq->insert(0, (*seq)[1]);
+    expect_equal(*seq, {2, 1, 2, 3});
+
+    // O bloco está cheio e é dividido; o valor vem da metade superior.
+    seq->insert(1, (*seq)[3]);
+    expect_equal(*seq, {2, 3, 1, 2, 3});
+
+    seq->insert(3, (*seq)[2]);
+    expect_equal(*seq, {2, 3, 1, 1, 2, 3});
+
+    IndexedSequence<std::string, 4> words;
+    for (int i = 0; i < 4; i++) {
+        words.push_back("palavra " + std::to_string(i));
+    }
+    words.insert(0, words[3]);
+    EXPECT_EQ(words[0], "palavra 3");
+    EXPECT_EQ(words[4], "palavra 3");
+    EXPECT_EQ(words.size(), 5);
+}
+
+// Test random operations against std::vector
+TEST_F(IndexedSequenceTest, RandomOperations) {
+    std::mt19937 rng(42);
+    std::vector<int> expected;
+    for (int step = 0; step < 5000; step++) {
+        auto op = rng() % 10;
+        if (op < 6 || expected.empty()) {
+            size_t index = rng() % (expected.size() + 1);
+            seq->insert(index, step);
+            expected.insert(expected.begin() + index, step);
+        } else if (op < 9) {
+            size_t index = rng() % expected.size();
+            seq->remove(index);
+            expected.erase(expected.begin() + index);
+        } else {
+            size_t index = rng() % (expected.size() + 1);
+            auto tail = seq->split(index);
+            seq->concat(tail);
+        }
+    }
+    expect_equal(*seq, expected);
+}
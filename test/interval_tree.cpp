@@ -0,0 +1,179 @@
+#include "../include/interval_tree.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/hours.hpp"
+
+using Interval = std::pair<int, int>;
+
+std::vector<Interval> collect_overlapping(const IntervalTree<int> &tree,
+                                          int start, int end) {
+    std::vector<Interval> found;
+    auto count = tree.overlapping(start, end, [&](int s, int e) {
+        found.push_back({s, e});
+    });
+    EXPECT_EQ(count, found.size());
+    return found;
+}
+
+std::vector<Interval> naive_overlapping(const std::vector<Interval> &all,
+                                        int start, int end) {
+    std::vector<Interval> found;
+    for (const auto &interval : all) {
+        if (interval.first <= end && start <= interval.second) {
+            found.push_back(interval);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+TEST(IntervalTreeTest, Empty) {
+    IntervalTree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(collect_overlapping(tree, 0, 100).empty());
+    EXPECT_FALSE(tree.erase(1, 2));
+    EXPECT_FALSE(tree.contains(1, 2));
+}
+
+TEST(IntervalTreeTest, OverlapIncludesTouchingEnds) {
+    IntervalTree<int> tree;
+    tree.insert(1, 5);
+    tree.insert(6, 10);
+    tree.insert(12, 12);
+    tree.insert(0, 20);
+    EXPECT_EQ(collect_overlapping(tree, 5, 6),
+              (std::vector<Interval>{{0, 20}, {1, 5}, {6, 10}}));
+    EXPECT_EQ(collect_overlapping(tree, 11, 11),
+              (std::vector<Interval>{{0, 20}}));
+    EXPECT_EQ(collect_overlapping(tree, 12, 30),
+              (std::vector<Interval>{{0, 20}, {12, 12}}));
+    EXPECT_EQ(tree.stabbing(12, [](int, int) {}), 2u);
+    EXPECT_EQ(tree.stabbing(21, [](int, int) {}), 0u);
+}
+
+TEST(IntervalTreeTest, RejectsInvalidIntervals) {
+    IntervalTree<int> tree;
+    EXPECT_THROW(tree.insert(5, 4), std::invalid_argument);
+    EXPECT_THROW(tree.overlapping(5, 4, [](int, int) {}),
+                 std::invalid_argument);
+    VectorList<Pair<int, int>> list(1);
+    list.push_back(Pair<int, int>(3, 2));
+    EXPECT_THROW(IntervalTree<int>{list}, std::invalid_argument);
+}
+
+TEST(IntervalTreeTest, DuplicatesAndErase) {
+    IntervalTree<int> tree;
+    tree.insert(1, 3);
+    tree.insert(1, 3);
+    tree.insert(Pair<int, int>(1, 4));
+    EXPECT_EQ(tree.size(), 3u);
+    EXPECT_TRUE(tree.erase(1, 3));
+    EXPECT_TRUE(tree.contains(1, 3));
+    EXPECT_TRUE(tree.erase(1, 3));
+    EXPECT_FALSE(tree.contains(1, 3));
+    EXPECT_FALSE(tree.erase(1, 3));
+    EXPECT_EQ(collect_overlapping(tree, 4, 4),
+              (std::vector<Interval>{{1, 4}}));
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+    tree.insert(2, 2);
+    EXPECT_EQ(tree.size(), 1u);
+}
+
+TEST(IntervalTreeTest, MatchesNaiveScan) {
+    std::mt19937 rng(5);
+    std::vector<Interval> all;
+    IntervalTree<int> tree;
+    for (int step = 0; step < 4000; step++) {
+        if (!all.empty() && rng() % 3 == 0) {
+            auto pos = rng() % all.size();
+            EXPECT_TRUE(tree.erase(all[pos].first, all[pos].second));
+            all.erase(all.begin() + pos);
+        } else {
+            int start = rng() % 10000;
+            int end = start + rng() % 500;
+            tree.insert(start, end);
+            all.push_back({start, end});
+        }
+        if (step % 100 == 0) {
+            int start = rng() % 10000;
+            int end = start + rng() % 1000;
+            EXPECT_EQ(collect_overlapping(tree, start, end),
+                      naive_overlapping(all, start, end));
+        }
+    }
+    EXPECT_EQ(tree.size(), all.size());
+
+    std::vector<Interval> ordered;
+    tree.for_each([&](int s, int e) { ordered.push_back({s, e}); });
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(ordered, all);
+}
+
+TEST(IntervalTreeTest, BulkBuild) {
+    std::mt19937 rng(9);
+    VectorList<Pair<Hours, Hours>> list(5000);
+    std::vector<Interval> all;
+    for (int i = 0; i < 5000; i++) {
+        int start = rng() % (24 * 3600);
+        int end = start + rng() % 7200;
+        list.push_back(Pair<Hours, Hours>(Hours::from_seconds(start),
+                                          Hours::from_seconds(end)));
+        all.push_back({start, end});
+    }
+    IntervalTree<Hours> tree(list);
+    EXPECT_EQ(tree.size(), 5000u);
+
+    for (int query = 0; query < 200; query++) {
+        int start = rng() % (26 * 3600);
+        int end = start + rng() % 3600;
+        std::vector<Interval> found;
+        tree.overlapping(Hours::from_seconds(start), Hours::from_seconds(end),
+                         [&](const Hours &s, const Hours &e) {
+                             found.push_back({s.to_seconds(), e.to_seconds()});
+                         });
+        EXPECT_EQ(found, naive_overlapping(all, start, end));
+    }
+
+    // A árvore montada em lote continua aceitando inserções e remoções.
+    tree.insert(Hours(30, 0, 0), Hours(31, 0, 0));
+    EXPECT_EQ(tree.stabbing(Hours(30, 30, 0), [](const Hours &,
+                                                 const Hours &) {}),
+              1u);
+    EXPECT_TRUE(tree.erase(Hours::from_seconds(all[0].first),
+                           Hours::from_seconds(all[0].second)));
+    EXPECT_EQ(tree.size(), 5000u);
+}
+
+TEST(IntervalTreeTest, CopyAndMove) {
+    IntervalTree<int> tree;
+    for (int i = 0; i < 100; i++) {
+        tree.insert(i, i + 10);
+    }
+    IntervalTree<int> copy(tree);
+    copy.erase(0, 10);
+    EXPECT_EQ(copy.size(), 99u);
+    EXPECT_TRUE(tree.contains(0, 10));
+
+    tree = copy;
+    EXPECT_FALSE(tree.contains(0, 10));
+    IntervalTree<int> moved(std::move(tree));
+    EXPECT_EQ(moved.size(), 99u);
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(collect_overlapping(moved, 200, 300).size(), 0u);
+
+    IntervalTree<int> assigned;
+    assigned.insert(500, 600);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 99u);
+    EXPECT_FALSE(assigned.contains(500, 600));
+    EXPECT_TRUE(moved.empty());
+    moved.insert(1, 2);
+    EXPECT_TRUE(moved.contains(1, 2));
+}
@@ -0,0 +1,132 @@
+#include "../include/kd_tree.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class KdTreeTest : public ::testing::TestWithParam<unsigned> {
+  protected:
+    void SetUp() override {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<double> coordinate(-100, 100);
+        for (int i = 0; i < 5000; i++) {
+            points.push_back(Point(coordinate(rng), coordinate(rng)));
+        }
+        // Pontos repetidos e alinhados também precisam ser encontrados.
+        for (int i = 0; i < 50; i++) {
+            points.push_back(Point(1, i));
+            points.push_back(Point(1, i));
+        }
+    }
+
+    std::vector<double> sorted_distances(const Point &query) const {
+        std::vector<double> distances;
+        for (const auto &point : points) {
+            distances.push_back(point.distance(query));
+        }
+        std::sort(distances.begin(), distances.end());
+        return distances;
+    }
+
+    std::vector<Point> points;
+};
+
+TEST_P(KdTreeTest, Nearest) {
+    KdTree tree(points.data(), points.data() + points.size(), GetParam());
+    EXPECT_EQ(tree.size(), points.size());
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coordinate(-120, 120);
+    for (int i = 0; i < 200; i++) {
+        Point query(coordinate(rng), coordinate(rng));
+        auto found = tree.nearest(query);
+        ASSERT_LT(found, points.size());
+        EXPECT_EQ(points[found].distance(query), sorted_distances(query)[0]);
+    }
+    EXPECT_EQ(tree.nearest(points[1234]), 1234u);
+}
+
+TEST_P(KdTreeTest, KNearest) {
+    KdTree tree(points.data(), points.data() + points.size(), GetParam());
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<double> coordinate(-120, 120);
+    size_t indices[20];
+    for (int i = 0; i < 100; i++) {
+        Point query(coordinate(rng), coordinate(rng));
+        auto expected = sorted_distances(query);
+        ASSERT_EQ(tree.k_nearest(query, 20, indices), 20u);
+        for (size_t j = 0; j < 20; j++) {
+            EXPECT_EQ(points[indices[j]].distance(query), expected[j]);
+        }
+    }
+}
+
+TEST_P(KdTreeTest, WithinRadius) {
+    KdTree tree(points.data(), points.data() + points.size(), GetParam());
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coordinate(-120, 120);
+    for (int i = 0; i < 100; i++) {
+        Point query(coordinate(rng), coordinate(rng));
+        double radius = rng() % 30;
+        std::vector<size_t> expected;
+        for (size_t j = 0; j < points.size(); j++) {
+            auto dx = points[j].get_x() - query.get_x();
+            auto dy = points[j].get_y() - query.get_y();
+            if (dx * dx + dy * dy <= radius * radius) {
+                expected.push_back(j);
+            }
+        }
+        VectorList<size_t> found(points.size());
+        EXPECT_EQ(tree.within_radius(query, radius, found), expected.size());
+        std::vector<size_t> sorted;
+        for (size_t j = 0; j < found.size(); j++) {
+            sorted.push_back(found[j]);
+        }
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(sorted, expected);
+        EXPECT_EQ(tree.count_within_radius(query, radius), expected.size());
+    }
+    EXPECT_EQ(tree.count_within_radius(Point(1, 10), 0), 2u);
+    EXPECT_EQ(tree.count_within_radius(Point(), -1), 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, KdTreeTest, ::testing::Values(1u, 4u));
+
+TEST(KdTree, LargeParallelBuild) {
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<double> coordinate(0, 1000);
+    VectorList<Point> points(200000);
+    for (int i = 0; i < 200000; i++) {
+        points.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    KdTree serial(points);
+    KdTree parallel(points, 4);
+    for (int i = 0; i < 100; i++) {
+        Point query(coordinate(rng), coordinate(rng));
+        auto a = serial.nearest(query);
+        auto b = parallel.nearest(query);
+        EXPECT_EQ(points[a].distance(query), points[b].distance(query));
+    }
+}
+
+TEST(KdTree, EmptyAndSmall) {
+    KdTree empty(nullptr, nullptr);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_THROW(empty.nearest(Point()), std::out_of_range);
+    size_t indices[3];
+    EXPECT_EQ(empty.k_nearest(Point(), 3, indices), 0u);
+    EXPECT_EQ(empty.count_within_radius(Point(), 10), 0u);
+
+    Point points[] = {Point(0, 0), Point(5, 5), Point(2, 1)};
+    KdTree tree(points, points + 3);
+    EXPECT_EQ(tree.k_nearest(Point(4, 4), 10, indices), 3u);
+    EXPECT_EQ(indices[0], 1u);
+    EXPECT_EQ(indices[1], 2u);
+    EXPECT_EQ(indices[2], 0u);
+
+    KdTree copy(tree);
+    tree = empty;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(copy.nearest(Point(0.4, 0.1)), 0u);
+}
@@ -0,0 +1,139 @@
+#include "../include/lfu_cache.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+class LfuCacheTest : public ::testing::Test {
+  protected:
+    LfuCache<int, int> cache{3};
+};
+
+TEST_F(LfuCacheTest, InitiallyEmpty) {
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.get(1), nullptr);
+    EXPECT_EQ(cache.misses(), 1);
+    EXPECT_EQ(cache.frequency(1), 0);
+    EXPECT_THROW(cache.evict(), std::out_of_range);
+}
+
+TEST_F(LfuCacheTest, PutAndGetCountFrequency) {
+    cache.put(1, 10);
+    EXPECT_EQ(cache.frequency(1), 1);
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), 10);
+    EXPECT_EQ(cache.frequency(1), 3);
+    cache.put(1, 11);
+    EXPECT_EQ(cache.frequency(1), 4);
+    EXPECT_EQ(*cache.get(1), 11);
+    EXPECT_EQ(cache.hits(), 3);
+}
+
+TEST_F(LfuCacheTest, EvictsLeastFrequentlyUsed) {
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(1);
+    cache.get(1);
+    cache.get(3);
+    cache.put(4, 40);
+
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+
+    // 4 tem frequência 1, a menor
+    cache.put(5, 50);
+    EXPECT_FALSE(cache.contains(4));
+    EXPECT_EQ(cache.evictions(), 2);
+}
+
+TEST_F(LfuCacheTest, TiesEvictLeastRecentlyUsed) {
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(2);
+    cache.get(1);
+    cache.get(3);
+    // Todos com frequência 2; 2 foi usado há mais tempo
+    cache.put(4, 40);
+    EXPECT_FALSE(cache.contains(2));
+    cache.get(4);
+    // 4 agora também tem frequência 2, mas é o mais recente do grupo
+    cache.put(5, 50);
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(4));
+}
+
+TEST_F(LfuCacheTest, EvictionCallbackAndErase) {
+    std::vector<int> evicted;
+    cache.set_eviction_callback(
+        [&](const int& key, const int&) { evicted.push_back(key); });
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.get(2);
+    EXPECT_TRUE(cache.erase(2));
+    EXPECT_FALSE(cache.erase(2));
+    cache.put(3, 30);
+    cache.put(4, 40);
+    cache.put(5, 50);
+    ASSERT_EQ(evicted.size(), 1);
+    EXPECT_EQ(evicted[0], 1);
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.weight(), 0);
+}
+
+TEST_F(LfuCacheTest, ManyOperationsKeepInvariants) {
+    LfuCache<int, int> big(100);
+    for (int i = 0; i < 20000; i++) {
+        int key = (i * 7919) % 300;
+        if (big.get(key) == nullptr) {
+            big.put(key, i);
+        }
+        if (i % 17 == 0) {
+            big.erase((i * 31) % 300);
+        }
+        ASSERT_LE(big.size(), 100);
+    }
+    EXPECT_EQ(big.weight(), big.size());
+}
+
+TEST(LfuCacheWeightTest, CapacityInBytes) {
+    LfuCache<int, std::string> cache(10, [](const int&, const std::string& v) {
+        return v.size();
+    });
+    cache.put(1, "abcd");
+    cache.put(2, "efgh");
+    cache.get(1);
+    cache.put(3, "ijk");
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_EQ(cache.weight(), 7);
+    cache.put(1, "abcdefghijk");
+    ASSERT_TRUE(cache.contains(1));
+    EXPECT_EQ(*cache.get(1), "abcd");
+    EXPECT_EQ(cache.weight(), 7);
+}
+
+TEST(LfuCacheWeightTest, PutValueFromCache) {
+    LfuCache<int, std::string> cache(8, [](const int&, const std::string& v) {
+        return v.size();
+    });
+    cache.put(1, "abcd");
+    cache.put(2, "efgh");
+    cache.get(2);
+
+    // O valor vem da entrada 1, a menos usada, que é descartada para abrir
+    // espaço.
+    auto value = cache.get(1);
+    cache.get(2);
+    cache.put(3, *value);
+    EXPECT_FALSE(cache.contains(1));
+    ASSERT_TRUE(cache.contains(3));
+    EXPECT_EQ(*cache.get(3), "abcd");
+
+    cache.put(2, *cache.get(2));
+    EXPECT_EQ(*cache.get(2), "efgh");
+    EXPECT_EQ(cache.weight(), 8);
+}
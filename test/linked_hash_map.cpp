@@ -0,0 +1,114 @@
+#include "../include/linked_hash_map.hpp"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class LinkedHashMapTest : public ::testing::Test {
+  protected:
+    std::vector<int> keys() const {
+        std::vector<int> result;
+        for (const auto &entry : map) {
+            result.push_back(entry.key);
+        }
+        return result;
+    }
+
+    LinkedHashMap<int, std::string> map;
+};
+
+TEST_F(LinkedHashMapTest, InitiallyEmpty) {
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_THROW(map.pop_front(), std::out_of_range);
+}
+
+TEST_F(LinkedHashMapTest, InsertKeepsInsertionOrder) {
+    EXPECT_TRUE(map.insert(3, "c"));
+    EXPECT_TRUE(map.insert(1, "a"));
+    EXPECT_TRUE(map.insert(2, "b"));
+    EXPECT_EQ(keys(), (std::vector<int>{3, 1, 2}));
+    ASSERT_NE(map.find(1), nullptr);
+    EXPECT_EQ(*map.find(1), "a");
+}
+
+TEST_F(LinkedHashMapTest, UpdateKeepsPosition) {
+    map.insert(1, "a");
+    map.insert(2, "b");
+    EXPECT_FALSE(map.insert(1, "z"));
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(*map.find(1), "z");
+    EXPECT_EQ(keys(), (std::vector<int>{1, 2}));
+}
+
+TEST_F(LinkedHashMapTest, EraseAndMoveToBack) {
+    for (int i = 0; i < 5; i++) {
+        map.insert(i, std::to_string(i));
+    }
+    EXPECT_TRUE(map.erase(2));
+    EXPECT_FALSE(map.erase(2));
+    EXPECT_TRUE(map.move_to_back(0));
+    EXPECT_TRUE(map.move_to_back(0));
+    EXPECT_FALSE(map.move_to_back(7));
+    EXPECT_EQ(keys(), (std::vector<int>{1, 3, 4, 0}));
+
+    map.pop_front();
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(keys(), (std::vector<int>{3, 4, 0}));
+}
+
+TEST_F(LinkedHashMapTest, ModifyThroughIterator) {
+    map.insert(1, "a");
+    map.begin()->value = "b";
+    EXPECT_EQ(*map.find(1), "b");
+}
+
+TEST_F(LinkedHashMapTest, CopyAndAssign) {
+    for (int i = 0; i < 4; i++) {
+        map.insert(3 - i, std::to_string(i));
+    }
+    LinkedHashMap<int, std::string> copy(map);
+    copy.erase(3);
+    EXPECT_TRUE(map.contains(3));
+    EXPECT_EQ(copy.size(), 3);
+
+    copy = map;
+    EXPECT_EQ(copy.size(), 4);
+    std::vector<int> order;
+    for (const auto &entry : copy) {
+        order.push_back(entry.key);
+    }
+    EXPECT_EQ(order, keys());
+}
+
+TEST_F(LinkedHashMapTest, ClearAndReuse) {
+    for (int i = 0; i < 100; i++) {
+        map.insert(i, "x");
+    }
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(5));
+    map.insert(5, "y");
+    EXPECT_EQ(keys(), (std::vector<int>{5}));
+}
+
+struct ModuloHash {
+    size_t operator()(int key) const { return key % 4; }
+};
+
+TEST(LinkedHashMapCustomHashTest, UsesGivenHash) {
+    LinkedHashMap<int, int, ModuloHash> map;
+    for (int i = 0; i < 50; i++) {
+        map.insert(i, i * i);
+    }
+    for (int i = 0; i < 50; i += 2) {
+        map.erase(i);
+    }
+    EXPECT_EQ(map.size(), 25);
+    for (int i = 1; i < 50; i += 2) {
+        ASSERT_NE(map.find(i), nullptr);
+        EXPECT_EQ(*map.find(i), i * i);
+    }
+}
@@ -0,0 +1,82 @@
+#include "../include/linked_hash_set.hpp"
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class LinkedHashSetTest : public ::testing::Test {
+  protected:
+    std::vector<int> items() const {
+        return std::vector<int>(set.begin(), set.end());
+    }
+
+    LinkedHashSet<int> set;
+};
+
+TEST_F(LinkedHashSetTest, InitiallyEmpty) {
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_THROW(set.front(), std::out_of_range);
+    EXPECT_THROW(set.pop_front(), std::out_of_range);
+}
+
+TEST_F(LinkedHashSetTest, InsertIgnoresDuplicates) {
+    EXPECT_TRUE(set.insert(5));
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_FALSE(set.insert(5));
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_EQ(items(), (std::vector<int>{5, 1, 3}));
+}
+
+TEST_F(LinkedHashSetTest, EraseAndMoveToBack) {
+    for (int i = 0; i < 5; i++) {
+        set.insert(i);
+    }
+    EXPECT_TRUE(set.erase(3));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_TRUE(set.move_to_back(1));
+    EXPECT_FALSE(set.move_to_back(3));
+    EXPECT_EQ(items(), (std::vector<int>{0, 2, 4, 1}));
+
+    EXPECT_EQ(set.front(), 0);
+    set.pop_front();
+    EXPECT_EQ(set.front(), 2);
+    EXPECT_FALSE(set.contains(0));
+}
+
+TEST_F(LinkedHashSetTest, CopyAndAssign) {
+    for (int i = 0; i < 4; i++) {
+        set.insert(10 - i);
+    }
+    LinkedHashSet<int> copy(set);
+    copy.erase(10);
+    EXPECT_TRUE(set.contains(10));
+    EXPECT_EQ(copy.size(), 3);
+
+    copy = set;
+    EXPECT_EQ(std::vector<int>(copy.begin(), copy.end()), items());
+}
+
+TEST_F(LinkedHashSetTest, ManyElements) {
+    for (int i = 0; i < 10000; i++) {
+        set.insert(i);
+    }
+    for (int i = 0; i < 10000; i += 3) {
+        set.erase(i);
+    }
+    for (int i = 0; i < 10000; i++) {
+        EXPECT_EQ(set.contains(i), i % 3 != 0);
+    }
+    EXPECT_EQ(set.front(), 1);
+}
+
+TEST(LinkedHashSetStringTest, Strings) {
+    LinkedHashSet<std::string> words;
+    for (auto word : {"b", "a", "c", "a", "b"}) {
+        words.insert(word);
+    }
+    EXPECT_EQ(std::vector<std::string>(words.begin(), words.end()),
+              (std::vector<std::string>{"b", "a", "c"}));
+}
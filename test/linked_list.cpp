@@ -1,6 +1,9 @@
 #include "../include/linked_list.hpp"
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 class LinkedListTest : public ::testing::Test {
   protected:
     LinkedList<int> list;
@@ -168,3 +171,55 @@ TEST_F(LinkedListTest, AssignmentOperator) {
               20); // Assigned list's values should remain the same
     EXPECT_EQ(assignedList[1], 10);
 }
+
+TEST_F(LinkedListTest, SequentialIndexAccess) {
+    for (int i = 0; i < 1000; i++) {
+        list.insert(list.size(), i);
+    }
+    for (size_t i = 0; i < list.size(); i++) {
+        EXPECT_EQ(list[i], static_cast<int>(i));
+    }
+    EXPECT_EQ(list[10], 10);
+}
+
+TEST_F(LinkedListTest, ConstIndexAccessFromThreads) {
+    for (int i = 0; i < 200; i++) {
+        list.insert(list.size(), i);
+    }
+    EXPECT_EQ(list[150], 150);
+    const auto& shared = list;
+    std::vector<long> sums(4);
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < sums.size(); t++) {
+        readers.emplace_back([&, t] {
+            for (size_t i = 0; i < shared.size(); i++) {
+                sums[t] += shared[i];
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    for (auto sum : sums) {
+        EXPECT_EQ(sum, 199 * 200 / 2);
+    }
+    EXPECT_EQ(list[151], 151);
+}
+
+TEST_F(LinkedListTest, IndexAccessAfterStructuralChanges) {
+    list.push_front(30);
+    list.push_front(20);
+    list.push_front(10);
+    EXPECT_EQ(list[2], 30);
+    list.push_front(0);
+    EXPECT_EQ(list[2], 20);
+    list.remove(1);
+    EXPECT_EQ(list[1], 20);
+    list.pop_front();
+    EXPECT_EQ(list[0], 20);
+    list.insert(0, 5);
+    EXPECT_EQ(list[1], 20);
+    list.clear();
+    list.push_front(1);
+    EXPECT_EQ(list[0], 1);
+}
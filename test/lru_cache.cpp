@@ -0,0 +1,111 @@
+#include "../include/lru_cache.hpp"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+class LruCacheTest : public ::testing::Test {
+  protected:
+    LruCache<int, int> cache{3};
+};
+
+TEST_F(LruCacheTest, InitiallyEmpty) {
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.capacity(), 3);
+    EXPECT_EQ(cache.get(1), nullptr);
+    EXPECT_EQ(cache.misses(), 1);
+    EXPECT_THROW(cache.evict(), std::out_of_range);
+}
+
+TEST_F(LruCacheTest, PutAndGet) {
+    cache.put(1, 10);
+    cache.put(2, 20);
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), 10);
+    EXPECT_EQ(cache.hits(), 2);
+    cache.put(1, 11);
+    EXPECT_EQ(*cache.get(1), 11);
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(LruCacheTest, EvictsLeastRecentlyUsed) {
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(1);
+    cache.put(4, 40);
+
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+    EXPECT_EQ(cache.evictions(), 1);
+}
+
+TEST_F(LruCacheTest, EvictionCallback) {
+    std::vector<int> evicted;
+    cache.set_eviction_callback(
+        [&](const int& key, const int&) { evicted.push_back(key); });
+    for (int i = 0; i < 5; i++) {
+        cache.put(i, i);
+    }
+    cache.evict();
+    ASSERT_EQ(evicted.size(), 3);
+    EXPECT_EQ(evicted[0], 0);
+    EXPECT_EQ(evicted[1], 1);
+    EXPECT_EQ(evicted[2], 2);
+}
+
+TEST_F(LruCacheTest, EraseAndClear) {
+    cache.put(1, 10);
+    cache.put(2, 20);
+    EXPECT_TRUE(cache.erase(1));
+    EXPECT_FALSE(cache.erase(1));
+    EXPECT_EQ(cache.size(), 1);
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.weight(), 0);
+    EXPECT_EQ(cache.evictions(), 0);
+}
+
+TEST(LruCacheWeightTest, CapacityInBytes) {
+    LruCache<int, std::string> cache(10, [](const int&, const std::string& v) {
+        return v.size();
+    });
+    cache.put(1, "abcd");
+    cache.put(2, "efgh");
+    EXPECT_EQ(cache.weight(), 8);
+    cache.put(3, "ijk");
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_EQ(cache.weight(), 7);
+    cache.put(4, "this value is too large");
+    EXPECT_FALSE(cache.contains(4));
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(LruCacheWeightTest, PutValueFromCache) {
+    LruCache<int, std::string> cache(10, [](const int&, const std::string& v) {
+        return v.size();
+    });
+    cache.put(1, "abcd");
+    cache.put(2, "efgh");
+
+    // Atualiza com o próprio valor, que continua na cache.
+    cache.put(1, *cache.get(1));
+    ASSERT_TRUE(cache.contains(1));
+    EXPECT_EQ(*cache.get(1), "abcd");
+    EXPECT_EQ(cache.weight(), 8);
+
+    // O valor vem da entrada 2, que é descartada para abrir espaço.
+    cache.put(3, *cache.get(2));
+    EXPECT_FALSE(cache.contains(1));
+    ASSERT_TRUE(cache.contains(3));
+    EXPECT_EQ(*cache.get(3), "efgh");
+
+    // Uma atualização pesada demais não muda a cache.
+    cache.put(3, "this value is too large");
+    ASSERT_TRUE(cache.contains(3));
+    EXPECT_EQ(*cache.get(3), "efgh");
+    EXPECT_EQ(cache.weight(), 8);
+}
@@ -0,0 +1,124 @@
+#include "../include/pair.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "../include/vector_list.hpp"
+
+namespace {
+
+struct Less {
+    bool operator()(int a, int b) const { return a < b; }
+};
+
+struct Tag {};
+
+}  // namespace
+
+// Valores vazios não ocupam espaço, e pares de tipos triviais são
+// trivialmente copiáveis.
+static_assert(sizeof(Pair<int, Less>) == sizeof(int));
+static_assert(sizeof(Pair<Tag, double>) == sizeof(double));
+static_assert(std::is_trivially_copyable<Pair<int, double>>::value);
+static_assert(std::is_trivially_copyable<Pair<long, Tag>>::value);
+static_assert(!std::is_trivially_copyable<Pair<int, std::string>>::value);
+
+static_assert(Pair<int, int>(1, 2) < Pair<int, int>(1, 3));
+static_assert(Pair<int, int>(2, 0) > Pair<int, int>(1, 9));
+static_assert(Pair<int, int>(1, 2).compare(Pair<int, int>(1, 2)) == 0);
+
+TEST(PairTest, Accessors) {
+    Pair<int, std::string> pair(1, "um");
+    EXPECT_EQ(pair.first(), 1);
+    EXPECT_EQ(pair.second(), "um");
+    pair.first() = 2;
+    pair.second() += "!";
+    EXPECT_EQ(pair.first(), 2);
+    EXPECT_EQ(pair.second(), "um!");
+
+    Pair<int, std::string> empty;
+    EXPECT_EQ(empty.first(), 0);
+    EXPECT_EQ(empty.second(), "");
+}
+
+TEST(PairTest, Comparisons) {
+    Pair<int, float> a(2, 4.5);
+    Pair<int, float> b(2, 4);
+    Pair<int, float> c(3, 1);
+    EXPECT_FALSE(a == b);
+    EXPECT_TRUE(a != b);
+    // Um par que difere só no segundo valor também é diferente.
+    EXPECT_TRUE((a != Pair<int, float>(5, 4.5)));
+    EXPECT_FALSE((a != Pair<int, float>(2, 4.5)));
+
+    EXPECT_TRUE(b < a);
+    EXPECT_TRUE(a > b);
+    EXPECT_TRUE(a < c);
+    EXPECT_FALSE(c < a);
+    EXPECT_TRUE(c > a);
+    EXPECT_TRUE(a >= b);
+    EXPECT_TRUE(a >= a);
+    EXPECT_TRUE(b <= a);
+    EXPECT_FALSE(c <= a);
+    EXPECT_LT(b.compare(a), 0);
+    EXPECT_GT(c.compare(a), 0);
+    EXPECT_EQ(a.compare(a), 0);
+#ifdef PAIR_THREE_WAY
+    EXPECT_TRUE((b <=> a) < 0);
+    EXPECT_TRUE((a <=> a) == 0);
+    EXPECT_TRUE((c <=> a) > 0);
+#endif
+}
+
+TEST(PairTest, MovesAndConstructsInPlace) {
+    auto pointer = std::make_unique<int>(7);
+    Pair<std::unique_ptr<int>, std::string> pair(std::move(pointer), "sete");
+    EXPECT_EQ(pointer, nullptr);
+    EXPECT_EQ(*pair.first(), 7);
+    auto moved = std::move(pair);
+    EXPECT_EQ(*moved.first(), 7);
+    EXPECT_EQ(pair.first(), nullptr);
+
+    Pair<std::string, std::string> piecewise(std::piecewise_construct,
+                                             std::forward_as_tuple(3, 'a'),
+                                             std::forward_as_tuple("abc", 2));
+    EXPECT_EQ(piecewise.first(), "aaa");
+    EXPECT_EQ(piecewise.second(), "ab");
+}
+
+TEST(PairTest, StructuredBindings) {
+    Pair<int, std::string> pair(4, "quatro");
+    auto& [number, name] = pair;
+    number++;
+    EXPECT_EQ(pair.first(), 5);
+    EXPECT_EQ(name, "quatro");
+
+    auto [copy_number, copy_name] = pair;
+    EXPECT_EQ(copy_number, 5);
+    EXPECT_EQ(copy_name, "quatro");
+
+    const Pair<double, Less> with_empty(1.5, Less());
+    auto [value, less] = with_empty;
+    EXPECT_EQ(value, 1.5);
+    EXPECT_TRUE(less(1, 2));
+}
+
+TEST(PairTest, VectorListOfPairs) {
+    VectorList<Pair<unsigned, int>> list(100);
+    for (unsigned i = 0; i < 100; i++) {
+        list.push_back(Pair<unsigned, int>(i * 37 % 100, -static_cast<int>(i)));
+    }
+    VectorList<Pair<unsigned, int>> copy = list;
+    copy.remove(0);
+    copy.insert(0, list[0]);
+    for (size_t i = 0; i < list.size(); i++) {
+        ASSERT_EQ(copy[i], list[i]);
+    }
+    std::sort(&copy[0], &copy[0] + copy.size());
+    for (size_t i = 0; i < copy.size(); i++) {
+        EXPECT_EQ(copy[i].first(), i);
+    }
+}
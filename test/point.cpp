@@ -0,0 +1,60 @@
+#include "../include/point.hpp"
+#include <gtest/gtest.h>
+
+// As operações sem raiz quadrada podem ser avaliadas em tempo de compilação.
+static_assert(Point(1, 2).distance_squared(Point(4, 6)) == 25);
+static_assert(Point(1, 2).within(Point(4, 6), 5));
+static_assert(!Point(1, 2).within(Point(4, 6), 4.99));
+static_assert(Point(0.1, 0.2).is_equal(Point(0.1, 0.2)));
+
+constexpr Point moved(Point point) {
+    point.move(2, -1);
+    return point;
+}
+static_assert(moved(Point(1, 1)).is_equal(Point(3, 0)));
+
+TEST(PointTest, DefaultIsOrigin) {
+    Point point;
+    EXPECT_EQ(point.get_x(), 0);
+    EXPECT_EQ(point.get_y(), 0);
+}
+
+TEST(PointTest, Distance) {
+    Point a(1, 2);
+    Point b(4, 6);
+    EXPECT_EQ(a.distance(b), 5);
+    EXPECT_EQ(b.distance(a), 5);
+    EXPECT_EQ(a.distance_squared(b), 25);
+    EXPECT_EQ(a.distance(a), 0);
+}
+
+TEST(PointTest, WithinMatchesDistance) {
+    Point center(0.5, -0.25);
+    for (int i = -20; i <= 20; i++) {
+        for (int j = -20; j <= 20; j++) {
+            Point point(i * 0.37, j * 0.41);
+            for (double radius : {0.0, 1.0, 2.5, 7.0}) {
+                EXPECT_EQ(center.within(point, radius),
+                          center.distance(point) <= radius);
+            }
+        }
+    }
+    EXPECT_TRUE(center.within(center, 0));
+    EXPECT_FALSE(center.within(center, -1));
+}
+
+TEST(PointTest, EqualityWithEpsilon) {
+    Point a(0.1 + 0.2, 1);
+    Point b(0.3, 1);
+    EXPECT_FALSE(a.is_equal(b));
+    EXPECT_TRUE(a.is_equal(b, 1e-12));
+    EXPECT_TRUE(b.is_equal(a, 1e-12));
+    EXPECT_FALSE(a.is_equal(Point(0.3, 1.1), 1e-12));
+    EXPECT_TRUE(a.is_equal(Point(0.3, 1.1), 0.2));
+}
+
+TEST(PointTest, Move) {
+    Point point(1, 1);
+    point.move(-3, 0.5);
+    EXPECT_TRUE(point.is_equal(Point(-2, 1.5)));
+}
@@ -0,0 +1,125 @@
+#include "../include/point_cloud.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class PointCloudTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        std::mt19937 rng(4);
+        std::uniform_real_distribution<double> coordinate(-50, 50);
+        // Um tamanho que não é múltiplo de 4 exercita o final escalar.
+        for (int i = 0; i < 1003; i++) {
+            Point point(coordinate(rng), coordinate(rng));
+            if (i % 97 == 0) {
+                point = Point(1.5, -2.5);
+            }
+            points.push_back(point);
+            cloud.push_back(point);
+        }
+    }
+
+    std::vector<Point> points;
+    PointCloud cloud;
+};
+
+TEST_F(PointCloudTest, StoresPoints) {
+    ASSERT_EQ(cloud.size(), points.size());
+    EXPECT_GE(cloud.capacity(), cloud.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_TRUE(cloud[i].is_equal(points[i]));
+        EXPECT_EQ(cloud.x_data()[i], points[i].get_x());
+        EXPECT_EQ(cloud.y_data()[i], points[i].get_y());
+    }
+    EXPECT_THROW(cloud[points.size()], std::out_of_range);
+}
+
+TEST_F(PointCloudTest, ConvertsToAndFromVectorList) {
+    auto list = cloud.to_vector_list();
+    ASSERT_EQ(list.size(), points.size());
+    PointCloud copy(list);
+    ASSERT_EQ(copy.size(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_TRUE(list[i].is_equal(points[i]));
+        EXPECT_TRUE(copy[i].is_equal(points[i]));
+    }
+}
+
+TEST_F(PointCloudTest, Distances) {
+    Point query(3, 4);
+    std::vector<double> distances(points.size());
+    std::vector<double> squared(points.size());
+    cloud.distances(query, distances.data());
+    cloud.distances_squared(query, squared.data());
+    for (size_t i = 0; i < points.size(); i++) {
+        EXPECT_DOUBLE_EQ(distances[i], points[i].distance(query));
+        EXPECT_DOUBLE_EQ(squared[i], distances[i] * distances[i]);
+    }
+}
+
+TEST_F(PointCloudTest, DistanceTile) {
+    PointCloud other;
+    other.push_back(Point(0, 0));
+    other.push_back(Point(10, 10));
+    other.push_back(Point(-3, 7));
+    other.push_back(Point(5, -1));
+    other.push_back(Point(2, 2));
+
+    std::vector<double> tile(7 * 5);
+    cloud.distance_tile(other, 11, 7, 0, 5, tile.data());
+    for (size_t i = 0; i < 7; i++) {
+        for (size_t j = 0; j < 5; j++) {
+            EXPECT_DOUBLE_EQ(tile[i * 5 + j],
+                             points[11 + i].distance(other[j]));
+        }
+    }
+
+    std::vector<double> square(9 * 9);
+    cloud.distance_tile(cloud, 990, 9, 990, 9, square.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_EQ(square[i * 9 + i], 0);
+    }
+    EXPECT_THROW(cloud.distance_tile(other, 0, 1, 3, 3, tile.data()),
+                 std::out_of_range);
+    EXPECT_THROW(cloud.distance_tile(other, 1000, 4, 0, 1, tile.data()),
+                 std::out_of_range);
+}
+
+TEST_F(PointCloudTest, MoveAll) {
+    cloud.move_all(1.25, -0.5);
+    for (size_t i = 0; i < points.size(); i++) {
+        points[i].move(1.25, -0.5);
+        EXPECT_TRUE(cloud[i].is_equal(points[i]));
+    }
+}
+
+TEST_F(PointCloudTest, EqualityFilter) {
+    VectorList<size_t> indices(100);
+    EXPECT_EQ(cloud.filter_equal(Point(1.5, -2.5), indices), 11u);
+    for (size_t i = 0; i < indices.size(); i++) {
+        EXPECT_EQ(indices[i], i * 97);
+    }
+    EXPECT_EQ(cloud.count_equal(Point(1.5, -2.5)), 11u);
+    EXPECT_EQ(cloud.count_equal(Point(1.5, 2.5)), 0u);
+    EXPECT_EQ(cloud.count_equal(points[500]), 1u);
+}
+
+TEST(PointCloud, EmptyAndCopy) {
+    PointCloud cloud;
+    EXPECT_TRUE(cloud.empty());
+    EXPECT_EQ(cloud.to_vector_list().size(), 0u);
+    cloud.move_all(1, 1);
+    EXPECT_EQ(cloud.count_equal(Point()), 0u);
+
+    cloud.push_back(Point(1, 2));
+    PointCloud copy(cloud);
+    copy.move_all(1, 1);
+    EXPECT_TRUE(cloud[0].is_equal(Point(1, 2)));
+    EXPECT_TRUE(copy[0].is_equal(Point(2, 3)));
+    cloud = copy;
+    EXPECT_TRUE(cloud[0].is_equal(Point(2, 3)));
+    cloud.clear();
+    EXPECT_TRUE(cloud.empty());
+}
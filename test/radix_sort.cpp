@@ -0,0 +1,123 @@
+#include "../include/radix_sort.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+template <class T, class Key>
+void expect_sorted_like_stable_sort(VectorList<T> list, Key key,
+                                    unsigned digit_bits, unsigned threads) {
+    std::vector<T> expected;
+    for (size_t i = 0; i < list.size(); i++) {
+        expected.push_back(list[i]);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [&](const T& a, const T& b) { return key(a) < key(b); });
+    radix_sort_by(list, key, digit_bits, threads);
+    ASSERT_EQ(list.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_TRUE(list[i] == expected[i]) << "posicao " << i;
+    }
+}
+
+TEST(RadixSortTest, SortsIntegersWithNegatives) {
+    std::mt19937 rng(7);
+    for (size_t n : {0, 1, 2, 100, 511, 512, 5000, 200000}) {
+        std::uniform_int_distribution<int> value(INT32_MIN, INT32_MAX);
+        VectorList<int> list(n);
+        for (size_t i = 0; i < n; i++) {
+            list.push_back(value(rng));
+        }
+        for (unsigned bits : {8u, 11u}) {
+            for (unsigned threads : {1u, 4u}) {
+                expect_sorted_like_stable_sort(list, IdentityKey(), bits,
+                                               threads);
+            }
+        }
+    }
+}
+
+TEST(RadixSortTest, IntegerOverload) {
+    VectorList<int> list(7);
+    for (int value : {5, -3, 0, 2147483647, -2147483647 - 1, 7, -3}) {
+        list.push_back(value);
+    }
+    radix_sort(list);
+    int expected[] = {-2147483647 - 1, -3, -3, 0, 5, 7, 2147483647};
+    for (size_t i = 0; i < list.size(); i++) {
+        EXPECT_EQ(list[i], expected[i]);
+    }
+}
+
+TEST(RadixSortTest, SkipsConstantDigits) {
+    // Só o dígito mais baixo varia; as outras passadas são puladas, e o
+    // resultado precisa voltar para a lista.
+    VectorList<int> list(3000);
+    for (int i = 0; i < 3000; i++) {
+        list.push_back(0x12345600 | ((i * 37) & 0xFF));
+    }
+    expect_sorted_like_stable_sort(list, IdentityKey(), 8, 1);
+    VectorList<int> equal(3000);
+    for (int i = 0; i < 3000; i++) {
+        equal.push_back(-42);
+    }
+    radix_sort(equal, 11);
+    EXPECT_EQ(equal[0], -42);
+    EXPECT_EQ(equal[2999], -42);
+}
+
+TEST(RadixSortTest, SortsHours) {
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> hour(0, 23);
+    std::uniform_int_distribution<int> minute(0, 59);
+    VectorList<Hours> list(100000);
+    for (int i = 0; i < 100000; i++) {
+        list.push_back(Hours(hour(rng), minute(rng), minute(rng)));
+    }
+    for (unsigned bits : {8u, 11u}) {
+        for (unsigned threads : {1u, 0u}) {
+            expect_sorted_like_stable_sort(list, SecondsKey(), bits, threads);
+        }
+    }
+    radix_sort(list, 11);
+    for (size_t i = 1; i < list.size(); i++) {
+        ASSERT_FALSE(list[i] < list[i - 1]);
+    }
+}
+
+TEST(RadixSortTest, PairsAreStable) {
+    // Poucas chaves distintas: os valores, em ordem de inserção, mostram se
+    // a ordem relativa das chaves iguais foi mantida.
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<uint32_t> key(0, 1000);
+    for (size_t n : {300, 150000}) {
+        VectorList<Pair<uint32_t, int>> list(n);
+        for (size_t i = 0; i < n; i++) {
+            list.push_back(
+                Pair<uint32_t, int>(key(rng) * 0x10001u, static_cast<int>(i)));
+        }
+        for (unsigned bits : {8u, 11u}) {
+            for (unsigned threads : {1u, 3u}) {
+                auto sorted = list;
+                radix_sort(sorted, bits, threads);
+                for (size_t i = 1; i < n; i++) {
+                    auto& before = sorted[i - 1];
+                    auto& after = sorted[i];
+                    ASSERT_LE(before.first(), after.first());
+                    if (before.first() == after.first()) {
+                        ASSERT_LT(before.second(), after.second());
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(RadixSortTest, InvalidDigitSize) {
+    VectorList<int> list(1);
+    list.push_back(1);
+    EXPECT_THROW(radix_sort(list, 16), std::invalid_argument);
+    EXPECT_THROW(radix_sort_by(list, IdentityKey(), 0), std::invalid_argument);
+}
@@ -0,0 +1,123 @@
+#include "../include/space_filling_curve.hpp"
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+
+// Com este retângulo, a quantização preserva coordenadas inteiras.
+constexpr BoundingBox full{0, 0, 4294967295.0, 4294967295.0};
+
+TEST(SpaceFillingCurveTest, MortonInterleavesBits) {
+    EXPECT_EQ(morton_key(Point(0, 0), full), 0u);
+    EXPECT_EQ(morton_key(Point(1, 0), full), 1u);
+    EXPECT_EQ(morton_key(Point(0, 1), full), 2u);
+    EXPECT_EQ(morton_key(Point(3, 5), full), 39u);
+    EXPECT_EQ(morton_key(Point(4294967295.0, 4294967295.0), full),
+              UINT64_MAX);
+    // Pontos fora do retângulo vão para a borda.
+    EXPECT_EQ(morton_key(Point(-10, 1e20), full),
+              morton_key(Point(0, 4294967295.0), full));
+}
+
+TEST(SpaceFillingCurveTest, HilbertVisitsNeighbors) {
+    VectorList<Point> grid(256);
+    for (int x = 0; x < 16; x++) {
+        for (int y = 0; y < 16; y++) {
+            grid.push_back(Point(x, y));
+        }
+    }
+    auto order = sort_by_curve(grid, Curve::hilbert);
+    ASSERT_EQ(order.size(), 256u);
+    for (size_t i = 0; i < grid.size(); i++) {
+        EXPECT_EQ(hilbert_key(grid[i], full), i);
+        if (i > 0) {
+            auto dx = grid[i].get_x() - grid[i - 1].get_x();
+            auto dy = grid[i].get_y() - grid[i - 1].get_y();
+            EXPECT_EQ(dx * dx + dy * dy, 1);
+        }
+    }
+}
+
+class SortByCurveTest : public ::testing::TestWithParam<Curve> {};
+
+TEST_P(SortByCurveTest, SortsAndReturnsPermutation) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coordinate(-50, 50);
+    VectorList<Point> original(100000);
+    for (int i = 0; i < 100000; i++) {
+        original.push_back(Point(coordinate(rng), coordinate(rng)));
+    }
+    // Repetidos ficam na ordem original.
+    original[10] = original[20] = original[30];
+
+    auto box = bounding_box(original);
+    auto key = [&](const Point& point) {
+        return GetParam() == Curve::morton ? morton_key(point, box)
+                                           : hilbert_key(point, box);
+    };
+    VectorList<Point> points = original;
+    PointCloud cloud(original);
+    auto order = sort_by_curve(points, GetParam());
+    auto cloud_order = sort_by_curve(cloud, GetParam());
+    auto inverse = invert_permutation(order);
+    ASSERT_EQ(order.size(), original.size());
+    size_t last_duplicate = 0;
+    for (size_t i = 0; i < points.size(); i++) {
+        ASSERT_EQ(order[i], cloud_order[i]);
+        ASSERT_TRUE(points[i].is_equal(original[order[i]]));
+        ASSERT_TRUE(cloud[i].is_equal(points[i]));
+        ASSERT_EQ(inverse[order[i]], i);
+        if (i > 0) {
+            ASSERT_LE(key(points[i - 1]), key(points[i]));
+        }
+        if (order[i] == 10 || order[i] == 20 || order[i] == 30) {
+            EXPECT_LT(last_duplicate, order[i]);
+            last_duplicate = order[i];
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Curves, SortByCurveTest,
+                         ::testing::Values(Curve::morton, Curve::hilbert));
+
+TEST(SpaceFillingCurveTest, SmallAndDegenerateInputs) {
+    VectorList<Point> empty(1);
+    EXPECT_EQ(sort_by_curve(empty).size(), 0u);
+
+    VectorList<Point> same(3);
+    for (int i = 0; i < 3; i++) {
+        same.push_back(Point(2, 2));
+    }
+    auto order = sort_by_curve(same, Curve::morton);
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_EQ(order[i], i);
+    }
+
+    VectorList<Point> corners(4);
+    corners.push_back(Point(1, 1));
+    corners.push_back(Point(0, 1));
+    corners.push_back(Point(1, 0));
+    corners.push_back(Point(0, 0));
+    order = sort_by_curve(corners, Curve::morton);
+    EXPECT_EQ(order[0], 3u);
+    EXPECT_EQ(order[1], 2u);
+    EXPECT_EQ(order[2], 1u);
+    EXPECT_EQ(order[3], 0u);
+    EXPECT_TRUE(corners[0].is_equal(Point(0, 0)));
+    EXPECT_TRUE(corners[3].is_equal(Point(1, 1)));
+}
+
+TEST(SpaceFillingCurveTest, InvertRejectsNonPermutations) {
+    VectorList<size_t> order(3);
+    order.push_back(0);
+    order.push_back(2);
+    order.push_back(2);
+    EXPECT_THROW(invert_permutation(order), std::invalid_argument);
+    order[2] = 3;
+    EXPECT_THROW(invert_permutation(order), std::invalid_argument);
+    order[2] = 1;
+    auto inverse = invert_permutation(order);
+    EXPECT_EQ(inverse[0], 0u);
+    EXPECT_EQ(inverse[1], 2u);
+    EXPECT_EQ(inverse[2], 1u);
+}
@@ -0,0 +1,150 @@
+#include "../include/spatial_grid.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using Grid = SpatialGrid<int>;
+
+std::vector<int> near(const Grid &grid, const Point &center, double radius) {
+    std::vector<int> found;
+    auto count = grid.for_each_within(center, radius,
+                                      [&](const Point &, int value) {
+                                          found.push_back(value);
+                                      });
+    EXPECT_EQ(count, found.size());
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+std::vector<int> naive_near(const std::vector<Point> &points,
+                            const std::vector<bool> &alive,
+                            const Point &center, double radius) {
+    std::vector<int> found;
+    for (size_t i = 0; i < points.size(); i++) {
+        auto dx = points[i].get_x() - center.get_x();
+        auto dy = points[i].get_y() - center.get_y();
+        if (alive[i] && dx * dx + dy * dy <= radius * radius) {
+            found.push_back(static_cast<int>(i));
+        }
+    }
+    return found;
+}
+
+TEST(SpatialGridTest, InsertRemoveAndQuery) {
+    Grid grid(1.0, 16);
+    auto a = grid.insert(Point(0.5, 0.5), 1);
+    auto b = grid.insert(Point(1.5, 0.5), 2);
+    auto c = grid.insert(Point(-3, -3), 3);
+    EXPECT_EQ(grid.size(), 3u);
+    EXPECT_EQ(near(grid, Point(1, 0.5), 0.5), (std::vector<int>{1, 2}));
+    EXPECT_EQ(near(grid, Point(1, 0.5), 0.49), (std::vector<int>{}));
+    EXPECT_EQ(near(grid, Point(0, 0), 100), (std::vector<int>{1, 2, 3}));
+
+    EXPECT_TRUE(grid.remove(b));
+    EXPECT_FALSE(grid.remove(b));
+    EXPECT_FALSE(grid.contains(b));
+    EXPECT_THROW(grid.position(b), std::out_of_range);
+    EXPECT_EQ(near(grid, Point(1, 0.5), 0.5), (std::vector<int>{1}));
+
+    // O slot liberado é reaproveitado, mas o identificador antigo não vale.
+    auto d = grid.insert(Point(9, 9), 4);
+    EXPECT_EQ(d.index, b.index);
+    EXPECT_FALSE(grid.contains(b));
+    EXPECT_TRUE(grid.contains(d));
+    EXPECT_EQ(grid.value(d), 4);
+    grid.value(c) = 30;
+    EXPECT_EQ(grid.value(c), 30);
+    EXPECT_TRUE(grid.position(a).is_equal(Point(0.5, 0.5)));
+}
+
+TEST(SpatialGridTest, MoveAcrossCells) {
+    Grid grid(2.0, 8);
+    auto a = grid.insert(Point(1, 1), 7);
+    grid.move(a, 0.5, 0);
+    EXPECT_TRUE(grid.position(a).is_equal(Point(1.5, 1)));
+    grid.move(a, 10, -20);
+    EXPECT_TRUE(grid.position(a).is_equal(Point(11.5, -19)));
+    EXPECT_EQ(near(grid, Point(1, 1), 3), (std::vector<int>{}));
+    EXPECT_EQ(near(grid, Point(11, -19), 1), (std::vector<int>{7}));
+    grid.relocate(a, Point(-100, 50));
+    EXPECT_EQ(near(grid, Point(-100, 50), 0), (std::vector<int>{7}));
+    EXPECT_EQ(grid.size(), 1u);
+}
+
+TEST(SpatialGridTest, RejectsInvalidCellSize) {
+    EXPECT_THROW(Grid(0), std::invalid_argument);
+    EXPECT_THROW(Grid(-1), std::invalid_argument);
+}
+
+class SpatialGridRandomTest : public ::testing::TestWithParam<unsigned> {};
+
+TEST_P(SpatialGridRandomTest, MatchesNaiveScan) {
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<double> coordinate(-50, 50);
+    std::uniform_real_distribution<double> step(-3, 3);
+    Grid grid(4.0, 64);
+    std::vector<Point> points;
+    std::vector<bool> alive;
+    std::vector<Grid::Handle> handles;
+    for (int i = 0; i < 3000; i++) {
+        points.push_back(Point(coordinate(rng), coordinate(rng)));
+        alive.push_back(true);
+        handles.push_back(grid.insert(points.back(), i));
+    }
+    for (int i = 0; i < 3000; i += 7) {
+        EXPECT_TRUE(grid.remove(handles[i]));
+        alive[i] = false;
+    }
+    for (int i = 1; i < 3000; i += 5) {
+        if (alive[i]) {
+            points[i].move(step(rng), step(rng));
+            grid.relocate(handles[i], points[i]);
+        }
+    }
+
+    for (int round = 0; round < 3; round++) {
+        // Cada valor guarda o índice do ponto, então o deslocamento pode ser
+        // reproduzido fora da grade.
+        grid.update(
+            [](Point &point, int &value) {
+                point.move((value % 7) - 3, (value % 5) - 2);
+            },
+            GetParam());
+        for (size_t i = 0; i < points.size(); i++) {
+            points[i].move((i % 7) - 3.0, (i % 5) - 2.0);
+        }
+        for (int query = 0; query < 30; query++) {
+            Point center(coordinate(rng), coordinate(rng));
+            double radius = rng() % 15;
+            EXPECT_EQ(near(grid, center, radius),
+                      naive_near(points, alive, center, radius));
+        }
+    }
+    EXPECT_EQ(near(grid, Point(), 1e6),
+              naive_near(points, alive, Point(), 1e6));
+    for (size_t i = 0; i < points.size(); i++) {
+        if (alive[i]) {
+            EXPECT_TRUE(grid.position(handles[i]).is_equal(points[i]));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, SpatialGridRandomTest,
+                         ::testing::Values(1u, 4u));
+
+TEST(SpatialGridTest, Clear) {
+    Grid grid(1.0);
+    auto a = grid.insert(Point(1, 1), 1);
+    grid.insert(Point(2, 2), 2);
+    grid.clear();
+    EXPECT_TRUE(grid.empty());
+    EXPECT_FALSE(grid.contains(a));
+    EXPECT_EQ(near(grid, Point(1, 1), 10), (std::vector<int>{}));
+    auto b = grid.insert(Point(3, 3), 3);
+    EXPECT_TRUE(grid.contains(b));
+    EXPECT_FALSE(grid.contains(a));
+    EXPECT_EQ(near(grid, Point(3, 3), 0), (std::vector<int>{3}));
+}
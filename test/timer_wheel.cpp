@@ -0,0 +1,161 @@
+#include "../include/timer_wheel.hpp"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+class TimerWheelTest : public ::testing::Test {
+  protected:
+    size_t advance(uint64_t now) {
+        return wheel.advance(now, [this](int value) {
+            fired.push_back({wheel.now(), value});
+        });
+    }
+
+    TimerWheel<int> wheel;
+    std::vector<std::pair<uint64_t, int>> fired;
+};
+
+TEST_F(TimerWheelTest, InitialState) {
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.now(), 0);
+    EXPECT_EQ(advance(100), 0);
+    EXPECT_EQ(wheel.now(), 100);
+}
+
+TEST_F(TimerWheelTest, FiresAtDeadline) {
+    wheel.schedule(5, 1);
+    wheel.schedule(3, 2);
+    wheel.schedule(5, 3);
+    EXPECT_EQ(wheel.size(), 3);
+
+    EXPECT_EQ(advance(4), 1);
+    EXPECT_EQ(advance(10), 2);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(fired, (std::vector<std::pair<uint64_t, int>>{
+                         {3, 2}, {5, 1}, {5, 3}}));
+}
+
+TEST_F(TimerWheelTest, PastDeadlineFiresOnNextTick) {
+    advance(50);
+    wheel.schedule(10, 7);
+    EXPECT_EQ(wheel.tick([this](int value) { fired.push_back({0, value}); }),
+              1);
+    EXPECT_EQ(wheel.now(), 51);
+}
+
+TEST_F(TimerWheelTest, CascadesThroughAllLevels) {
+    // Segundos, minutos, horas e transbordo para o dia seguinte.
+    std::vector<uint64_t> deadlines = {59, 60, 61, 3599, 3600, 7265,
+                                       86399, 86400, 90061, 200000};
+    for (size_t i = 0; i < deadlines.size(); i++) {
+        wheel.schedule(deadlines[i], static_cast<int>(i));
+    }
+    advance(300000);
+    ASSERT_EQ(fired.size(), deadlines.size());
+    for (size_t i = 0; i < deadlines.size(); i++) {
+        EXPECT_EQ(fired[i].first, deadlines[i]);
+        EXPECT_EQ(fired[i].second, static_cast<int>(i));
+    }
+}
+
+TEST_F(TimerWheelTest, Cancel) {
+    auto a = wheel.schedule(10, 1);
+    auto b = wheel.schedule(4000, 2);
+    EXPECT_TRUE(wheel.pending(a));
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.pending(a));
+    EXPECT_EQ(wheel.size(), 1);
+
+    // O nó de `a` é reaproveitado, mas o identificador antigo continua
+    // inválido.
+    auto c = wheel.schedule(20, 3);
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_TRUE(wheel.pending(c));
+
+    advance(5000);
+    EXPECT_EQ(fired, (std::vector<std::pair<uint64_t, int>>{{20, 3},
+                                                             {4000, 2}}));
+    EXPECT_FALSE(wheel.pending(b));
+    EXPECT_FALSE(wheel.cancel(b));
+}
+
+TEST(TimerWheelValueTest, ValuesAreReleased) {
+    auto shared = std::make_shared<int>(1);
+    TimerWheel<std::shared_ptr<int>> wheel;
+    auto a = wheel.schedule(10, shared);
+    wheel.schedule(20, shared);
+    wheel.schedule(30, shared);
+    EXPECT_EQ(shared.use_count(), 4);
+    wheel.cancel(a);
+    EXPECT_EQ(shared.use_count(), 3);
+    wheel.advance(25, [&](const std::shared_ptr<int>& value) {
+        EXPECT_EQ(value, shared);
+    });
+    EXPECT_EQ(shared.use_count(), 2);
+    wheel.clear();
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(TimerWheelTest, HoursDeadlines) {
+    TimerWheel<int> wheel(Hours(1, 0, 0));
+    EXPECT_EQ(wheel.now(), 3600);
+    wheel.schedule(Hours(1, 30, 15), 1);
+    std::vector<uint64_t> times;
+    wheel.advance(Hours(2, 0, 0), [&](int) { times.push_back(wheel.now()); });
+    ASSERT_EQ(times.size(), 1);
+    EXPECT_EQ(times[0], static_cast<uint64_t>(Hours(1, 30, 15).to_seconds()));
+}
+
+TEST_F(TimerWheelTest, RescheduleFromCallback) {
+    wheel.schedule(1, 0);
+    wheel.advance(10, [this](int value) {
+        fired.push_back({wheel.now(), value});
+        if (value < 3) {
+            wheel.schedule(wheel.now() + 2, value + 1);
+        }
+    });
+    EXPECT_EQ(fired, (std::vector<std::pair<uint64_t, int>>{
+                         {1, 0}, {3, 1}, {5, 2}, {7, 3}}));
+}
+
+TEST_F(TimerWheelTest, Clear) {
+    auto a = wheel.schedule(10, 1);
+    wheel.schedule(100000, 2);
+    wheel.clear();
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_FALSE(wheel.pending(a));
+    EXPECT_EQ(advance(200000), 0);
+}
+
+TEST_F(TimerWheelTest, RandomAgainstSortedOrder) {
+    std::mt19937_64 rng(7);
+    std::vector<std::pair<uint64_t, int>> expected;
+    std::vector<TimerWheel<int>::Handle> handles;
+    for (int i = 0; i < 20000; i++) {
+        uint64_t deadline = rng() % 200000 + 1;
+        handles.push_back(wheel.schedule(deadline, i));
+        expected.push_back({deadline, i});
+    }
+    for (int i = 0; i < 20000; i += 3) {
+        EXPECT_TRUE(wheel.cancel(handles[i]));
+    }
+    std::vector<std::pair<uint64_t, int>> remaining;
+    for (int i = 0; i < 20000; i++) {
+        if (i % 3 != 0) {
+            remaining.push_back(expected[i]);
+        }
+    }
+    std::stable_sort(remaining.begin(), remaining.end(),
+                     [](auto &a, auto &b) { return a.first < b.first; });
+
+    advance(200000);
+    ASSERT_EQ(fired.size(), remaining.size());
+    for (size_t i = 0; i < fired.size(); i++) {
+        EXPECT_EQ(fired[i].first, remaining[i].first);
+    }
+}
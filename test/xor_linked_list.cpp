@@ -0,0 +1,102 @@
+#include "../include/xor_linked_list.hpp"
+#include <gtest/gtest.h>
+
+class XorLinkedListTest : public ::testing::Test {
+  protected:
+    XorLinkedList<int> list;
+};
+
+TEST_F(XorLinkedListTest, InitiallyEmpty) {
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_THROW(list.front(), std::out_of_range);
+    EXPECT_THROW(list.back(), std::out_of_range);
+}
+
+TEST_F(XorLinkedListTest, PushFrontAndBack) {
+    list.push_back(20);
+    list.push_front(10);
+    list.push_back(30);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.front(), 10);
+    EXPECT_EQ(list.back(), 30);
+}
+
+TEST_F(XorLinkedListTest, PopFrontAndBack) {
+    for (int i = 0; i < 4; i++) {
+        list.push_back(i);
+    }
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 2);
+
+    list.pop_back();
+    list.pop_front();
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+    EXPECT_THROW(list.pop_back(), std::out_of_range);
+
+    list.push_front(7);
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST_F(XorLinkedListTest, TraversalBothDirections) {
+    for (int i = 0; i < 100; i++) {
+        list.push_back(i);
+    }
+    int expected = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(expected, 100);
+
+    auto it = list.end();
+    for (int i = 99; i >= 0; i--) {
+        --it;
+        EXPECT_EQ(*it, i);
+    }
+    EXPECT_EQ(it, list.begin());
+}
+
+TEST_F(XorLinkedListTest, IteratorChangesDirection) {
+    for (int i = 0; i < 5; i++) {
+        list.push_back(i);
+    }
+    auto it = list.begin();
+    ++it;
+    ++it;
+    EXPECT_EQ(*it, 2);
+    --it;
+    EXPECT_EQ(*it, 1);
+    ++it;
+    ++it;
+    EXPECT_EQ(*it, 3);
+    *it = 30;
+    EXPECT_TRUE(list.contains(30));
+    EXPECT_FALSE(list.contains(3));
+}
+
+TEST_F(XorLinkedListTest, CopyAndAssign) {
+    list.push_back(10);
+    list.push_back(20);
+
+    XorLinkedList<int> copy(list);
+    XorLinkedList<int> assigned;
+    assigned.push_back(99);
+    assigned = list;
+    list.pop_back();
+
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy.back(), 20);
+    EXPECT_EQ(assigned.size(), 2);
+    EXPECT_EQ(assigned.front(), 10);
+    EXPECT_EQ(assigned.back(), 20);
+}
+
+TEST_F(XorLinkedListTest, NodeUsesSingleLink) {
+    EXPECT_LE(XorLinkedList<int>::node_bytes(), sizeof(void *) * 2);
+}